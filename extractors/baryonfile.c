@@ -78,6 +78,9 @@ main( const int argc ,
   struct veclist *momentum = NULL ; // momentum list
   struct mcorr **proj_corr = NULL ; // projected correlator
 
+  // gamma lists of a compact file and the Cgammas its pairs are made of
+  uint32_t *gsrc = NULL , *gsnk = NULL , *glist = NULL ;
+
   // enums
   proptype basis = CHIRAL ;
   spinhalf spin_proj = NONE ;
@@ -150,15 +153,6 @@ main( const int argc ,
     time_flip = GLU_TRUE ;
   }
 
-  // sanity check the source position
-  tsrc = atoi( argv[ TSRC ] ) ;
-  if( tsrc < 0 || tsrc > (int)(LT-1) ) {
-    fprintf( stderr , "[TSRC] non-sensical source position given %d\n" , tsrc ) ;
-    goto memfree ;
-  } else {
-    fprintf( stdout , "[TSRC] source position at %d \n" , tsrc ) ;
-  }
-
   // get the dimensions
   tok = strtok( (char*)argv[ DIMENSIONS ] , "," ) ;
   Latt.dims[ 0 ] = (int)atoi( tok ) ;
@@ -178,6 +172,15 @@ main( const int argc ,
     }
   }
 
+  // sanity check the source position, needs LT
+  tsrc = atoi( argv[ TSRC ] ) ;
+  if( tsrc < 0 || tsrc > (int)(LT-1) ) {
+    fprintf( stderr , "[TSRC] non-sensical source position given %d\n" , tsrc ) ;
+    goto memfree ;
+  } else {
+    fprintf( stdout , "[TSRC] source position at %d \n" , tsrc ) ;
+  }
+
   // precompute the gamma basis
   GAMMAS = malloc( NSNS * sizeof( struct gamma ) ) ;
   if( make_gammas( GAMMAS , basis ) == FAILURE ) {
@@ -185,21 +188,54 @@ main( const int argc ,
   }
 
   // is defined in reader.c
-  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ) ;
+  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ,
+		       &gsrc , &gsnk ) ;
+
+  if( corr == NULL ) goto memfree ;
 
   NGAMS = (size_t)( sqrt( NGSRC[0] ) ) ;
+
+  // NFULL is the number of Cgammas of the basis the projections see
+  size_t NFULL = NGAMS ;
+
+  // the spin projections mix Cgammas so a compact file is poked into
+  // the full basis, its pair channel GSNK + NSNS*GSRC tells us the list
+  if( gsrc != NULL ) {
+    if( NGAMS * NGAMS != NGSRC[0] ) {
+      fprintf( stderr , "[BARYON] %u source channels are not pairs\n" ,
+	       NGSRC[0] ) ;
+      goto memfree ;
+    }
+    glist = malloc( NGAMS * sizeof( uint32_t ) ) ;
+    size_t i ;
+    for( i = 0 ; i < NGAMS ; i++ ) {
+      glist[ i ] = gsrc[ i * NGAMS ] / NSNS ;
+    }
+    NFULL = NSNS ;
+    struct mcorr **full = expand_gammas( (const struct mcorr**)corr , 
+					 gsrc , gsnk , NGSRC[0] , NGSNK[0] ,
+					 NSNS*NSNS , NSNS , NMOM[0] ) ;
+    free_momcorrs( corr , NGSRC[0] , NGSNK[0] , NMOM[0] ) ;
+    corr = full ;
+    NGSRC[0] = NSNS*NSNS ; NGSNK[0] = NSNS ;
+    if( corr == NULL ) goto memfree ;
+  }
   
   // allocate projected corr
   proj_corr = allocate_momcorrs( NGAMS , NGAMS , NMOM[0] ) ;
 
-  if( corr == NULL || proj_corr == NULL ) goto memfree ;
+  if( proj_corr == NULL ) goto memfree ;
 
   // do the projection
 #pragma omp parallel for private( GSGK )
-  for( GSGK = 0 ; GSGK < ( NGSRC[0] ) ; GSGK++ ) {
+  for( GSGK = 0 ; GSGK < ( NGAMS * NGAMS ) ; GSGK++ ) {
 
     const size_t GSRC = GSGK / NGAMS ;
     const size_t GSNK = GSGK % NGAMS ;
+
+    // Cgammas of the pair
+    const size_t G1 = ( glist == NULL ) ? GSRC : glist[ GSRC ] ;
+    const size_t G2 = ( glist == NULL ) ? GSNK : glist[ GSNK ] ;
     
     // loop momenta
     size_t p ;
@@ -208,9 +244,9 @@ main( const int argc ,
       // projections happen here
       const double complex *C = baryon_project( (const struct mcorr**)corr , 
 						GAMMAS , momentum ,
-						GSRC , GSNK , p ,
+						G1 , G2 , p ,
 						parity_proj ,
-						spin_proj , NGAMS ) ;
+						spin_proj , NFULL ) ;
  
       // poke into proj_corr
       size_t t ;
@@ -246,10 +282,10 @@ main( const int argc ,
     }
   }
 
-  // write out the correlator
-  write_momcorr( argv[ OUTFILE ] , (const struct mcorr **)proj_corr , 
-		 momentum , NULL ,
-		 NGAMS , NGAMS , (const int*)NMOM , "" ) ;
+  // write out the correlator, listing the Cgammas if it is compact
+  write_momcorr_gammas( argv[ OUTFILE ] , (const struct mcorr **)proj_corr , 
+			momentum , NULL , NGAMS , NGAMS , glist , glist ,
+			(const int*)NMOM , "" ) ;
 
  memfree :
 
@@ -258,12 +294,19 @@ main( const int argc ,
 
   if( NMOM[0] != 0 ) {
     // free the memory of the read-in correlator
-    free_momcorrs( corr , NGSRC[0] , NGSNK[0] , NMOM[0] ) ;
+    if( corr != NULL ) {
+      free_momcorrs( corr , NGSRC[0] , NGSNK[0] , NMOM[0] ) ;
+    }
 
     // free the memory of the projected correlator
-    free_momcorrs( proj_corr , NGAMS , NGAMS , NMOM[0] ) ;
+    if( proj_corr != NULL ) {
+      free_momcorrs( proj_corr , NGAMS , NGAMS , NMOM[0] ) ;
+    }
   }
 
+  // free the gamma lists
+  free( gsrc ) ; free( gsnk ) ; free( glist ) ;
+
   // free the momentum list
   free( momentum ) ;
 
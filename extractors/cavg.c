@@ -18,6 +18,18 @@ struct correlator_file {
 // lattice geometry
 struct latt_info Latt ;
 
+// do two files list the same gamma channels? NULL is the full basis
+static GLU_bool
+same_gammas( const uint32_t *g1 ,
+	     const uint32_t *g2 ,
+	     const uint32_t N )
+{
+  if( g1 == NULL || g2 == NULL ) {
+    return ( g1 == g2 ) ? GLU_TRUE : GLU_FALSE ;
+  }
+  return memcmp( g1 , g2 , N * sizeof( uint32_t ) ) ? GLU_FALSE : GLU_TRUE ;
+}
+
 // little code for averaging correlation functions
 int 
 main( const int argc ,
@@ -37,13 +49,17 @@ main( const int argc ,
 
   uint32_t NGSRC[1] = { 0 } , NGSNK[1] = { 0 } , NMOM[1] = { 0 } ;
 
+  // gamma lists of compact files, which have to agree
+  uint32_t *gsrc = NULL , *gsnk = NULL ;
+
   FILE *infile = fopen( argv[ 1 ] , "rb" ) ;
   if( infile == NULL ) {
     fprintf( stderr , "[IO] File %s does not exist\n" , argv[ 1 ] ) ;
     goto memfree ;
   }
   cfiles[0].corr = process_file( &cfiles[0].momentum ,
-				 infile , NGSRC , NGSNK , NMOM ) ;
+				 infile , NGSRC , NGSNK , NMOM ,
+				 &gsrc , &gsnk ) ;
   fprintf( stdout , "[IO] (N_SRC, N_SNK, NMOM) :: (%d, %d, %d)\n" , 
 	   NGSRC[0] , NGSNK[0] , NMOM[0] ) ;
   fprintf( stdout , "\n[IO] file read \n" ) ;
@@ -56,8 +72,10 @@ main( const int argc ,
       goto memfree ;
     }
     uint32_t tNGSRC[1] = { 0 } , tNGSNK[1] = { 0 } , tNMOM[1] = { 0 } ;
+    uint32_t *tgsrc = NULL , *tgsnk = NULL ;
     cfiles[n].corr = process_file( &cfiles[n].momentum ,
-				   tinfile , tNGSRC , tNGSNK , tNMOM ) ;
+				   tinfile , tNGSRC , tNGSNK , tNMOM ,
+				   &tgsrc , &tgsnk ) ;
     fprintf( stdout , "[IO] (N_SRC, N_SNK, NMOM) :: (%d, %d, %d)\n" , 
 	     tNGSRC[0] , tNGSNK[0] , tNMOM[0] ) ;
     fprintf( stdout , "\n[IO] file read \n" ) ;
@@ -66,6 +84,14 @@ main( const int argc ,
 	tNGSNK[0] != NGSNK[0] ||
 	tNMOM[0] != NMOM[0] ) {
       fprintf( stderr , "[IO] files have different SRC/SNK/NMOM\n" ) ;
+      free( tgsrc ) ; free( tgsnk ) ;
+      goto memfree ;
+    }
+    const GLU_bool same_src = same_gammas( gsrc , tgsrc , NGSRC[0] ) ;
+    const GLU_bool same_snk = same_gammas( gsnk , tgsnk , NGSNK[0] ) ;
+    free( tgsrc ) ; free( tgsnk ) ;
+    if( same_src == GLU_FALSE || same_snk == GLU_FALSE ) {
+      fprintf( stderr , "[IO] files have different gamma channels\n" ) ;
       goto memfree ;
     }
   }
@@ -94,9 +120,9 @@ main( const int argc ,
     twist_zero[ mu ] = 0.0 ;
   }
   // write the averaged correlator
-  write_momcorr( argv[ argc-1 ] , (const struct mcorr**)cfiles[0].corr , 
-		 cfiles[0].momentum , twist_zero , NGSRC[0] , NGSNK[0] ,
-		 (const int*)NMOM , "" ) ;
+  write_momcorr_gammas( argv[ argc-1 ] , (const struct mcorr**)cfiles[0].corr , 
+			cfiles[0].momentum , twist_zero , NGSRC[0] , NGSNK[0] ,
+			gsrc , gsnk , (const int*)NMOM , "" ) ;
   
  memfree :
   
@@ -110,6 +136,9 @@ main( const int argc ,
       free( cfiles[n].momentum ) ;
     }
   }
+
+  // free the gamma lists
+  free( gsrc ) ; free( gsnk ) ;
   
   return SUCCESS ;
 }
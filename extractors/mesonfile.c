@@ -39,11 +39,15 @@ main( const int argc ,
   struct mcorr **corr = NULL ;
   struct veclist *momentum = NULL ;
 
+  // gamma lists of a compact file, NULL for the full basis
+  uint32_t *gsrc = NULL , *gsnk = NULL ;
+
   // number of correlators printed to stdout
   int corrs_written = 0 ;
 
   // read in the file and pack our structs
-  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ) ;
+  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ,
+		       &gsrc , &gsnk ) ;
   
   if( corr == NULL ) goto memfree ;
 
@@ -53,16 +57,18 @@ main( const int argc ,
     // tokenize argv into the correlators people want
     char *tok1 = strtok( (char*)argv[i] , "," ) ;
     if( tok1 == NULL ) break ;
-    const int idx1 = atoi( tok1 ) ;
-    if( idx1 >= (int)NGSRC[0] || idx1 < 0 ) { 
-      fprintf( stderr , "[Momcorr] Non-sensical source index %d \n" , idx1 ) ;
+    const int g1 = atoi( tok1 ) ;
+    const int idx1 = ( g1 < 0 ) ? -1 : gamma_index( gsrc , NGSRC[0] , g1 ) ;
+    if( idx1 < 0 ) { 
+      fprintf( stderr , "[Momcorr] source gamma %d is not in the file \n" , g1 ) ;
       break ;
     } 
     char *tok2 = strtok( NULL , "," ) ;
     if( tok2 == NULL ) break ;
-    const int idx2 = atoi( tok2 ) ;
-    if( idx2 >= (int)NGSNK[0] || idx2 < 0 ) { 
-      fprintf( stderr , "[Momcorr] Non-sensical sink index %d \n" , idx2 ) ;
+    const int g2 = atoi( tok2 ) ;
+    const int idx2 = ( g2 < 0 ) ? -1 : gamma_index( gsnk , NGSNK[0] , g2 ) ;
+    if( idx2 < 0 ) { 
+      fprintf( stderr , "[Momcorr] sink gamma %d is not in the file \n" , g2 ) ;
       break ;
     } 
 
@@ -96,7 +102,7 @@ main( const int argc ,
 	     momentum[ matchmom ].MOM[2] ) ;
 
     fprintf( stdout , "[Momcorr] Correlator [ Source :: %d | Sink :: %d ] \n\n" , 
-	     idx1 , idx2 ) ;
+	     g1 , g2 ) ;
 
     size_t t ;
     for( t = 0 ; t < LT ; t++ ) {
@@ -123,6 +129,9 @@ main( const int argc ,
   // free the momentum list
   free( momentum ) ;
 
+  // free the gamma lists
+  free( gsrc ) ; free( gsnk ) ;
+
   fclose( infile ) ;
 
   return SUCCESS ;
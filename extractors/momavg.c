@@ -227,7 +227,9 @@ write_averages( const struct veclist *list ,
 		const char *outname ,
 		const uint32_t NMOM , 
 		const uint32_t NGSRC ,
-		const uint32_t NGSNK )
+		const uint32_t NGSNK ,
+		const uint32_t *gsrc ,
+		const uint32_t *gsnk )
 {
   // create a dummy correlator
   int *dNMOM = malloc( sizeof( int ) ) ;
@@ -248,8 +250,8 @@ write_averages( const struct veclist *list ,
     char str[ 256 ] ;
     sprintf( str , "%s.%zu.bin" , outname , p ) ;
     // need to pass zero twist to momentum writer
-    write_momcorr( str , (const struct mcorr **)dcorr , dlist , 
-		   NULL , NGSRC , NGSNK , dNMOM , "" ) ;
+    write_momcorr_gammas( str , (const struct mcorr **)dcorr , dlist , 
+			  NULL , NGSRC , NGSNK , gsrc , gsnk , dNMOM , "" ) ;
   }
 
   // free the dummies
@@ -311,7 +313,11 @@ main( const int argc ,
 
   uint32_t NGSRC[1] = { 0 } , NGSNK[1] = { 0 } , NMOM[1] = { 0 } ;
 
-  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ) ;
+  // gamma lists of a compact file are passed through to the output
+  uint32_t *gsrc = NULL , *gsnk = NULL ;
+
+  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ,
+		       &gsrc , &gsnk ) ;
 
   fprintf( stdout , "[IO] (N_SRC, N_SNK, NMOM) :: (%d, %d, %d)\n" , 
 	   NGSRC[0] , NGSNK[0] , NMOM[0] ) ;
@@ -345,7 +351,7 @@ main( const int argc ,
   if( split == GLU_TRUE ) {
     // split the averaged results into separate files for ease of reading
     write_averages( avlist , (const struct mcorr**)corravg , argv[3] , 
-		    Nequiv , NGSRC[0] , NGSNK[0] ) ;
+		    Nequiv , NGSRC[0] , NGSNK[0] , gsrc , gsnk ) ;
   } else {
     double twist_zero[ ND ] ;
     size_t mu ;
@@ -354,8 +360,9 @@ main( const int argc ,
     }
     // write into a file
     int NMOM[1] = { Nequiv } ;
-    write_momcorr( argv[ OUTFILE ] , (const struct mcorr **)corravg , 
-		   avlist , twist_zero , NGSRC[0] , NGSNK[0] , (const int*)NMOM , "" ) ;
+    write_momcorr_gammas( argv[ OUTFILE ] , (const struct mcorr **)corravg , 
+			  avlist , twist_zero , NGSRC[0] , NGSNK[0] ,
+			  gsrc , gsnk , (const int*)NMOM , "" ) ;
   }
 
   fprintf( stdout , "\n[MOMAVG] all finished \n" ) ;
@@ -375,6 +382,9 @@ main( const int argc ,
   // free the average momentum list
   free( avlist ) ;
 
+  // free the gamma lists
+  free( gsrc ) ; free( gsnk ) ;
+
   // free the average correlator
   if( Nequiv > 0 ) {
     free_momcorrs( corravg , NGSRC[0] , NGSNK[0] , Nequiv ) ;
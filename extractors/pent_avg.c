@@ -45,7 +45,8 @@ main( const int argc ,
   struct veclist *momentum = NULL ;
 
   // read in the file and pack our structs
-  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ) ;
+  corr = process_file( &momentum , infile , NGSRC , NGSNK , NMOM ,
+		      NULL , NULL ) ;
   
   if( corr == NULL ) goto memfree ;
 
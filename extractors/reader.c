@@ -143,17 +143,90 @@ write_momlist( const struct veclist *momentum ,
   return ;
 }
 
+// read the gamma channel list of a compact file
+static uint32_t*
+read_gamma_list( uint32_t N[1] ,
+		 FILE *infile )
+{
+  if( FREAD32( N , 1 , infile ) == FAILURE ) return NULL ;
+  if( N[0] == 0 ) {
+    fprintf( stderr , "[IO] empty gamma list\n" ) ;
+    return NULL ;
+  }
+  uint32_t *list = malloc( N[0] * sizeof( uint32_t ) ) ;
+  if( FREAD32( list , (int)N[0] , infile ) == FAILURE ) {
+    free( list ) ;
+    return NULL ;
+  }
+  return list ;
+}
+
+// position of a gamma channel in the file's list
+int
+gamma_index( const uint32_t *glist ,
+	     const uint32_t N ,
+	     const size_t gamma )
+{
+  if( glist == NULL ) {
+    return ( gamma < N ) ? (int)gamma : -1 ;
+  }
+  size_t i ;
+  for( i = 0 ; i < N ; i++ ) {
+    if( glist[ i ] == gamma ) return (int)i ;
+  }
+  return -1 ;
+}
+
+// poke a compact file's channels into the full basis, zeros elsewhere
+struct mcorr**
+expand_gammas( const struct mcorr **corr ,
+	       const uint32_t *gsrc ,
+	       const uint32_t *gsnk ,
+	       const uint32_t NGSRC ,
+	       const uint32_t NGSNK ,
+	       const size_t NFSRC ,
+	       const size_t NFSNK ,
+	       const uint32_t NMOM )
+{
+  struct mcorr **full = allocate_momcorrs( NFSRC , NFSNK , NMOM ) ;
+  if( full == NULL ) return NULL ;
+  size_t GSRC , GSNK , p ;
+  for( GSRC = 0 ; GSRC < NFSRC ; GSRC++ ) {
+    const int i = gamma_index( gsrc , NGSRC , GSRC ) ;
+    for( GSNK = 0 ; GSNK < NFSNK ; GSNK++ ) {
+      const int j = gamma_index( gsnk , NGSNK , GSNK ) ;
+      for( p = 0 ; p < NMOM ; p++ ) {
+	if( i < 0 || j < 0 ) {
+	  memset( full[ GSRC ][ GSNK ].mom[ p ].C , 0 , 
+		  LT * sizeof( double complex ) ) ;
+	} else {
+	  memcpy( full[ GSRC ][ GSNK ].mom[ p ].C , corr[ i ][ j ].mom[ p ].C ,
+		  LT * sizeof( double complex ) ) ;
+	}
+      }
+    }
+  }
+  return full ;
+}
+
 // allocates and packs mcorr array
 struct mcorr**
 process_file( struct veclist **momentum ,
 	      FILE *infile ,
 	      uint32_t NGSRC[1] ,
 	      uint32_t NGSNK[1] ,
-	      uint32_t NMOM[1] )
+	      uint32_t NMOM[1] ,
+	      uint32_t **gsrc ,
+	      uint32_t **gsnk )
 {
   // magic number
   uint32_t magic[1] ;
 
+  // the gamma lists of a compact file
+  uint32_t *srclist = NULL , *snklist = NULL , NLSRC[1] = { 0 } , NLSNK[1] = { 0 } ;
+  if( gsrc != NULL ) *gsrc = NULL ;
+  if( gsnk != NULL ) *gsnk = NULL ;
+
   // checksums
   uint32_t cksuma = 0 , cksumb = 0 , csum[ 2 ] = { 0 , 0 } ; 
 
@@ -166,7 +239,7 @@ process_file( struct veclist **momentum ,
   }
 
   // check the magic number, tells us the edianness
-  if( magic[0] != CORR_MAGIC ) {
+  if( magic[0] != CORR_MAGIC && magic[0] != CORR_GAMMA_MAGIC ) {
     if( magic[0] == 67798233 ) {
       fprintf( stderr , "[IO] Old correlator file dectected\n"
 	       "[IO] this is now DEPRECATED please use version < 256"
@@ -174,7 +247,7 @@ process_file( struct veclist **momentum ,
       return NULL ;
     }
     bswap_32( 1 , magic ) ;
-    if( magic[0] != CORR_MAGIC ) {
+    if( magic[0] != CORR_MAGIC && magic[0] != CORR_GAMMA_MAGIC ) {
       fprintf( stderr , "[IO] Magic number read failure\n" ) ;
       if( magic[0] == 67798233 ) {
 	fprintf( stderr , "[IO] Old correlator file dectected\n"
@@ -186,6 +259,21 @@ process_file( struct veclist **momentum ,
     must_swap = GLU_TRUE ;
   }
 
+  // compact files list the gamma channel of each row and column
+  if( magic[0] == CORR_GAMMA_MAGIC ) {
+    if( gsrc == NULL || gsnk == NULL ) {
+      fprintf( stderr , "[IO] file only holds some gamma channels, "
+	       "this reader needs the full basis\n" ) ;
+      return NULL ;
+    }
+    if( ( srclist = read_gamma_list( NLSRC , infile ) ) == NULL ||
+	( snklist = read_gamma_list( NLSNK , infile ) ) == NULL ) {
+      fprintf( stderr , "[IO] gamma list read failure\n" ) ;
+      free( srclist ) ;
+      return NULL ;
+    }
+  }
+
   // read the length of the momentum list
   if( FREAD32( NMOM , 1 , infile ) == FAILURE ) return NULL ;
 
@@ -230,6 +318,18 @@ process_file( struct veclist **momentum ,
   fprintf( stdout , "[NGAMMAS] NGSRC :: %u NGSNK :: %u \n" ,
 	   NGSRC[0] , NGSNK[0] ) ;
 
+  if( srclist != NULL ) {
+    if( NLSRC[0] != NGSRC[0] || NLSNK[0] != NGSNK[0] ) {
+      fprintf( stderr , "[IO] gamma lists ( %u , %u ) do not match the "
+	       "correlator ( %u , %u )\n" , NLSRC[0] , NLSNK[0] ,
+	       NGSRC[0] , NGSNK[0] ) ;
+      free( srclist ) ; free( snklist ) ;
+      return NULL ;
+    }
+    *gsrc = srclist ;
+    *gsnk = snklist ;
+  }
+
   // read in an LT
   uint32_t L0[ 1 ] ;
   if( FREAD32( L0 , 1 , infile ) == FAILURE ) return NULL ;
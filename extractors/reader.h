@@ -23,14 +23,41 @@ write_momlist( const struct veclist *momentum ,
 	       const int NMOM ) ;
 
 /**
-   @fn struct mcorr** process_file( struct veclist **momentum , FILE *infile , uint32_t NGSRC[1] , uint32_t NGSNK[1] , uint32_t NMOM[1] )
+   @fn int gamma_index( const uint32_t *glist , const uint32_t N , const size_t gamma )
+   @brief index of channel gamma in a file's gamma list of length N, a NULL list is the full basis
+   @return -1 if the channel is not in the file
+ */
+int
+gamma_index( const uint32_t *glist ,
+	     const uint32_t N ,
+	     const size_t gamma ) ;
+
+/**
+   @fn struct mcorr** expand_gammas( const struct mcorr **corr , const uint32_t *gsrc , const uint32_t *gsnk , const uint32_t NGSRC , const uint32_t NGSNK , const size_t NFSRC , const size_t NFSNK , const uint32_t NMOM )
+   @brief allocate a NFSRC x NFSNK correlator in the full gamma basis holding the channels of a compact file and zeros elsewhere
+ */
+struct mcorr**
+expand_gammas( const struct mcorr **corr ,
+	       const uint32_t *gsrc ,
+	       const uint32_t *gsnk ,
+	       const uint32_t NGSRC ,
+	       const uint32_t NGSNK ,
+	       const size_t NFSRC ,
+	       const size_t NFSNK ,
+	       const uint32_t NMOM ) ;
+
+/**
+   @fn struct mcorr** process_file( struct veclist **momentum , FILE *infile , uint32_t NGSRC[1] , uint32_t NGSNK[1] , uint32_t NMOM[1] , uint32_t **gsrc , uint32_t **gsnk )
    @brief read file, allocate mcorr and pack it
+   @param gsrc,gsnk :: set to the (allocated) gamma lists of a compact file or NULL for a full one, if these are NULL compact files are refused
  */
 struct mcorr**
 process_file( struct veclist **momentum ,
 	      FILE *infile ,
 	      uint32_t NGSRC[1] ,
 	      uint32_t NGSNK[1] ,
-	      uint32_t NMOM[1] ) ;
+	      uint32_t NMOM[1] ,
+	      uint32_t **gsrc ,
+	      uint32_t **gsnk ) ;
 
 #endif
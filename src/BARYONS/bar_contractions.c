@@ -234,6 +234,7 @@ baryon_contract_walls( struct mcorr **corr ,
 		       const struct spinor SUM3 ,
 		       const struct gamma *Cgmu ,
 		       const struct gamma *Cgnu ,
+		       const size_t ngammas ,
 		       const size_t t ,
 		       const baryon_type btype )
 {
@@ -246,18 +247,17 @@ baryon_contract_walls( struct mcorr **corr ,
   case UUU_BARYON : f = uuu ; break ;
   }
 
-  // some temporary storage
-  double complex **term = malloc( 2 * sizeof( double complex* ) ) ;
-  term[0] = malloc( NSNS * sizeof( double complex ) ) ;
-  term[1] = malloc( NSNS * sizeof( double complex ) ) ;
+  // some temporary storage, small enough for the stack
+  double complex term0[ NSNS ] , term1[ NSNS ] ;
+  double complex *term[ 2 ] = { term0 , term1 } ;
   
   // accumulate the sums with open dirac indices
   size_t GSGK ;
   #pragma omp for private(GSGK) schedule(dynamic)
-  for( GSGK = 0 ; GSGK < ( B_CHANNELS * B_CHANNELS ) ; GSGK++ ) {
+  for( GSGK = 0 ; GSGK < ( ngammas * ngammas ) ; GSGK++ ) {
     // source and sink indices
-    const size_t GSRC = GSGK / B_CHANNELS ;
-    const size_t GSNK = GSGK % B_CHANNELS ;
+    const size_t GSRC = GSGK / ngammas ;
+    const size_t GSNK = GSGK % ngammas ;
     // set terms to zero
     size_t d1d2 ;
     for( d1d2 = 0 ; d1d2 < NSNS ; d1d2++ ) {
@@ -273,7 +273,6 @@ baryon_contract_walls( struct mcorr **corr ,
       corr[ GSGK ][ odc ].mom[ 0 ].C[ t ] = f( term[0][odc] , term[1][odc] ) ;
     }
   }
-  free( term[0] ) ; free( term[1] ) ; free( term ) ;
   return ;
 }
 
@@ -313,6 +312,26 @@ baryon_momentum_project( struct measurements *M ,
 	  f( sum1[ lid ] , sum2[ lid ] ) ;
       }
     }
+  } else if( M -> is_wall_mom == GLU_TRUE || M -> is_dft == GLU_TRUE ) {
+    // phase-table projection onto the listed momenta
+    size_t idx ;
+    #pragma omp for private(idx) schedule(dynamic)
+    for( idx = 0 ; idx < stride1 * stride2 * M -> nmom[0] ; idx++ ) {
+      const size_t GSodc = idx % ( stride1 * stride2 ) ;
+      const size_t p = idx / ( stride1 * stride2 ) ;
+      const size_t GSGK = GSodc / stride2 ;
+      const size_t odc = GSodc % stride2 ;
+      const double complex *sum1 = M -> in[ 0 + 2 * GSodc ] ;
+      const double complex *sum2 = M -> in[ 1 + 2 * GSodc ] ;
+      const double complex *eipx = M -> dft_mom[ p ] ;
+      register double complex s1 = 0.0 , s2 = 0.0 ;
+      size_t site ;
+      for( site = 0 ; site < LCU ; site++ ) {
+	s1 += sum1[ site ] * eipx[ site ] ;
+	s2 += sum2[ site ] * eipx[ site ] ;
+      }
+      M -> corr[ GSGK ][ odc ].mom[ p ].C[ t ] = f( s1 , s2 ) ;
+    }
   } else {
     // loop over flatteded open dirac indices
     size_t GSodc ;
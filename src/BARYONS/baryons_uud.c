@@ -23,10 +23,12 @@ int
 baryons_2fdiagonal( struct propagator prop1 ,
 		    struct propagator prop2 ,
 		    struct cut_info CUTINFO ,
+		    const size_t *gammas ,
+		    const size_t ngammas ,
 		    const char *outfile )
 {
   // counters
-  const size_t stride1 = B_CHANNELS * B_CHANNELS ;
+  const size_t stride1 = ngammas * ngammas ;
   const size_t stride2 = NSNS ;
 
   // flat dirac indices are all colors and all single gamma combinations
@@ -40,8 +42,8 @@ baryons_2fdiagonal( struct propagator prop1 ,
   sprintf( bar_outfile , "%s.uud" , outfile ) ;
 
   // gamma LUT
-  struct gamma *Cgmu = malloc( B_CHANNELS * sizeof( struct gamma ) ) ;
-  struct gamma *Cgnu = malloc( B_CHANNELS * sizeof( struct gamma ) ) ;
+  struct gamma *Cgmu = malloc( ngammas * sizeof( struct gamma ) ) ;
+  struct gamma *Cgnu = malloc( ngammas * sizeof( struct gamma ) ) ;
 
   // initialise our measurement struct
   struct propagator prop[ Nprops ] = { prop1 , prop2 } ;
@@ -55,26 +57,31 @@ baryons_2fdiagonal( struct propagator prop1 ,
 
   // precompute the gammas we use
   size_t i ;
-  for( i = 0 ; i < B_CHANNELS ; i++ ) {
-    Cgmu[ i ] = CGmu( M.GAMMAS[ i ] , M.GAMMAS ) ;
+  for( i = 0 ; i < ngammas ; i++ ) {
+    Cgmu[ i ] = CGmu( M.GAMMAS[ gammas[ i ] ] , M.GAMMAS ) ;
     Cgnu[ i ] = gt_Gdag_gt( Cgmu[i] , M.GAMMAS[ GAMMA_T ] ) ;
   }
 
   // read in the first timeslice
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
 #pragma omp parallel
   {
-    size_t t = 0 ;
+    size_t tt = 0 ;
     
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
-    sink_smear( M.S , M.S1 , t , CUTINFO , Nprops ) ;
+    sink_smear( M.S , M.S1 , tstart , CUTINFO , Nprops ) ;
 
     {
        #pragma omp barrier
     }
     
     // Time slice loop 
-    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
 
       // if we are doing nonrel-chiral mesons we switch chiral to nrel
       rotate_offdiag( M.S , prop , Nprops ) ;
@@ -90,10 +97,13 @@ baryons_2fdiagonal( struct propagator prop1 ,
 
       // strange memory access pattern threads better than what was here before
       size_t site ;
-      if( t < ( LT - 1 ) ) {
-        read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+        read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
       
+      // spatial sums by FFT convolution if that is cheaper
+      sum_spatial_conv( &M ) ;
+
       // Loop over spatial volume threads better
       #pragma omp for private(site)
       for( site = 0 ; site < LCU ; site++ ) {
@@ -104,12 +114,9 @@ baryons_2fdiagonal( struct propagator prop1 ,
 	
 	size_t GSGK ;
 	for( GSGK = 0 ; GSGK < stride1 ; GSGK++ ) {
-	  const size_t GSRC = GSGK / B_CHANNELS ;
-	  const size_t GSNK = GSGK % B_CHANNELS ;
-	  #ifdef TWOPOINT_FILTER
-	  if( !filter[ GSRC ][ GSNK ] ) continue ;
-	  #endif
-	  
+	  const size_t GSRC = GSGK / ngammas ;
+	  const size_t GSNK = GSGK % ngammas ;
+
 	  // Wall-Local
 	  baryon_contract_site_mom( M.in ,
 				    SUM_r2[0] , SUM_r2[0] , SUM_r2[1] ,
@@ -120,15 +127,16 @@ baryons_2fdiagonal( struct propagator prop1 ,
       // loop over open indices performing wall contraction
       baryon_contract_walls( M.wwcorr , 
 			     M.SUM[0] , M.SUM[0] , M.SUM[1] , 
-			     Cgmu , Cgnu , tshifted , UUD_BARYON ) ;
+			     Cgmu , Cgnu , ngammas ,
+			     tshifted , UUD_BARYON ) ;
 
       baryon_momentum_project( &M , stride1 , stride2 ,
 			       tshifted , UUD_BARYON ,
 			       CUTINFO.configspace ) ;
 
       // smear the forward prop
-      if( t < (LT-1) ) {
-	sink_smear( M.Sf , M.S1 , t+1 , CUTINFO , Nprops ) ;
+      if( tt < LT-1 ) {
+	sink_smear( M.Sf , M.S1 , (t+1)%LT , CUTINFO , Nprops ) ;
       }
       
       #pragma omp single
@@ -137,7 +145,7 @@ baryons_2fdiagonal( struct propagator prop1 ,
 	copy_props( &M , Nprops ) ;
 	
 	// status of the computation
-	progress_bar( t , LT ) ;
+	progress_bar( tt , LT ) ;
       }
     }
   }
@@ -145,7 +153,13 @@ baryons_2fdiagonal( struct propagator prop1 ,
   if( error_code == FAILURE ) goto memfree ;
 
   // write out the baryons wall-local and wall-wall  
-  write_momcorr_WW( M , bar_outfile , stride1 , stride2 ) ;
+  // a Cgamma subset only writes the channel pairs it computed
+  uint32_t chan[ B_CHANNELS*B_CHANNELS ] ;
+  if( gamma_channel_list( chan , gammas , ngammas , GLU_TRUE ) == GLU_TRUE ) {
+    write_momcorr_WW_gammas( M , bar_outfile , stride1 , stride2 , chan , NULL ) ;
+  } else {
+    write_momcorr_WW( M , bar_outfile , stride1 , stride2 ) ;
+  }
 
   // failure sink
  memfree :
@@ -22,10 +22,12 @@
 int
 baryons_diagonal( struct propagator prop1 ,
 		  struct cut_info CUTINFO ,
+		  const size_t *gammas ,
+		  const size_t ngammas ,
 		  const char *outfile )
 {
   // counters
-  const size_t stride1 = B_CHANNELS * B_CHANNELS ;
+  const size_t stride1 = ngammas * ngammas ;
   const size_t stride2 = NSNS ;
 
   // flat dirac indices are all colors and all single gamma combinations
@@ -39,8 +41,8 @@ baryons_diagonal( struct propagator prop1 ,
   sprintf( bar_outfile , "%s.uuu" , outfile ) ;
 
   // gamma LUT
-  struct gamma *Cgmu = malloc( B_CHANNELS * sizeof( struct gamma ) ) ;
-  struct gamma *Cgnu = malloc( B_CHANNELS * sizeof( struct gamma ) ) ;
+  struct gamma *Cgmu = malloc( ngammas * sizeof( struct gamma ) ) ;
+  struct gamma *Cgnu = malloc( ngammas * sizeof( struct gamma ) ) ;
 
   // initialise our measurement struct
   struct propagator prop[ Nprops ] = { prop1 } ;
@@ -55,27 +57,32 @@ baryons_diagonal( struct propagator prop1 ,
 
   // precompute the gammas we use
   size_t i ;
-  for( i = 0 ; i < B_CHANNELS ; i++ ) {
-    Cgmu[ i ] = CGmu( M.GAMMAS[ i ] , M.GAMMAS ) ;
+  for( i = 0 ; i < ngammas ; i++ ) {
+    Cgmu[ i ] = CGmu( M.GAMMAS[ gammas[ i ] ] , M.GAMMAS ) ;
     Cgnu[ i ] = gt_Gdag_gt( Cgmu[i] , M.GAMMAS[ GAMMA_T ] ) ;
   }
 
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
 #pragma omp parallel
   {
-    size_t t = 0 ;
+    size_t tt = 0 ;
     
     // read in the first timeslice
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
     // smear it if we wish
-    sink_smear( M.S , M.S1 , t , CUTINFO , Nprops ) ;
+    sink_smear( M.S , M.S1 , tstart , CUTINFO , Nprops ) ;
 
     {
        #pragma omp barrier
     }
     
     // Time slice loop 
-    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
 
       // compute wall-wall sum
       #pragma omp single
@@ -88,9 +95,13 @@ baryons_diagonal( struct propagator prop1 ,
  
       // strange memory access pattern threads better than what was here before
       size_t site ;
-      if( t < ( LT - 1 ) ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
+
+      // spatial sums by FFT convolution if that is cheaper
+      sum_spatial_conv( &M ) ;
+
       // Loop over spatial volume threads better
       #pragma omp for private(site)
       for( site = 0 ; site < LCU ; site++ ) {
@@ -101,12 +112,9 @@ baryons_diagonal( struct propagator prop1 ,
 	
 	size_t GSGK ; // combined gamma source and sink indices
 	for( GSGK = 0 ; GSGK < stride1 ; GSGK++ ) {
-	  const size_t GSRC = GSGK / B_CHANNELS ;
-	  const size_t GSNK = GSGK % B_CHANNELS ;
-	  #ifdef TWOPOINT_FILTER
-	  if( !filter[ GSRC ][ GSNK ] ) continue ;
-	  #endif
-	  
+	  const size_t GSRC = GSGK / ngammas ;
+	  const size_t GSNK = GSGK % ngammas ;
+
 	  // Wall-Local
 	  baryon_contract_site_mom( M.in ,
 				    SUM_r2[0] , SUM_r2[0] , SUM_r2[0] ,
@@ -117,7 +125,8 @@ baryons_diagonal( struct propagator prop1 ,
       // loop over open indices performing wall contraction
       baryon_contract_walls( M.wwcorr , 
 			     M.SUM[0] , M.SUM[0] , M.SUM[0] , 
-			     Cgmu , Cgnu , tshifted , UUU_BARYON ) ;
+			     Cgmu , Cgnu , ngammas ,
+			     tshifted , UUU_BARYON ) ;
 
       // momentum projection 
       baryon_momentum_project( &M , stride1 , stride2 ,
@@ -125,8 +134,8 @@ baryons_diagonal( struct propagator prop1 ,
 			       CUTINFO.configspace ) ;
 
       // smear the forward prop
-      if( t < (LT-1) ) {
-	sink_smear( M.Sf , M.S1 , t+1 , CUTINFO , Nprops ) ;
+      if( tt < LT-1 ) {
+	sink_smear( M.Sf , M.S1 , (t+1)%LT , CUTINFO , Nprops ) ;
       }
       
       #pragma omp single
@@ -135,7 +144,7 @@ baryons_diagonal( struct propagator prop1 ,
 	copy_props( &M , Nprops ) ;
 	
 	// status of the computation
-	progress_bar( t , LT ) ;
+	progress_bar( tt , LT ) ;
       }
     }
   }
@@ -143,7 +152,13 @@ baryons_diagonal( struct propagator prop1 ,
   if( error_code == FAILURE ) goto memfree ;
   
   // write out the baryons wall-local and wall-wall
-  write_momcorr_WW( M , bar_outfile , stride1 , stride2 ) ;
+  // a Cgamma subset only writes the channel pairs it computed
+  uint32_t chan[ B_CHANNELS*B_CHANNELS ] ;
+  if( gamma_channel_list( chan , gammas , ngammas , GLU_TRUE ) == GLU_TRUE ) {
+    write_momcorr_WW_gammas( M , bar_outfile , stride1 , stride2 , chan , NULL ) ;
+  } else {
+    write_momcorr_WW( M , bar_outfile , stride1 , stride2 ) ;
+  }
 
   // memory frees
  memfree :
@@ -19,6 +19,15 @@ contract_baryons( struct propagator *prop ,
 		  const size_t nbaryons )
 {
   fprintf( stdout , "\n[BARYONS] performing %zu contraction(s)\n" , nbaryons ) ;
+
+  // the open Dirac indices are spin projected offline with a projector
+  // that depends on the direction of p, so we can't average the orbit
+  struct cut_info BCUT = CUTINFO ;
+  if( BCUT.momavg == GLU_TRUE ) {
+    fprintf( stdout , "[BARYONS] not averaging momentum orbits of the "
+	     "open Dirac indices\n" ) ;
+    BCUT.momavg = GLU_FALSE ;
+  }
   size_t measurements ;
   // loops measurements and use mesons information to perform contractions
   for( measurements = 0 ; measurements < nbaryons ; measurements++ ) {
@@ -29,14 +38,16 @@ contract_baryons( struct propagator *prop ,
 
     // check origins are the same and plaquettes are the same
     if( sanity_check_props( prop , baryons[ measurements ].map ,
-			    3 , "[BARYONS]" ) == FAILURE ) {
+			    3 , "[BARYONS]" , GLU_FALSE ) == FAILURE ) {
       return FAILURE ;
     }
     
     // big logic block for contracting the right pieces
     if( p1 == p2 && p2 == p3 ) {
       // only have flavour diagonal option at the moment
-      if( baryons_diagonal( prop[ p1 ] , CUTINFO , 
+      if( baryons_diagonal( prop[ p1 ] , BCUT ,
+			    baryons[ measurements ].gammas ,
+			    baryons[ measurements ].ngammas ,
 			    baryons[ measurements ].outfile ) == FAILURE ) {
 	return FAILURE ;
       }
@@ -44,7 +55,9 @@ contract_baryons( struct propagator *prop ,
       if( reread_propheaders( &prop[ p1 ] ) == FAILURE ) { return FAILURE ; }
       // two props are the same S3 ( S1 Cgmu S1 Cgmu )
     } else if( ( p1 == p2 && p2 != p3 ) ) {
-      if( baryons_2fdiagonal( prop[ p1 ] , prop[ p3 ] , CUTINFO , 
+      if( baryons_2fdiagonal( prop[ p1 ] , prop[ p3 ] , BCUT ,
+			      baryons[ measurements ].gammas ,
+			      baryons[ measurements ].ngammas ,
 			      baryons[ measurements ].outfile ) 
 	  == FAILURE ) {
 	return FAILURE ;
@@ -53,7 +66,9 @@ contract_baryons( struct propagator *prop ,
       if( reread_propheaders( &prop[ p3 ] ) == FAILURE ) { return FAILURE ; }
       // two props are the same S2 ( S1 Cgmu S1 Cgmu )
     } else if( p1 == p3 && p3 != p2 ) {
-      if( baryons_2fdiagonal( prop[ p1 ] , prop[ p2 ] , CUTINFO , 
+      if( baryons_2fdiagonal( prop[ p1 ] , prop[ p2 ] , BCUT ,
+			      baryons[ measurements ].gammas ,
+			      baryons[ measurements ].ngammas ,
 			      baryons[ measurements ].outfile ) 
 	  == FAILURE ) {
 	return FAILURE ;
@@ -62,7 +77,9 @@ contract_baryons( struct propagator *prop ,
       if( reread_propheaders( &prop[ p2 ] ) == FAILURE ) { return FAILURE ; }
       // two props are the same S1 ( S2 Cgmu S2 Cgmu )
     } else if( p2 == p3 && p1 != p2 ) {
-      if( baryons_2fdiagonal( prop[ p2 ] , prop[ p1 ] , CUTINFO , 
+      if( baryons_2fdiagonal( prop[ p2 ] , prop[ p1 ] , BCUT ,
+			      baryons[ measurements ].gammas ,
+			      baryons[ measurements ].ngammas ,
 			      baryons[ measurements ].outfile ) 
 	  == FAILURE ) {
 	return FAILURE ;
@@ -72,7 +89,10 @@ contract_baryons( struct propagator *prop ,
       // otherwise we resort to the 3-component baryon
     } else {
       if( baryons_3fdiagonal( prop[ p1 ] , prop[ p2 ] , prop[ p3 ] ,
-			      CUTINFO , baryons[ measurements ].outfile ) 
+			      BCUT ,
+			      baryons[ measurements ].gammas ,
+			      baryons[ measurements ].ngammas ,
+			      baryons[ measurements ].outfile ) 
 	  == FAILURE ) {
 	return FAILURE ;
       }
@@ -4,9 +4,10 @@
  */
 #include "common.h"
 
-#include "basis_conversions.h"    // nrel_rotate_slice()
+#include "basis_conversions.h"    // rotate_offdiag()
 #include "correlators.h"          // allocate_corrs() && free_corrs()
-#include "diquark_contraction.h"  // diquark()
+#include "diquark.h"              // diquark_offdiag()
+#include "diquark_contraction.h"  // diquark_batch()
 #include "gammas.h"               // make_gammas() && gamma_mmul*
 #include "io.h"                   // for read_prop()
 #include "progress_bar.h"         // progress_bar()
@@ -15,18 +16,19 @@
 #include "setup.h"                // compute_correlator() ..
 #include "spinor_ops.h"           // sumprop()
 
-// number of propagators for this code
-#define Nprops (2)
-
+// the time loop shared by the degenerate and non-degenerate diquarks,
+// Nprops is 1 or 2 and the second quark is the last of prop
 int
-diquark_offdiag( struct propagator prop1 ,
-		 struct propagator prop2 ,
-		 const struct cut_info CUTINFO , 
-		 const char *outfile )
+diquark_time_loop( struct propagator *prop ,
+		   const size_t Nprops ,
+		   const struct cut_info CUTINFO ,
+		   const size_t *gammas ,
+		   const size_t ngammas ,
+		   const char *outfile )
 {
   // counters
-  const size_t stride1 = NSNS ;
-  const size_t stride2 = NSNS ;
+  const size_t stride1 = ngammas ;
+  const size_t stride2 = ngammas ;
 
   // flat dirac indices are all colors and all single gamma combinations
   const size_t flat_dirac = stride1 * stride2 ;
@@ -35,15 +37,19 @@ diquark_offdiag( struct propagator prop1 ,
   int error_code = SUCCESS ;
 
   // loop counters
-  size_t i , t = 0 , site ;
+  size_t i ;
 
   // gamma LUT
   struct gamma *Cgmu = malloc( stride1 * sizeof( struct gamma ) ) ;
   struct gamma *Cgnu = malloc( stride1 * sizeof( struct gamma ) ) ;
 
+  // the degenerate case only has the one prop
+  const int sign[ 2 ] = { Nprops == 1 ? +2 : +1 , +1 } ;
+
+  // index of the second quark's prop
+  const size_t q2 = Nprops - 1 ;
+
   // initialise our measurement struct
-  struct propagator prop[ Nprops ] = { prop1 , prop2 } ;
-  const int sign[ Nprops ] = { +1 , +1 } ;
   struct measurements M ;
   if( init_measurements( &M , prop , Nprops , CUTINFO ,
 			 stride1 , stride2 , flat_dirac , sign ) == FAILURE ) {
@@ -53,97 +59,116 @@ diquark_offdiag( struct propagator prop1 ,
 
   // precompute the gammas we use
   for( i = 0 ; i < stride1 ; i++ ) {
-    Cgmu[ i ] = CGmu( M.GAMMAS[ i ] , M.GAMMAS ) ;
+    Cgmu[ i ] = CGmu( M.GAMMAS[ gammas[ i ] ] , M.GAMMAS ) ;
     Cgnu[ i ] = gt_Gdag_gt( Cgmu[i] , M.GAMMAS[ GAMMA_T ] ) ;
   }
 
-  // read in the first timeslice
-  // read in the files
+  // open the parallel region
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
 #pragma omp parallel
   {
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    // loop counters
+    size_t tt = 0 , site ;
+
+    // initial read of a timeslice
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
     // smear it if we wish
-    sink_smear( M.S , M.S1 , t , CUTINFO , Nprops ) ;
-  }
-  if( error_code == FAILURE ) {
-    goto memfree ;
-  }
+    sink_smear( M.S , M.S1 , tstart , CUTINFO , Nprops ) ;
 
-  // Time slice loop 
-  for( t = 0 ; t < LT ; t++ ) {
+    {
+       #pragma omp barrier
+    }
 
-    // if we are doing nonrel-chiral mesons we switch chiral to nrel
-    rotate_offdiag( M.S , prop , Nprops ) ;
+    // Time slice loop 
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
 
-    // compute wall sum
-    sumwalls( M.SUM , (const struct spinor**)M.S , Nprops ) ;
+      // if we are doing nonrel-chiral mesons we switch chiral to nrel
+      rotate_offdiag( M.S , prop , Nprops ) ;
 
-    // assumes all sources are at the same origin, checked in wrap_tetras
-    const size_t tshifted = ( t - prop1.origin[ND-1] + LT ) % LT ; 
+      // compute wall sum
+      #pragma omp single nowait
+      {
+	sumwalls( M.SUM , (const struct spinor**)M.S , Nprops ) ;
+      }
+
+      // assumes all sources are at the same origin, checked in wrap_tetras
+      const size_t tshifted = ( t - prop[0].origin[ND-1] + LT ) % LT ; 
 
-    // strange memory access pattern threads better than what was here before
-    #pragma omp parallel
-    {
       // read on the master and one slave
-      if( t < LT-1 ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
+
+      // spatial sums by FFT convolution if that is cheaper
+      sum_spatial_conv( &M ) ;
+
       // Loop over spatial volume threads better
       #pragma omp for private(site) schedule(dynamic)
       for( site = 0 ; site < LCU ; site++ ) {
 
-	struct spinor SUM_r2[ Nprops ] ;
+	struct spinor SUM_r2[ 2 ] ;
 	sum_spatial_sep( SUM_r2 , M , site ) ;
 
-	// loop gammas
+	// all the channels in one go
+	double complex res[ M_CHANNELS*M_CHANNELS ] ;
+	diquark_batch( res , SUM_r2[0] , SUM_r2[q2] , Cgmu , Cgnu , stride1 ) ;
+
+	size_t GSGK ;
+	for( GSGK = 0 ; GSGK < stride1 * stride2 ; GSGK++ ) {
+	  M.in[ GSGK ][ site ] = res[ GSGK ] ;
+	}
+      }
+      // wall-wall contractions
+      #pragma omp single
+      {
+	double complex res[ M_CHANNELS*M_CHANNELS ] ;
+	diquark_batch( res , M.SUM[0] , M.SUM[q2] , Cgmu , Cgnu , stride1 ) ;
+
 	size_t GSGK ;
 	for( GSGK = 0 ; GSGK < stride1 * stride2 ; GSGK++ ) {
 	  // separate the gamma combinations
 	  const size_t GSRC = GSGK / stride1 ;
 	  const size_t GSNK = GSGK % stride2 ;
-	  // perform contraction, result in result
-	  M.in[ GSNK + stride2*GSRC ][ site ] = 
-	    diquark( SUM_r2[0] , SUM_r2[1] , Cgmu[ GSRC ] , Cgnu[ GSNK ] ) ;
+	  M.wwcorr[ GSRC ][ GSNK ].mom[0].C[ tshifted ] = res[ GSGK ] ;
 	}
       }
-      // wall-wall contractions
-      size_t GSGK ;
-      for( GSGK = 0 ; GSGK < stride1 * stride2 ; GSGK++ ) {
-	// separate the gamma combinations
-	const size_t GSRC = GSGK / stride1 ;
-	const size_t GSNK = GSGK % stride2 ;
-	M.wwcorr[ GSRC ][ GSNK ].mom[0].C[ tshifted ] = 
-	  diquark( M.SUM[0] , M.SUM[1] , Cgmu[ GSRC ] , Cgnu[ GSNK ] ) ;
-      }
       // end of walls
-    }
 
-    // compute the contracted correlator
-    compute_correlator( &M , stride1 , stride2 , tshifted ) ;
+      // compute the contracted correlator
+      compute_correlator( &M , stride1 , stride2 , tshifted ) ;
 
-    // if we error we leave
-    if( error_code == FAILURE ) {
-      goto memfree ;
-    }
-
-    #pragma omp parallel
-    {
       // smear the forward prop
-      if( t < (LT-1) ) {
-	sink_smear( M.Sf , M.S1 , t+1 , CUTINFO , Nprops ) ;
+      if( tt < LT-1 ) {
+	sink_smear( M.Sf , M.S1 , (t+1)%LT , CUTINFO , Nprops ) ;
       }
-    }
 
-    // copy over the propagators
-    copy_props( &M , Nprops ) ;
- 
-    // status of the computation
-    progress_bar( t , LT ) ;
+      #pragma omp single
+      {
+	// copy Sf into S
+	copy_props( &M , Nprops ) ;
+
+	// status of the computation
+	progress_bar( tt , LT ) ;
+      }
+    }
   }
 
+  // skip writing files if we fucked up
+  if( error_code == FAILURE ) goto memfree ;
+
   // write out the diquarks
-  write_momcorr_WW( M , outfile , stride1 , stride2 ) ;
+  // a gamma subset only writes the channels it computed
+  uint32_t chan[ M_CHANNELS ] ;
+  if( gamma_channel_list( chan , gammas , ngammas , GLU_FALSE ) == GLU_TRUE ) {
+    write_momcorr_WW_gammas( M , outfile , stride1 , stride2 , chan , chan ) ;
+  } else {
+    write_momcorr_WW( M , outfile , stride1 , stride2 ) ;
+  }
   
   // failure sink
  memfree :
@@ -157,5 +182,15 @@ diquark_offdiag( struct propagator prop1 ,
   return error_code ;
 }
 
-// clean up the number of propagators
-#undef Nprops
+// non-degenerate diquarks
+int
+diquark_offdiag( struct propagator prop1 ,
+		 struct propagator prop2 ,
+		 const struct cut_info CUTINFO ,
+		 const size_t *gammas ,
+		 const size_t ngammas ,
+		 const char *outfile )
+{
+  struct propagator prop[ 2 ] = { prop1 , prop2 } ;
+  return diquark_time_loop( prop , 2 , CUTINFO , gammas , ngammas , outfile ) ;
+}
@@ -6,7 +6,7 @@
 
 #include "contractions.h"
 #include "gammas.h"
-#include "matrix_ops.h"
+#include "matrix_ops.h"       // colortrace_prod()
 #include "spinmatrix_ops.h"
 #include "spinor_ops.h"
 
@@ -44,3 +44,96 @@ diquark( const struct spinor S1 ,
 
   return -sum ;
 }
+
+// every channel of diquark() at once. The colour traces, the gamma
+// multiplies and the colour-contracted spin products
+// T[ d1 ][ i ][ d2 ][ j ] = Tr_C( S1^T_{d1 d2} S2_{j i} ) do
+// not care which pair of gammas they go into so they are done once
+void
+diquark_batch( double complex *res ,
+	       const struct spinor S1 ,
+	       const struct spinor S2 ,
+	       const struct gamma *C_GSRC ,
+	       const struct gamma *C_GSNK ,
+	       const size_t ngammas )
+{
+  const struct spinor ST = transpose_spinor( S1 ) ;
+
+  double complex D1[ NSNS ] __attribute__((aligned(ALIGNMENT))) ;
+  double complex D2[ NSNS ] __attribute__((aligned(ALIGNMENT))) ;
+
+  // trace out the color indices into spinmatrices
+  colortrace_spinor( D1 , &ST ) ;
+  colortrace_spinor( D2 , &S2 ) ;
+
+  // multiply on the right with each of the gammas
+  double complex D1G[ M_CHANNELS ][ NSNS ] __attribute__((aligned(ALIGNMENT))) ;
+  double complex D2G[ M_CHANNELS ][ NSNS ] __attribute__((aligned(ALIGNMENT))) ;
+
+  // the spin index pairs any of the channels look at
+  uint8_t src[ NS ][ NS ] = { { 0 } } , snk[ NS ][ NS ] = { { 0 } } ;
+
+  size_t g , i , j ;
+  for( g = 0 ; g < ngammas ; g++ ) {
+    memcpy( D1G[g] , D1 , NSNS*sizeof( double complex ) ) ;
+    memcpy( D2G[g] , D2 , NSNS*sizeof( double complex ) ) ;
+    spinmatrix_gamma( D1G[g] , C_GSRC[g] ) ;
+    spinmatrix_gamma( D2G[g] , C_GSNK[g] ) ;
+    for( i = 0 ; i < NS ; i++ ) {
+      src[ C_GSRC[g].ig[i] ][ i ] = 1 ;
+      snk[ C_GSNK[g].ig[i] ][ i ] = 1 ;
+    }
+  }
+
+  // colour contracted products, only the ones we need
+  double complex T[ NS ][ NS ][ NS ][ NS ] __attribute__((aligned(ALIGNMENT))) ;
+  size_t d1 , d2 ;
+  for( d1 = 0 ; d1 < NS ; d1++ ) {
+    for( i = 0 ; i < NS ; i++ ) {
+      if( snk[ d1 ][ i ] == 0 ) continue ;
+      for( d2 = 0 ; d2 < NS ; d2++ ) {
+	for( j = 0 ; j < NS ; j++ ) {
+	  if( src[ d2 ][ j ] == 0 ) continue ;
+          #ifdef HAVE_EMMINTRIN_H
+	  _mm_store_pd( (void*)&T[ d1 ][ i ][ d2 ][ j ] ,
+			colortrace_prod( (const __m128d*)ST.D[d1][d2].C ,
+					 (const __m128d*)S2.D[j][i].C ) ) ;
+          #else
+	  T[ d1 ][ i ][ d2 ][ j ] =
+	    colortrace_prod( (const double complex*)ST.D[d1][d2].C ,
+			     (const double complex*)S2.D[j][i].C ) ;
+          #endif
+	}
+      }
+    }
+  }
+
+  size_t GSRC , GSNK ;
+  for( GSRC = 0 ; GSRC < ngammas ; GSRC++ ) {
+    const struct gamma Cs = C_GSRC[ GSRC ] ;
+    for( GSNK = 0 ; GSNK < ngammas ; GSNK++ ) {
+      const struct gamma Cn = C_GSNK[ GSNK ] ;
+
+      // the Tr_S( P_ab C_GSRC C_ba C_GSNK ) part
+      register double gsumr = 0.0 , gsumi = 0.0 ;
+      for( j = 0 ; j < NS ; j++ ) {
+	d2 = Cs.ig[ j ] ;
+	for( i = 0 ; i < NS ; i++ ) {
+	  const double complex t = T[ Cn.ig[ i ] ][ i ][ d2 ][ j ] ;
+	  // switch for the phases -> implicit minus sign as in
+	  // simple_meson_contract()
+	  switch( ( Cn.g[ i ] + Cs.g[ d2 ] ) & 3 ) {
+	  case 0 : gsumr += -creal( t ) ; gsumi += -cimag( t ) ; break ;
+	  case 1 : gsumr +=  cimag( t ) ; gsumi += -creal( t ) ; break ;
+	  case 2 : gsumr +=  creal( t ) ; gsumi +=  cimag( t ) ; break ;
+	  case 3 : gsumr += -cimag( t ) ; gsumi +=  creal( t ) ; break ;
+	  }
+	}
+      }
+      res[ GSNK + ngammas*GSRC ] =
+	-( trace_prod_spinmatrices( D1G[ GSRC ] , D2G[ GSNK ] ) +
+	   gsumr + I * gsumi ) ;
+    }
+  }
+  return ;
+}
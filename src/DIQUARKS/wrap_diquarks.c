@@ -28,18 +28,22 @@ contract_diquarks( struct propagator *prop ,
 
     // check origins are the same and plaquettes are the same
     if( sanity_check_props( prop , diquarks[ measurements ].map ,
-			    2 , "[DIQUARKS]" ) == FAILURE ) {
+			    2 , "[DIQUARKS]" , GLU_FALSE ) == FAILURE ) {
       return FAILURE ;
     }
     if( p1 == p2 ) {
-      if( diquark_degen( prop[ p1 ] , CUTINFO , 
+      if( diquark_degen( prop[ p1 ] , CUTINFO ,
+			 diquarks[ measurements ].gammas ,
+			 diquarks[ measurements ].ngammas ,
 			 diquarks[ measurements ].outfile
 			 ) == FAILURE ) {
 	return FAILURE ;
       }
       if( reread_propheaders( &prop[ p1 ] ) == FAILURE ) { return FAILURE ; }
     } else {
-      if( diquark_offdiag( prop[ p1 ] , prop[ p2 ] , CUTINFO , 
+      if( diquark_offdiag( prop[ p1 ] , prop[ p2 ] , CUTINFO ,
+			   diquarks[ measurements ].gammas ,
+			   diquarks[ measurements ].ngammas ,
 			   diquarks[ measurements ].outfile ) == FAILURE ) {
 	return FAILURE ;
       }
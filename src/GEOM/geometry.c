@@ -340,6 +340,44 @@ gen_shift( const size_t i ,
   return gen_site( x ) ; 
 }
 
+// lists the sites of a timeslice tile by tile, the tiles are
+// cubes of edge "tile" cut short at the edges of the lattice
+void
+tiled_sites( size_t *order ,
+	     const size_t tile )
+{
+  size_t x0[ ND-1 ] , x[ ND-1 ] , mu , k = 0 ;
+  for( mu = 0 ; mu < ND-1 ; mu++ ) {
+    x0[ mu ] = 0 ;
+  }
+  // loop the tile origins lexicographically
+  while( x0[ ND-2 ] < Latt.dims[ ND-2 ] ) {
+    for( mu = 0 ; mu < ND-1 ; mu++ ) {
+      x[ mu ] = x0[ mu ] ;
+    }
+    // and the sites within a tile
+    while( x[ ND-2 ] < x0[ ND-2 ] + tile && x[ ND-2 ] < Latt.dims[ ND-2 ] ) {
+      int n[ ND ] = { 0 } ;
+      for( mu = 0 ; mu < ND-1 ; mu++ ) {
+	n[ mu ] = (int)x[ mu ] ;
+      }
+      order[ k++ ] = gen_site( n ) ;
+      for( mu = 0 ; mu < ND-1 ; mu++ ) {
+	x[ mu ]++ ;
+	if( mu == ND-2 || ( x[ mu ] < x0[ mu ] + tile &&
+			    x[ mu ] < Latt.dims[ mu ] ) ) break ;
+	x[ mu ] = x0[ mu ] ;
+      }
+    }
+    for( mu = 0 ; mu < ND-1 ; mu++ ) {
+      x0[ mu ] += tile ;
+      if( mu == ND-2 || x0[ mu ] < Latt.dims[ mu ] ) break ;
+      x0[ mu ] = 0 ;
+    }
+  }
+  return ;
+}
+
 // initialises the navigation for our lattice fields
 void 
 init_navig( struct site *__restrict lat )
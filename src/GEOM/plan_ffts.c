@@ -188,6 +188,35 @@ small_create_plans_DFT( fftw_plan *__restrict forward ,
   return ;
 }
 
+// plans acting on a single component of an array of structs, we don't
+// plan harder than FFTW_ESTIMATE as this would overwrite the data
+void
+create_plans_strided( fftw_plan *forward , 
+		      fftw_plan *backward ,
+		      double complex *in , 
+		      double complex *out ,
+		      const size_t stride ,
+		      const size_t DIR )
+{
+  int dimes[ DIR ] , mu , Vol = 1 ;
+  // swap these defs around
+  for( mu = 0 ; mu < (int)DIR ; mu++ ) {
+    dimes[ mu ] = Latt.dims[ DIR - 1 - mu ] ;
+    Vol *= dimes[ mu ] ;
+  }
+  *forward = fftw_plan_many_dft( DIR , dimes , 1 , 
+				 in , NULL , stride , Vol ,
+				 out , NULL , stride , Vol ,
+				 FFTW_FORWARD , 
+				 FFTW_ESTIMATE | FFTW_UNALIGNED ) ;
+  *backward = fftw_plan_many_dft( DIR , dimes , 1 , 
+				  out , NULL , stride , Vol ,
+				  out , NULL , stride , Vol ,
+				  FFTW_BACKWARD , 
+				  FFTW_ESTIMATE | FFTW_UNALIGNED ) ;
+  return ;
+}
+
 // and clean this up
 #ifdef GLU_PLAN
   #undef GLU_PLAN
@@ -6,20 +6,33 @@
 #define HAL_RHORHO_H
 
 /**
-   @fn int HALrhorho_contract( double complex *in , double complex *out , fftw_plan forward , fftw_plan backward , struct spinmatrix **blk11 , struct spinmatrix **blk12 , struct spinmatrix **blk21 , struct spinmatrix **blk22 , const struct spinor *S , const struct gamma *GAMMAS , const size_t GSRC , const size_t GSNK )
+   @fn int HALrhorho_halfblocks( double complex *in , double complex *out , fftw_plan forward , fftw_plan backward , struct spinmatrix **Lf , struct spinmatrix **Lb , const struct spinor *S , const struct gamma *CG , const size_t nG )
+   @brief computes the sink-gamma independent half blocks of a timeslice for each of the nG left gammas CG
+   Lf and Lb point to nG*NCNC*NCNC spinmatrices at each of the LCU sites, with FFTW they are left forward and backward transformed
+ */
+int
+HALrhorho_halfblocks( double complex *in ,
+		      double complex *out ,
+		      fftw_plan forward ,
+		      fftw_plan backward ,
+		      struct spinmatrix **Lf ,
+		      struct spinmatrix **Lb ,
+		      const struct spinor *S ,
+		      const struct gamma *CG ,
+		      const size_t nG ) ;
+
+/**
+   @fn int HALrhorho_contract( double complex *in , double complex *out , fftw_plan backward , const struct spinmatrix **Lf , const struct spinmatrix **Lb , const struct gamma *tCGt , const size_t GSRC , const size_t GSNK , const int nmom[1] , const struct veclist *list )
    @brief do the HAL thing for baryons
+   @warning Lf and Lb must hold this timeslice's HALrhorho_halfblocks(), any number of gamma pairs can then be contracted from them
  */
 int
 HALrhorho_contract( double complex *in ,
 		    double complex *out ,
-		    fftw_plan forward ,
 		    fftw_plan backward ,
-		    struct spinmatrix **blk11 ,
-		    struct spinmatrix **blk12 ,
-		    struct spinmatrix **blk21 ,
-		    struct spinmatrix **blk22 ,
-		    const struct spinor *S ,
-		    const struct gamma *GAMMAS ,
+		    const struct spinmatrix **Lf ,
+		    const struct spinmatrix **Lb ,
+		    const struct gamma *tCGt ,
 		    const size_t GSRC ,
 		    const size_t GSNK ,
 		    const int nmom[1] ,
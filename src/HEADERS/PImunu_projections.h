@@ -7,7 +7,7 @@
 #define PIMUNU_PROJECTIONS_H
 
 /**
-   @fn void momspace_data( struct PIdata *data , const double **p , const double *psq , const struct veclist *__restrict list , const int *__restrict NMOM , const char *outfile , const current_type current , const vector_axial VA ) 
+   @brief wrapper for momentum-space routines, current is CONSERVED_LOCAL or LOCAL_LOCAL and CL_AND_LL is an error that writes nothing
    @brief wrapper for momentum-space routines
  */
 void
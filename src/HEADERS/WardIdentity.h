@@ -17,6 +17,25 @@ compute_p_psq( double **p ,
 	       const struct veclist *list ,
 	       const size_t NMOM ) ;
 
+/**
+   @fn void WI_mom( double *sum , double *sum2 , const struct PIdata *data , const double *p )
+   @brief adds \f$ |p_\mu \Pi_{\mu\nu}|^2 \f$ to sum and \f$ |\Pi_{\mu\nu} p_\nu|^2 \f$ to sum2 for the data at momentum p
+ */
+void
+WI_mom( double *sum ,
+	double *sum2 ,
+	const struct PIdata *data ,
+	const double *p ) ;
+
+/**
+   @fn void print_WI( const double sum , const double sum2 , const size_t NMOM )
+   @brief print to stdout the normalised momentum space WIs accumulated by WI_mom()
+ */
+void
+print_WI( const double sum ,
+	  const double sum2 ,
+	  const size_t NMOM ) ;
+
 /**
    @fn void compute_WI( const struct PIdata *data , const double **p , const struct veclist *list , const size_t NMOM )
    @brief print to stdout the momentum space WIs
@@ -27,6 +46,16 @@ compute_WI( const struct PIdata *data ,
 	    const struct veclist *list ,
 	    const size_t NMOM) ;
 
+/**
+   @fn void correct_WI_mom( struct PIdata *data , const correction_dir corr_dir , const double *MOM )
+   @brief perform WI correction on the data at the (integer) momentum MOM
+   @warning overwrites data
+ */
+void
+correct_WI_mom( struct PIdata *data ,
+		const correction_dir corr_dir ,
+		const double *MOM ) ;
+
 /**
    @fn void correct_WI( struct PIdata *data , const correction_dir corr_dir , const struct veclist *list , const size_t NMOM )
    @brief perform WI correction on idx
@@ -38,6 +67,16 @@ correct_WI( struct PIdata *data ,
 	    const struct veclist *list ,
 	    const size_t NMOM ) ;
 
+/**
+   @fn double WI_configspace_bwd_slice( const struct PIdata *data , const struct PIdata *prev , const struct site *lat )
+   @brief backward config-space WI violation of the timeslice data, prev holds the timeslice below it
+   @return the unnormalised sum over the LCU sites, inside a parallel region this is the calling thread's share of it
+ */
+double
+WI_configspace_bwd_slice( const struct PIdata *data ,
+			  const struct PIdata *prev ,
+			  const struct site *lat ) ;
+
 /**
    @fn void WI_configspace_bwd( const struct PIdata *data , const struct site *lat )
    @brief configuration space WI test
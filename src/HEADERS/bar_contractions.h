@@ -44,7 +44,7 @@ baryon_contract_site_mom( double complex **in ,
 			  const size_t site ) ;
 
 /**
-   @fn void baryon_contract_walls( struct mcorr **corr , const struct spinor SUM1 , const struct spinor SUM2 , const struct spinor SUM3 , const struct gamma *Cgmu , const struct gamma *Cgnu , const size_t t , const baryon_type btype )
+   @fn void baryon_contract_walls( struct mcorr **corr , const struct spinor SUM1 , const struct spinor SUM2 , const struct spinor SUM3 , const struct gamma *Cgmu , const struct gamma *Cgnu , const size_t ngammas , const size_t t , const baryon_type btype )
    @brief perform the Wall-Wall Baryon contractions
    @warning must be called inside the parallel environment
  */
@@ -55,6 +55,7 @@ baryon_contract_walls( struct mcorr **corr ,
 		       const struct spinor SUM3 ,
 		       const struct gamma *Cgmu ,
 		       const struct gamma *Cgnu ,
+		       const size_t ngammas ,
 		       const size_t t ,
 		       const baryon_type btype ) ;
 
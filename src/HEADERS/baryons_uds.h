@@ -6,7 +6,7 @@
 #define BARYONS_UDS_H
 
 /**
-   @fn int baryons_3fdiagonal( struct propagator prop1 , struct propagator prop2 , struct propagator prop3 , const struct cut_info CUTINFO , const char *outfile )
+   @fn int baryons_3fdiagonal( struct propagator prop1 , struct propagator prop2 , struct propagator prop3 , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
    @brief (3)-flavour diagonal baryon contractions
 
    @return #SUCCESS or #FAILURE
@@ -16,6 +16,8 @@ baryons_3fdiagonal( struct propagator prop1 ,
 		    struct propagator prop2 ,
 		    struct propagator prop3 ,
 		    const struct cut_info CUTINFO ,
+		    const size_t *gammas ,
+		    const size_t ngammas ,
 		    const char *outfile ) ;
 
 #endif
@@ -6,7 +6,7 @@
 #define BARYONS_UUD_H
 
 /**
-   @fn int baryons_2fdiagonal( struct propagator prop1 , struct propagator prop2 , const struct cut_info CUTINFO , const char *outfile )
+   @fn int baryons_2fdiagonal( struct propagator prop1 , struct propagator prop2 , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
    @brief (2)flavour diagonal baryon contractions
 
    @return #SUCCESS or #FAILURE
@@ -15,6 +15,8 @@ int
 baryons_2fdiagonal( struct propagator prop1 ,
 		    struct propagator prop2 ,
 		    const struct cut_info CUTINFO ,
+		    const size_t *gammas ,
+		    const size_t ngammas ,
 		    const char *outfile ) ;
 
 #endif
@@ -6,7 +6,7 @@
 #define BARYONS_UUU_H
 
 /**
-   @fn int baryons_diagonal( struct propagator prop , const struct cut_info CUTINFO , const char *outfile )
+   @fn int baryons_diagonal( struct propagator prop , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
    @brief flavour diagonal baryon contractions
 
    The Baryon interpolating operator is of the form: B = eps_123  q1 *( q2 Cg_23 q3 )
@@ -44,6 +44,8 @@
 int
 baryons_diagonal( struct propagator prop1 ,
 		  const struct cut_info CUTINFO ,
+		  const size_t *gammas ,
+		  const size_t ngammas ,
 		  const char *outfile ) ;
 
 #endif
@@ -16,4 +16,15 @@ cl_diagonal( struct propagator prop ,
 	     const struct cut_info CUTINFO ,
 	     const char *outfile ) ;
 
+/**
+   @fn int cl_ll_diagonal( struct propagator prop , const struct site *lat , const struct cut_info CUTINFO , const char *outfile )
+   @brief flavour diagonal conserved-local and local-local contractions from a single sweep
+   @return #SUCCESS or #FAILURE
+*/
+int
+cl_ll_diagonal( struct propagator prop ,
+		const struct site *lat ,
+		const struct cut_info CUTINFO ,
+		const char *outfile ) ;
+
 #endif
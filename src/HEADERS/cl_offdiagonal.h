@@ -17,4 +17,16 @@ cl_offdiagonal( struct propagator prop1 ,
 		const struct cut_info CUTINFO ,
 		const char *outfile ) ;
 
+/**
+   @fn int cl_ll_offdiagonal( struct propagator prop1 , struct propagator prop2 , const struct site *lat , const struct cut_info CUTINFO , const char *outfile )
+   @brief flavour off-diagonal conserved-local and local-local contractions from a single sweep
+   @return #SUCCESS or #FAILURE
+ */
+int
+cl_ll_offdiagonal( struct propagator prop1 , 
+		   struct propagator prop2 ,
+		   const struct site *lat ,
+		   const struct cut_info CUTINFO ,
+		   const char *outfile ) ;
+
 #endif
@@ -6,13 +6,12 @@
 #define CLOVER_H
 
 /**
-   @fn void compute_clovers( struct NRQCD_fields *F , const struct site *lat , const size_t t , const double U_0 )
-   @brief compute the improved clover fields on timeslice t
+   @fn void compute_clovers( double complex *Fmunu , const struct NRQCD_links *L , const size_t t )
+   @brief compute the improved clover fields and links of timeslice t into the slab Fmunu from the improved links of L, which must hold timeslices t-2 to t+2
  */
 void
-compute_clovers( struct NRQCD_fields *F ,
-		 const struct site *lat ,
-		 const size_t t ,
-		 const double U_0 ) ;
+compute_clovers( double complex *Fmunu ,
+		 const struct NRQCD_links *L ,
+		 const size_t t ) ;
 
 #endif
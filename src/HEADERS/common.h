@@ -56,24 +56,4 @@ extern struct latt_info Latt ;
 // gauge field is global !!
 extern struct site *lat ;
 
-// this is our default filter for the gamma insertions
-#ifdef TWOPOINT_FILTER
-static const uint8_t filter[16][16] = { {1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1} ,
-					{1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1} ,
-					{1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1} ,
-					{1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0} ,
-					{0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0} ,
-					{0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0} ,
-					{0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0} ,
-					{0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0} ,
-					{0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0} ,
-					{0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0} ,
-					{0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0} ,
-					{0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0} ,
-					{0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0} ,
-					{1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1} ,
-					{1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1} ,
-					{1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1} } ;
-#endif
-
 #endif
@@ -6,19 +6,15 @@
 #define CONTRACT_O1O2_H
 
 /**
-   @fn void contract_O1O2( struct spinmatrix *P , const struct spinor U , const struct spinor D , const struct spinor S , const struct spinor B , const struct gamma OP1 , const struct gamma OP2 , const struct gamma *GAMMAS )
+   @fn void contract_O1O2( struct spinmatrix *P , const struct penta_site *PS , const struct spinor D , const struct spinor S , const size_t b1 , const size_t b2 )
    @brief contract the diquarks - Baryon-Meson operators
  */
 void
 contract_O1O2( struct spinmatrix *P ,
-	       double complex **F ,
-	       const struct spinor U ,
+	       const struct penta_site *PS ,
 	       const struct spinor D ,
 	       const struct spinor S ,
-	       const struct spinor B ,
-	       const struct gamma OP1 ,
-	       const struct gamma OP2 ,
-	       const struct gamma *GAMMAS ,
-	       const uint8_t **loc ) ;
+	       const size_t b1 ,
+	       const size_t b2 ) ;
 
 #endif
@@ -16,7 +16,7 @@ allocate_momcorrs( const size_t length1 ,
 
 /**
    @fn int compute_correlator( struct measurements *M , const size_t stride1 , const size_t stride2 , const size_t tshifted )
-   @brief compute the momentum-projected correlation function in @M.corr
+   @brief compute the momentum-projected correlation function in @M.corr, one entry per momentum orbit of @M.olist
  */
 int
 compute_correlator( struct measurements *M , 
@@ -34,6 +34,18 @@ free_momcorrs( struct mcorr **mcorr ,
 	       const size_t length2 ,
 	       const size_t nmom ) ;
 
+/**
+   @fn GLU_bool gamma_channel_list( uint32_t *chan , const size_t *gammas , const size_t ngammas , const GLU_bool pairs )
+   @brief the gamma channel of each entry of a gamma list, for baryons (pairs) the flattened ( GSRC , GSNK ) pair channel GSNK + #NSNS*GSRC of each pair of the list
+   @param chan :: ngammas entries or ngammas*ngammas if pairs
+   @return #GLU_FALSE if the list is the whole gamma basis in order and the usual full file can be written
+ */
+GLU_bool
+gamma_channel_list( uint32_t *chan ,
+		    const size_t *gammas ,
+		    const size_t ngammas ,
+		    const GLU_bool pairs ) ;
+
 /**
    @fn void write_momcorr( const char *outfile , const struct mcorr **corr , const struct veclist *list , const double twist[ ND ] , const size_t NSRC , const size_t NSNK , const int *nmom , const char *type )
    @brief write out the #ND-1 momentum-injected correlator
@@ -58,4 +70,32 @@ write_momcorr_WW( const struct measurements M ,
 		  const size_t NSRC ,
 		  const size_t NSNK ) ;
 
+/**
+   @fn void write_momcorr_gammas( const char *outfile , const struct mcorr **corr , const struct veclist *list , const double twist[ ND ] , const size_t NSRC , const size_t NSNK , const uint32_t *srcg , const uint32_t *snkg , const int *nmom , const char *type )
+   @brief write a compact correlator file, its header lists the gamma channel srcg[ GSRC ] and snkg[ GSNK ] of each row and column. A NULL list is 0,1,.. and if both are NULL this is write_momcorr()
+ */
+void
+write_momcorr_gammas( const char *outfile ,
+		      const struct mcorr **corr ,
+		      const struct veclist *list ,
+		      const double twist[ ND ] ,
+		      const size_t NSRC ,
+		      const size_t NSNK ,
+		      const uint32_t *srcg ,
+		      const uint32_t *snkg ,
+		      const int *nmom , 
+		      const char *type ) ;
+
+/**
+   @fn void write_momcorr_WW_gammas( const struct measurements M , const char *outfile , const size_t NSRC , const size_t NSNK , const uint32_t *srcg , const uint32_t *snkg )
+   @brief write our NSRC x NSNK correlators to @outfile as compact files listing their gamma channels, see write_momcorr_gammas()
+ **/
+void
+write_momcorr_WW_gammas( const struct measurements M ,
+			 const char *outfile ,
+			 const size_t NSRC ,
+			 const size_t NSNK ,
+			 const uint32_t *srcg ,
+			 const uint32_t *snkg ) ;
+
 #endif
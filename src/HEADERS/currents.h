@@ -8,6 +8,7 @@
 /**
    @fn void contract_conserved_local_site( struct PIdata *DATA_AA , struct PIdata *DATA_VV ,  const struct site *lat , const struct spinor *S1 , const struct spinor *S1UP , const struct spinor *S2 , const struct spinor *S2UP , const struct gamma *GAMMAS , const size_t AGMAP[ ND ] , const size_t VGMAP[ ND ] , const size_t x , const size_t t ) 
    @brief conserved-local Wilson current at a single site x + LCU * t
+   DATA_AA and DATA_VV point to timeslice t and are written at x
  */
 void
 contract_conserved_local_site( struct PIdata *DATA_AA ,
@@ -25,8 +26,29 @@ contract_conserved_local_site( struct PIdata *DATA_AA ,
 
 
 /**
-   @fn void contract_local_local( struct PIdata *DATA_AA , struct PIdata *DATA_VV , const struct spinor *S1 , const struct spinor *S2 , const struct gamma *GAMMAS , const size_t AGMAP[ ND ] , const size_t VGMAP[ ND ] , const size_t x , const size_t t ) 
-   @brief local-local vector and axial currents
+   @fn void contract_cl_ll_site( struct PIdata *CL_AA , struct PIdata *CL_VV , struct PIdata *LL_AA , struct PIdata *LL_VV , const struct site *lat , const struct spinor *S1 , const struct spinor *S1UP , const struct spinor *S2 , const struct spinor *S2UP , const struct gamma *GAMMAS , const size_t AGMAP[ ND ] , const size_t VGMAP[ ND ] , const size_t x , const size_t t ) 
+   @brief conserved-local and local-local currents at a single site x + LCU * t
+   the local-local terms reuse the on-site spinors of the conserved-local ones
+ */
+void
+contract_cl_ll_site( struct PIdata *CL_AA ,
+		     struct PIdata *CL_VV ,
+		     struct PIdata *LL_AA ,
+		     struct PIdata *LL_VV ,
+		     const struct site *lat ,
+		     const struct spinor *S1 ,
+		     const struct spinor *S1UP ,
+		     const struct spinor *S2 ,
+		     const struct spinor *S2UP ,
+		     const struct gamma *GAMMAS ,
+		     const size_t AGMAP[ ND ] ,
+		     const size_t VGMAP[ ND ] ,
+		     const size_t x ,
+		     const size_t t ) ;
+
+/**
+   @fn void contract_local_local_site( struct PIdata *DATA_AA , struct PIdata *DATA_VV , const struct spinor *S1 , const struct spinor *S2 , const struct gamma *GAMMAS , const size_t AGMAP[ ND ] , const size_t VGMAP[ ND ] , const size_t x ) 
+   @brief local-local vector and axial currents at site x of the timeslice DATA_AA and DATA_VV point to
 */
 void
 contract_local_local_site( struct PIdata *DATA_AA ,
@@ -36,7 +58,6 @@ contract_local_local_site( struct PIdata *DATA_AA ,
 			   const struct gamma *GAMMAS ,
 			   const size_t AGMAP[ ND ] ,
 			   const size_t VGMAP[ ND ] ,
-			   const size_t x ,
-			   const size_t t ) ;
+			   const size_t x ) ;
 
 #endif
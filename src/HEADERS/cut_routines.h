@@ -88,6 +88,32 @@ wall_mom_veclist( int *list_size ,
 		  const double sum_mom[ ND-1 ] ,
 		  const int DIMS ) ;
 
+/**
+   @fn struct veclist* orbit_veclist( int *norbits , size_t *omap , size_t *ostart , const struct veclist *list , const int nmom , const double twist[ ND ] , const int DIMS )
+   @brief groups list into orbits of the cubic group
+   @param norbits :: number of orbits found
+   @param omap :: list indices ordered by orbit, nmom long
+   @param ostart :: orbit o is omap[ ostart[o] ] to omap[ ostart[o+1]-1 ]
+   @return the first member of each orbit as its representative
+ */
+struct veclist*
+orbit_veclist( int *norbits ,
+	       size_t *omap ,
+	       size_t *ostart ,
+	       const struct veclist *list ,
+	       const int nmom ,
+	       const double twist[ ND ] ,
+	       const int DIMS ) ;
+
+/**
+   @fn struct veclist* sink_mom_veclist( int *list_size , const struct cut_info CUTINFO , const int DIMS )
+   @brief returns the momenta given explicitly by SINK_MOMENTA
+ */
+struct veclist*
+sink_mom_veclist( int *list_size ,
+		  const struct cut_info CUTINFO ,
+		  const int DIMS ) ;
+
 struct veclist*
 DFT_mom_veclist( int *list_size ,
 		 const struct cut_info CUTINFO ,
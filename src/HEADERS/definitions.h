@@ -7,27 +7,17 @@
 
 /**
    @def B_CHANNELS
-   @brief number of baryon channels we look at
+   @brief default number of baryon channels we look at if the
+   input file has no BARYON{idx}_GAMMAS list
  */
-#ifndef B_CHANNELS
-  #define B_CHANNELS (16)
-#endif
-// if it is defined to something silly we guard against that also
-#if (B_CHANNELS < 0) || (B_CHANNELS>16)
-  #define B_CHANNELS (16)
-#endif
+#define B_CHANNELS (NSNS)
 
 /**
    @def M_CHANNELS
-   @brief number of meson channels we look at
+   @brief default number of meson channels we look at if the
+   input file has no MESON{idx}_GAMMAS list
  */
-#ifndef M_CHANNELS
-  #define M_CHANNELS (16)
-#endif
-// if it is defined to something silly we guard against that also
-#if (M_CHANNELS < 0) || (M_CHANNELS>16)
-  #define M_CHANNELS (16)
-#endif
+#define M_CHANNELS (NSNS)
 
 /**
    @def MWC_4096_RNG
@@ -55,6 +45,13 @@
  */
 #define CORR_MAGIC (67678282)
 
+/**
+   @def CORR_GAMMA_MAGIC
+   @brief magic number for correlator files that only hold some gamma
+   channels and list them in the header, the last R of CORR is a G
+ */
+#define CORR_GAMMA_MAGIC (67678271)
+
 /**
    @def FAILURE
    @brief our flag for when shit hits the fan
@@ -89,6 +86,57 @@
   #define T_NRQCD (Latt.dims[ND-1])
 #endif
 
+/**
+   @def FMUNU_LINK
+   @brief offset of the links in the NRQCD clover slab
+   E and B fields come first then the 2-link products used in the
+   derivatives, after this the ND-1 spatial links of the timeslice,
+   the temporal link U_t(x) and the temporal link U_t(x-t)
+ */
+#define FMUNU_LINK ((NS-1)*(NS-2)+2*(ND-1))
+
+/**
+   @def NFMUNU
+   @brief number of colormatrices stored per site for the NRQCD clovers
+ */
+#define NFMUNU (FMUNU_LINK+ND+1)
+
+/**
+   @def FMUNU
+   @brief pointer to colormatrix j at site i of the NRQCD clover slab
+   site-major by default, -DNRQCD_FMUNU_FIELD_MAJOR stores each
+   colormatrix j contiguously over the timeslice
+ */
+#ifdef NRQCD_FMUNU_FIELD_MAJOR
+  #define FMUNU(F,i,j) ( (F) + ( (j)*LCU + (i) )*NCNC )
+#else
+  #define FMUNU(F,i,j) ( (F) + ( (i)*NFMUNU + (j) )*NCNC )
+#endif
+
+/**
+   @def NRQCD_MAX_BATCH
+   @brief maximum number of NRQCD sources evolved together
+ */
+#ifndef NRQCD_MAX_BATCH
+  #define NRQCD_MAX_BATCH (8)
+#endif
+
+/**
+   @def NRQCD_TILE
+   @brief edge length of the spatial tiles the NRQCD sweeps go through
+   a tile of sources, clovers and derivatives should sit in L2
+ */
+#ifndef NRQCD_TILE
+  #define NRQCD_TILE (4)
+#endif
+
+/**
+   @def NRQCD_WINDOW
+   @brief timeslices of improved links a pipelined prop keeps, the
+   improved clovers reach two timeslices either side
+ */
+#define NRQCD_WINDOW (5)
+
 /**
    @def LCU
    @brief spatial volume
@@ -107,6 +155,12 @@
 */
 #define MAX_CONTRACTIONS (64)
 
+/**
+   @def MAX_SINK_MOMENTA
+   @brief maximum number of sink momenta given by SINK_MOMENTA
+*/
+#define MAX_SINK_MOMENTA (64)
+
 /**
    @def MAX_LINE_LENGTH
    @brief maximun NERSC header token length
@@ -141,6 +195,13 @@
   #define ND (4)
 #endif
 
+/**
+   @def SUMR2_CONV
+   @brief sum_spatial_sep() switches to an FFT convolution when there
+   are more than SUMR2_CONV * log2( LCU ) spatial offsets
+ */
+#define SUMR2_CONV (4)
+
 /**
    @def NRQCD_TOL
    @brief tolerance at which we consider NRQCD parameters to be zero
@@ -5,6 +5,46 @@
 #ifndef DIBARYON_CONTRACTIONS_H
 #define DIBARYON_CONTRACTIONS_H
 
+/**
+   @fn void dibaryon_gammas( struct gamma *CG , struct gamma *tCGt , const struct gamma *GAMMAS , const size_t nG )
+   @brief the first nG \f$ C\gamma_g \f$ and their \f$ \gamma_t (C\gamma_g)^\dagger \gamma_t \f$
+ */
+void
+dibaryon_gammas( struct gamma *CG ,
+		 struct gamma *tCGt ,
+		 const struct gamma *GAMMAS ,
+		 const size_t nG ) ;
+
+/**
+   @fn void dibaryon_halfblocks( struct spinmatrix *L , const struct spinor S , const struct gamma *CG , const size_t nG )
+   @brief the half of the diquark blocks that does not see the right gamma, for each of the nG left gammas CG
+   L has nG*NCNC*NCNC entries, gamma-major
+ */
+void
+dibaryon_halfblocks( struct spinmatrix *L ,
+		     const struct spinor S ,
+		     const struct gamma *CG ,
+		     const size_t nG ) ;
+
+/**
+   @fn void dibaryon_blocks( struct spinmatrix *blk , const struct spinmatrix *L , const struct gamma tGt )
+   @brief right multiplies the NCNC*NCNC half blocks L by tGt
+ */
+void
+dibaryon_blocks( struct spinmatrix *blk ,
+		 const struct spinmatrix *L ,
+		 const struct gamma tGt ) ;
+
+/**
+   @fn double complex dibaryon_diagrams( const struct spinmatrix *blk11 , const struct spinmatrix *blk12 , const struct spinmatrix *blk21 , const struct spinmatrix *blk22 )
+   @brief sums the 24 diagrams of the SU(2) dibaryon from its four diquark blocks
+ */
+double complex
+dibaryon_diagrams( const struct spinmatrix *blk11 ,
+		   const struct spinmatrix *blk12 ,
+		   const struct spinmatrix *blk21 ,
+		   const struct spinmatrix *blk22 ) ;
+
 /**
    @fn double complex dibaryon_contract( const struct spinor S1 , const struct spinor S2 , const struct gamma *GAMMAS , const size_t GSRC , const size_t GSNK )
    @brief contract the SU(2) dibaryon
@@ -16,6 +56,26 @@ dibaryon_contract( const struct spinor S1 ,
 		   const size_t GSRC ,
 		   const size_t GSNK ) ;
 
+/**
+   @fn size_t dibaryon_scratch_bytes( const size_t nG )
+   @brief per-thread scratch dibaryon_contract_batch() draws for nG gammas
+ */
+size_t
+dibaryon_scratch_bytes( const size_t nG ) ;
+
+/**
+   @fn int dibaryon_contract_batch( double complex *res , const struct spinor S , const struct gamma *CG , const struct gamma *tCGt , const size_t nG )
+   @brief contracts the SU(2) dibaryon for all nG*nG source and sink gamma pairs of a single propagator
+   res[ GSNK + nG*GSRC ] is dibaryon_contract( S , S , GAMMAS , GSRC , GSNK ) for gammas from dibaryon_gammas()
+   @return #SUCCESS or #FAILURE if the scratch arena is too small
+ */
+int
+dibaryon_contract_batch( double complex *res ,
+			 const struct spinor S ,
+			 const struct gamma *CG ,
+			 const struct gamma *tCGt ,
+			 const size_t nG ) ;
+
 // slower explicit version of the contraction
 #if 0
 double complex
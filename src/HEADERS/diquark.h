@@ -6,13 +6,27 @@
 #define DIQUARK_H
 
 /**
-   @fn int diquark_offdiag( struct propagator S1 , struct propagator S2 , const struct cut_info CUTINFO , const char *outfile )
+   @fn int diquark_time_loop( struct propagator *prop , const size_t Nprops , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
+   @brief the diquark time loop, degenerate if Nprops is 1 otherwise between prop[0] and prop[1]
+ */
+int
+diquark_time_loop( struct propagator *prop ,
+		   const size_t Nprops ,
+		   const struct cut_info CUTINFO ,
+		   const size_t *gammas ,
+		   const size_t ngammas ,
+		   const char *outfile ) ;
+
+/**
+   @fn int diquark_offdiag( struct propagator S1 , struct propagator S2 , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
    @brief non-degenerate diquark contraction
  */
 int
 diquark_offdiag( struct propagator S1 ,
 		 struct propagator S2 ,
 		 const struct cut_info CUTINFO , 
+		 const size_t *gammas ,
+		 const size_t ngammas ,
 		 const char *outfile ) ;
 
 #endif
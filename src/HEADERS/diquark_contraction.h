@@ -15,4 +15,17 @@ diquark( struct spinor S1 ,
 	 const struct gamma C_GSRC , 
 	 const struct gamma C_GSNK ) ;
 
+/**
+   @fn void diquark_batch( double complex *res , const struct spinor S1 , const struct spinor S2 , const struct gamma *C_GSRC , const struct gamma *C_GSNK , const size_t ngammas )
+   @brief contract two diquarks for all ngammas*ngammas channels
+   res[ GSNK + ngammas*GSRC ] is diquark( S1 , S2 , C_GSRC[ GSRC ] , C_GSNK[ GSNK ] ), ngammas can be at most M_CHANNELS
+ */
+void
+diquark_batch( double complex *res ,
+	       const struct spinor S1 ,
+	       const struct spinor S2 ,
+	       const struct gamma *C_GSRC ,
+	       const struct gamma *C_GSNK ,
+	       const size_t ngammas ) ;
+
 #endif
@@ -6,12 +6,14 @@
 #define DIQUARK_DEGEN_H
 
 /**
-   @fn int diquark_degen( struct propagator prop1 , const struct cut_info CUTINFO , const char *outfile )
+   @fn int diquark_degen( struct propagator prop1 , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
    @brief diquark-diquark contraction where the quarks are degenerate
  */
 int
 diquark_degen( struct propagator S1 ,
 	       const struct cut_info CUTINFO , 
+	       const size_t *gammas ,
+	       const size_t ngammas ,
 	       const char *outfile ) ;
 
 #endif
@@ -60,11 +60,12 @@ typedef enum {
 
 /**
    @enum current_type
-   @brief fermionic current type
+   @brief fermionic current type, #CL_AND_LL does both in the same sweep
  */
 typedef enum {
   LOCAL_LOCAL , 
-  CONSERVED_LOCAL } current_type ;
+  CONSERVED_LOCAL ,
+  CL_AND_LL } current_type ;
 
 /**
    @enum endianness
@@ -231,4 +232,17 @@ typedef enum
   { VECTOR , 
     AXIAL } vector_axial ;
 
+/**
+   @enum penta_terms
+   @brief the colour term lists of the pentaquark contractions
+ */
+typedef enum
+  { O1O1_TRTR ,
+    O1O1_TRPROD ,
+    O1O2_PROD ,
+    O2O1_PROD ,
+    O2O3_TR ,
+    O2O3_CROSS ,
+    PENTA_NTERMS } penta_terms ;
+
 #endif
@@ -6,14 +6,48 @@
 #define EVOLVE_H
 
 /**
-   @fn void compute_props( struct propagator *prop , struct NRQCD_fields *F , struct site *lat , const size_t nprops , const double tadref )
-   @brief computes all the NRQCD propagators we will use
+   @fn size_t NRQCD_batch_size( const struct propagator *prop , const size_t nprops )
+   @brief largest number of props evolved together, props in a batch can only differ by their spatial origin and source
+ */
+size_t
+NRQCD_batch_size( const struct propagator *prop ,
+		  const size_t nprops ) ;
+
+/**
+   @fn GLU_bool NRQCD_up_front( const struct propagator p )
+   @brief do we evolve either direction of p before the contractions, pipelined and stored props are not
+ */
+GLU_bool
+NRQCD_up_front( const struct propagator p ) ;
+
+/**
+   @fn size_t NRQCD_link_sweeps( const struct propagator *prop , const size_t nprops , const size_t *nreads , const struct NRQCD_links *L )
+   @brief number of evolutions through the timeslices that read the links L, a pipelined prop n is evolved once for each of the nreads[n] sweeps of the contractions that read it
+ */
+size_t
+NRQCD_link_sweeps( const struct propagator *prop ,
+		   const size_t nprops ,
+		   const size_t *nreads ,
+		   const struct NRQCD_links *L ) ;
+
+/**
+   @fn void compute_props( struct propagator *prop , struct NRQCD_fields *F , const size_t nprops )
+   @brief computes all the NRQCD propagators we will use, F must hold NRQCD_batch_size() sources and the props need their links from init_NRQCD_links()
  */
 void
 compute_props( struct propagator *prop ,
 	       struct NRQCD_fields *F ,
-	       struct site *lat ,
-	       const size_t nprops ,
-	       const double tadref ) ;
+	       const size_t nprops ) ;
+
+/**
+   @fn int NRQCD_pipe_evolve( const struct propagator prop , const size_t t )
+   @brief evolves the hit prop.hit of a pipelined NRQCD prop forward so that prop.pipe -> F.S holds timeslice t
+   A sweep starting at the source (see sweep_start()) costs one evolution of LT steps per hit contracted, the same as evolving it up front. Asking for a timeslice before the current one, or another hit, restarts from the source: a second pipelined prop with a different source in the same contraction, or the conserved-local VPF which always sweeps from t=0, pays up to 2LT-1-t0 steps
+   @warning must be called by every thread of the team, read_ahead() does this
+   @return #SUCCESS or #FAILURE
+ */
+int
+NRQCD_pipe_evolve( const struct propagator prop ,
+		   const size_t t ) ;
 
 #endif
@@ -0,0 +1,49 @@
+/**
+   @file evolve_f.h
+   @brief prototype declarations for the single precision NRQCD evolution between the spin-dependent terms
+
+   All of these work on the single precision temporaries F -> Sf, F -> S1f and F -> Uf and are called from inside a parallel region
+ */
+#ifndef EVOLVE_F_H
+#define EVOLVE_F_H
+
+/**
+   @fn void links_to_split( struct NRQCD_fields *F )
+   @brief copies the spatial and temporal links of F -> Fmunu into F -> Uf
+ */
+void
+links_to_split( struct NRQCD_fields *F ) ;
+
+/**
+   @fn void halfspinors_to_split( struct NRQCD_fields *F )
+   @brief converts the sources F -> S into F -> Sf
+ */
+void
+halfspinors_to_split( struct NRQCD_fields *F ) ;
+
+/**
+   @fn void split_to_halfspinors( struct NRQCD_fields *F )
+   @brief converts F -> Sf back into the sources F -> S
+ */
+void
+split_to_halfspinors( struct NRQCD_fields *F ) ;
+
+/**
+   @fn void evolve_H_f( struct NRQCD_fields *F , const struct NRQCD_params NRQCD )
+   @brief applies the kinetic term NRQCD.N times to F -> Sf, accumulating in NRQCD.ACCUM
+ */
+void
+evolve_H_f( struct NRQCD_fields *F ,
+	    const struct NRQCD_params NRQCD ) ;
+
+/**
+   @fn void temporal_link_f( struct NRQCD_fields *F , const GLU_bool backward , const GLU_bool flip )
+   @brief multiplies F -> Sf by \f$ U_t(x)^\dagger \f$ or by \f$ U_t(x-t) \f$ if backward
+   @param flip :: flips the sign for an antiperiodic boundary
+ */
+void
+temporal_link_f( struct NRQCD_fields *F ,
+		 const GLU_bool backward ,
+		 const GLU_bool flip ) ;
+
+#endif
@@ -223,6 +223,16 @@ TwoPI_mpipi_momconv( int MOM[ ND ] ,
 		     const size_t i , 
 		     const size_t DIR ) ;
 
+/**
+   @fn void tiled_sites( size_t *order , const size_t tile )
+   @brief lists the #LCU site indices of a timeslice tile by tile
+   @param order :: list of sites, of length #LCU
+   @param tile :: edge length of the spatial tiles
+ **/
+void
+tiled_sites( size_t *order ,
+	     const size_t tile ) ;
+
 /**
    @fn void init_navig( struct site *__restrict lat )
    @brief Function for generically initialising the lattice navigation
@@ -74,12 +74,13 @@ halfspinor_sigma_Saxpy( struct halfspinor *H ,
 			const uint8_t imap[ NS ] ) ;
 
 /**
-   @fn void sigmaB_halfspinor( struct halfspinor *S1 , const struct field Fmunu , const struct halfspinor S )
-   @brief computes \sigma.B S
+   @fn void sigmaB_halfspinor( struct halfspinor *S1 , const double complex *Fmunu , const size_t i , const struct halfspinor S )
+   @brief computes \sigma.B S using the B-field of Fmunu at site i
  */
 void
 sigmaB_halfspinor( struct halfspinor *S1 ,
-		   const struct field Fmunu ,
+		   const double complex *Fmunu ,
+		   const size_t i ,
 		   const struct halfspinor S ) ;
 
 /**
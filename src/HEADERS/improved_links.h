@@ -0,0 +1,43 @@
+/**
+   @file improved_links.h
+   @brief prototype declarations for the NRQCD tadpole improved and twisted links
+ */
+#ifndef IMPROVED_LINKS_H
+#define IMPROVED_LINKS_H
+
+/**
+   @fn void NRQCD_clovers( double complex *Fmunu , struct NRQCD_links *L , const size_t t )
+   @brief puts the clovers and links of timeslice t into the slab Fmunu, building the links it needs and reading the clover cache of L if it has one. Call from inside a parallel region
+ */
+void
+NRQCD_clovers( double complex *Fmunu ,
+	       struct NRQCD_links *L ,
+	       const size_t t ) ;
+
+/**
+   @fn int cache_NRQCD_clovers( struct NRQCD_links *L )
+   @brief keeps the clovers of every timeslice of L once they are computed, if there is the memory
+   @return #SUCCESS or #FAILURE if we are not caching
+ */
+int
+cache_NRQCD_clovers( struct NRQCD_links *L ) ;
+
+/**
+   @fn int free_NRQCD_links( struct propagator *prop , const size_t nprops , const GLU_bool keep_pipes )
+   @brief frees the link copies of the props, if keep_pipes is set the ones used by pipelined props are kept
+ */
+int
+free_NRQCD_links( struct propagator *prop ,
+		  const size_t nprops ,
+		  const GLU_bool keep_pipes ) ;
+
+/**
+   @fn int init_NRQCD_links( struct propagator *prop , const size_t nprops )
+   @brief gives every NRQCD prop we evolve an (empty) link copy, shared by props with the same U0 and twist. Pipelined props that share with nothing evolved up front get their own window of NRQCD_WINDOW timeslices instead
+   @return #SUCCESS or #FAILURE
+ */
+int
+init_NRQCD_links( struct propagator *prop ,
+		  const size_t nprops ) ;
+
+#endif
@@ -34,6 +34,20 @@ get_contraction_map( size_t *map ,
 		     const char *token ,
 		     const size_t nprops ) ;
 
+/**
+   @fn int get_gamma_list( size_t *gammas , size_t *ngammas , const char *tag , const size_t ndefault )
+   @brief read the gamma channel list given by tag
+   @param gammas :: gamma indices we will contract
+   @param ngammas :: number of gammas read
+   @param tag :: input file tag e.g. MESON0_GAMMAS
+   @param ndefault :: if tag is missing we use the first ndefault gammas
+ */
+int
+get_gamma_list( size_t *gammas ,
+		size_t *ngammas ,
+		const char *tag ,
+		const size_t ndefault ) ;
+
 /**
    @fn int get_input_data( struct propagator **prop , struct input_info *inputs , const char *file_name )
    @brief set the gauge field header and pass a propagator name for now
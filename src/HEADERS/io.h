@@ -14,9 +14,9 @@ int
 check_checksum( FILE *fprop ) ;
 
 /**
-   @fn int read_ahead( struct propagator *prop , struct spinor *S , int *error_code , const size_t Nprops )
-   @brief read the timeslice above
-   @warning should be called in an OMP parallel region
+   @fn int read_ahead( struct propagator *prop , struct spinor **S , int *error_code , const size_t Nprops , const size_t t )
+   @brief read timeslice t, the pipelined NRQCD props are evolved to t by the whole team first
+   @warning should be called by every thread of an OMP parallel region
  */
 int
 read_ahead( struct propagator *prop ,
@@ -38,4 +38,12 @@ read_prop( struct propagator prop ,
 	   struct spinor *S ,
 	   const size_t t ) ;
 
+/**
+   @fn size_t sweep_start( const struct propagator *prop , const size_t Nprops )
+   @brief timeslice a contraction starts its sweep at, the source of the first pipelined prop or 0
+ */
+size_t
+sweep_start( const struct propagator *prop ,
+	     const size_t Nprops ) ;
+
 #endif
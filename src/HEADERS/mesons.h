@@ -6,12 +6,14 @@
 #define MESONS_H
 
 /**
-   @fn int mesons_diagonal( struct propagator prop , const struct cut_info CUTINFO , const char *outfile )
+   @fn int mesons_diagonal( struct propagator prop , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
    @brief flavour diagonal meson dispersion relation
  */
 int
 mesons_diagonal( struct propagator prop ,
 		 const struct cut_info CUTINFO ,
+		 const size_t *gammas ,
+		 const size_t ngammas ,
 		 const char *outfile ) ;
 
 #endif
@@ -6,13 +6,15 @@
 #define MESONS_OFFDIAG_H
 
 /**
-   @fn int mesons_offdiagonal( struct propagator prop1 , struct propagator prop2 , const struct cut_info CUTINFO , const char *outfile )
+   @fn int mesons_offdiagonal( struct propagator prop1 , struct propagator prop2 , const struct cut_info CUTINFO , const size_t *gammas , const size_t ngammas , const char *outfile )
    @brief flavour off-diagonal meson dispersion relation
  */
 int
 mesons_offdiagonal( struct propagator prop1 ,
 		    struct propagator prop2 ,
 		    const struct cut_info CUTINFO ,
+		    const size_t *gammas ,
+		    const size_t ngammas ,
 		    const char *outfile ) ;
 
 #endif
@@ -7,7 +7,7 @@
 
 /**
    @fn void momspace_PImunu( struct PIdata *AA , struct PIdata *VV , const struct cut_info CUTINFO , const char *outfile , const current_type current )
-   @brief FFTs (if available) the config-space \f$ \Pi_{\mu\nu}(q) \f$
+   @brief FFTs (if available) the config-space \f$ \Pi_{\mu\nu}(x) \f$ and writes the WI corrected projections of the momenta that survive the cut
 
    @warning overwrites the PIdatas with their fourier transform
  */
@@ -6,12 +6,12 @@
 #define NRQCD_H
 
 /**
-   @fn int compute_nrqcd_props( struct propagator *prop , const size_t nprops ) 
-   @brief computes all of the NRQCD propagators we ask for
+   @fn int compute_nrqcd_props( struct propagator *prop , const struct input_info inputs ) 
+   @brief computes all of the NRQCD propagators we ask for, the contraction tables of inputs tell us how often each prop is read
  */
 int
 compute_nrqcd_props( struct propagator *prop ,
-		     const size_t nprops ) ;
+		     const struct input_info inputs ) ;
 
 /**
    @fn int free_nrqcd_props( struct propagator *prop , const size_t nprops )
@@ -124,4 +124,46 @@ U1( const uint32_t thread ) ;
 double complex
 Z2xZ2( const uint32_t thread ) ;
 
+/**
+   @fn int cb_rng_seed( void )
+   @brief makes sure Latt.Seed is set for the counter based generator, reading one from /dev/urandom if it is not
+   @return #SUCCESS or #FAILURE
+ */
+int
+cb_rng_seed( void ) ;
+
+/**
+   @fn uint64_t cb_rng( const uint32_t seed , const size_t site , const size_t hit , const size_t spin , const size_t colour )
+   @brief counter based random number, a hash of its key so it is the same whichever thread makes it and in whatever order
+   @return 64 random bits
+ */
+uint64_t
+cb_rng( const uint32_t seed ,
+	const size_t site ,
+	const size_t hit ,
+	const size_t spin ,
+	const size_t colour ) ;
+
+/**
+   @fn double complex cb_Z2xZ2( const uint64_t r )
+   @brief element of Z4 from the bits of cb_rng()
+   @return { +/- 1 , +/- I }/ sqrt{2}
+ */
+double complex
+cb_Z2xZ2( const uint64_t r ) ;
+
+/**
+   @fn double complex cb_Z3( const uint64_t r )
+   @brief element of Z3 from the bits of cb_rng()
+ */
+double complex
+cb_Z3( const uint64_t r ) ;
+
+/**
+   @fn double complex cb_U1( const uint64_t r )
+   @brief element of U1 from the bits of cb_rng()
+ */
+double complex
+cb_U1( const uint64_t r ) ;
+
 #endif
@@ -0,0 +1,23 @@
+/**
+   @file penta_colors.h
+   @brief prototype declarations for the pentaquark colour term lists
+ */
+#ifndef PENTA_COLORS_H
+#define PENTA_COLORS_H
+
+/**
+   @fn void free_penta_colors( struct penta_colors *PC )
+   @brief frees the term lists
+ */
+void
+free_penta_colors( struct penta_colors *PC ) ;
+
+/**
+   @fn int init_penta_colors( struct penta_colors *PC )
+   @brief collapses the epsilon identities of each contraction into lists of weighted ( left block , right block ) terms
+   @return #SUCCESS or #FAILURE
+ */
+int
+init_penta_colors( struct penta_colors *PC ) ;
+
+#endif
@@ -37,6 +37,24 @@ idx2( const size_t b , const size_t bp ,
   return b + NC * ( bp + NC * ( c + NC * ( cp + NC * ( g + NC * gp ) ) ) ) ;
 }
 
+/**
+   @fn static inline void penta_axpy( struct spinmatrix *X , const double w , const struct spinmatrix *R )
+   @brief X += w * R over the flattened doubles so that it vectorises
+ */
+static inline void
+penta_axpy( struct spinmatrix *X ,
+	    const double w ,
+	    const struct spinmatrix *R )
+{
+  double *x = (double*)X -> D ;
+  const double *r = (const double*)R -> D ;
+  size_t j ;
+  for( j = 0 ; j < 2*NSNS ; j++ ) {
+    x[ j ] += w * r[ j ] ;
+  }
+  return ;
+}
+
 #if (defined __AVX__) && (HAVE_IMMINTRIN_H)
   #include "AVX_OPS.h"
 #else
@@ -115,23 +133,42 @@ spinmatrix_multiply_T_avx( void *a ,
 			   const void *c ) ;
 
 /**
-   @fn int pentas( double complex *result , const struct spinor U , const struct spinor D , const struct spinor S , const struct spinor bwdH , const struct gamma *GAMMAS )
+   @fn void penta_blocks( struct spinmatrix *T , const struct Ospinor *L , const struct Ospinor *R )
+   @brief all NCNC*NCNC products L.C[a][b] * R.C[c][d] of the colour blocks
+ */
+void
+penta_blocks( struct spinmatrix *T ,
+	      const struct Ospinor *L ,
+	      const struct Ospinor *R ) ;
+
+/**
+   @fn void penta_prod_terms( struct spinmatrix *P , const struct spinmatrix *L , const struct spinmatrix *R , const struct penta_term *T , const size_t n )
+   @brief P += sum of w * L[A] * R[B] over the terms, one multiply per left block
+ */
+void
+penta_prod_terms( struct spinmatrix *P ,
+		  const struct spinmatrix *L ,
+		  const struct spinmatrix *R ,
+		  const struct penta_term *T ,
+		  const size_t n ) ;
+
+/**
+   @fn int pentas( double complex *result , const struct spinor U , const struct spinor D , const struct spinor S , const struct spinor bwdH , const struct gamma *GAMMAS , const struct penta_colors *PC )
    @brief pentaquark contraction code for a udusb pentaquark
    @param U :: two of these propagators
    @param D :: one of these
    @param S :: one of these
    @param bwdH :: backward-propagating quark
    @param GAMMAS :: gamma matrices
-   @param loc :: indexing
+   @param PC :: colour term lists from init_penta_colors()
  */
 int
 pentas( double complex *result ,
-	double complex **F ,
 	const struct spinor U ,
 	const struct spinor D , 
 	const struct spinor S ,
 	const struct spinor bwdH ,
 	const struct gamma *GAMMAS ,
-	const uint8_t **loc ) ;
+	const struct penta_colors *PC ) ;
 
 #endif
@@ -85,6 +85,26 @@ small_create_plans_DFT( fftw_plan *__restrict forward ,
 			double complex *__restrict out ,
 			const size_t DIR ) ;
 
+/**
+   @fn void create_plans_strided( fftw_plan *forward , fftw_plan *backward , double complex *in , double complex *out , const size_t stride , const size_t DIR )
+   @brief creates plans transforming one component of an array of structs
+   @param forward :: forward FFT in -> out
+   @param backward :: backward FFT, in place on out
+   @param in :: first component of the struct array going in
+   @param out :: first component of the struct array going out
+   @param stride :: number of complex numbers in each struct
+   @param DIR :: number of dimensions of the transform
+   The plans are unaligned so that they can be applied to every
+   component through fftw_execute_dft() with an offset pointer
+**/
+void
+create_plans_strided( fftw_plan *forward , 
+		      fftw_plan *backward ,
+		      double complex *in , 
+		      double complex *out ,
+		      const size_t stride ,
+		      const size_t DIR ) ;
+
 #endif // HAVE_FFTW_H
 
 #endif
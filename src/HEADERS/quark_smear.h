@@ -17,13 +17,13 @@ sink_smear( struct spinor **S ,
 	    const size_t Np ) ;
 
 /**
-   @fn void source_smear( struct halfspinor *S , struct halfspinor *S1 , const size_t t , const struct source_info Source )
-   @brief perform NRQCD source smearing
+   @fn void source_smear( struct halfspinor *S , struct halfspinor *S1 , const double complex *Fmunu , const struct source_info Source )
+   @brief perform NRQCD source smearing with the links held in the clover slab Fmunu
  */
 void
 source_smear( struct halfspinor *S ,
 	      struct halfspinor *S1 ,
-	      const size_t t ,
+	      const double complex *Fmunu ,
 	      const struct source_info Source ) ;
 
 #endif
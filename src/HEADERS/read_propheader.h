@@ -7,12 +7,13 @@
 #define READ_PROPHEADER_H
 
 /**
-   @fn int read_propheader( struct propagator *prop )
-   @brief read and check a propagator file header
+   @fn int read_propheader( struct propagator *prop , const GLU_bool reread )
+   @brief read and check a propagator file header, the source is only summarised if reread is #GLU_FALSE
    @return #SUCCESS or #FAILURE
  */
 int
-read_propheader( struct propagator *prop ) ;
+read_propheader( struct propagator *prop ,
+		 const GLU_bool reread ) ;
 
 /**
    @fn int read_propheaders( struct propagator *prop , const size_t nprops )
@@ -34,14 +35,16 @@ int
 reread_propheaders( struct propagator *prop ) ;
 
 /**
-   @fn int sanity_check_props( const struct propagator *prop , const size_t *map , const size_t Nmap , const char *label )
+   @fn int sanity_check_props( const struct propagator *prop , const size_t *map , const size_t Nmap , const char *label , const GLU_bool loops_hits )
    @brief perform some sanity checks
+   @param loops_hits whether the contraction loops over the noise hits, if not props with Nhits > 1 are refused
    @return #SUCCESS or #FAILURE
  */
 int
 sanity_check_props( const struct propagator *prop ,
 		    const size_t *map ,
 		    const size_t Nmap ,
-		    const char *label ) ;
+		    const char *label ,
+		    const GLU_bool loops_hits ) ;
 
 #endif
@@ -0,0 +1,61 @@
+/**
+   @file scratch.h
+   @brief prototype declarations for the per-thread scratch arenas
+ */
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+/**
+   @fn size_t scratch_size( const size_t bytes )
+   @brief the arena space a request of bytes takes up, rounded up to a cache line
+ */
+size_t
+scratch_size( const size_t bytes ) ;
+
+/**
+   @fn int scratch_reserve( const size_t bytes )
+   @brief makes sure every thread's arena can hold bytes
+   @warning reallocates the arenas if they are too small, so call it outside of parallel regions and with nothing drawn from them
+   @return #SUCCESS or #FAILURE
+ */
+int
+scratch_reserve( const size_t bytes ) ;
+
+/**
+   @fn int init_scratch( const size_t bytes )
+   @brief allocates and touches an arena of bytes for each of Latt.Nthreads threads
+   @return #SUCCESS or #FAILURE
+ */
+int
+init_scratch( const size_t bytes ) ;
+
+/**
+   @fn void *scratch_get( const size_t bytes )
+   @brief draws bytes from the calling thread's arena
+   @return cache-line aligned memory or NULL if the arena is exhausted
+ */
+void *
+scratch_get( const size_t bytes ) ;
+
+/**
+   @fn size_t scratch_mark( void )
+   @brief how much of the calling thread's arena is in use
+ */
+size_t
+scratch_mark( void ) ;
+
+/**
+   @fn void scratch_release( const size_t mark )
+   @brief hands back everything the calling thread drew since scratch_mark() returned mark
+ */
+void
+scratch_release( const size_t mark ) ;
+
+/**
+   @fn void free_scratch( void )
+   @brief frees the arenas
+ */
+void
+free_scratch( void ) ;
+
+#endif
@@ -39,6 +39,15 @@ init_measurements( struct measurements *M ,
 		   const size_t flat_dirac ,
 		   const int sign[ Nprops ] ) ;
 
+/**
+   @fn void sum_spatial_conv( const struct measurements *M )
+   @brief spatially sum the props in @M.S into @M.Sr2 by FFT convolution
+   Does nothing unless init_measurements() set up the convolution,
+   must be called by all threads in the parallel region
+ */
+void
+sum_spatial_conv( const struct measurements *M ) ;
+
 /**
    @fn struct spinor sum_spatial_sep2( struct spinor *SUM_r2 , const struct measurements M , const size_t site1 )
    @brief spatially sum a propagator up to a maximum r^2 in the SUM_r2 array
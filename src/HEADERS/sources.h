@@ -6,13 +6,15 @@
 #define SOURCES_H
 
 /**
-   @fn int initialise_source( struct halfspinor *S , struct halfspinor *S1 , const struct propagator prop )
-   @brief initialise a source into S
+   @fn int initialise_source( struct halfspinor *S , struct halfspinor *S1 , const double complex *Fmunu , const struct propagator prop , const size_t hit )
+   @brief initialise a source into S, Fmunu must hold the links of the source timeslice. Noise sources are drawn from cb_rng() for this hit
    @return #SUCCESS or #FAILURE
  */
 int
 initialise_source( struct halfspinor *S ,
 		   struct halfspinor *S1 ,
-		   const struct propagator prop ) ;
+		   const double complex *Fmunu ,
+		   const struct propagator prop ,
+		   const size_t hit ) ;
 
 #endif
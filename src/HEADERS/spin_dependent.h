@@ -6,61 +6,73 @@
 #define SPIN_DEPENDENT_H
 
 /**
-   @fn void term_C3( struct halfspinor *H , const struct halfspinor *S , const struct field *Fmunu , const size_t i , const size_t t , const struct NRQCD_params NRQCD )
-   @brief c_3 term of NRQCD Hamiltonian evaluated at site "i" on timeslice "t"
+   @fn void sigma_gradxE( struct halfspinor *H , const double complex *Fmunu , const struct halfspinor *S , const struct NRQCD_derivs *D , const double U_0 , const size_t i )
+   @brief computes \f$ \sigma\cdot\left( \tilde\Delta\times\tilde{E} - \tilde{E}\times\tilde\Delta \right) S $\f at site "i", using the cached gradients of S in D if it is not NULL
+ */
+void
+sigma_gradxE( struct halfspinor *H , 
+	      const double complex *Fmunu ,
+	      const struct halfspinor *S ,
+	      const struct NRQCD_derivs *D ,
+	      const double U_0 ,
+	      const size_t i ) ;
+
+/**
+   @fn void term_C3( struct halfspinor *H , const struct halfspinor *S , const struct NRQCD_derivs *D , const double complex *Fmunu , const size_t i , const struct NRQCD_params NRQCD )
+   @brief c_3 term of NRQCD Hamiltonian evaluated at site "i"
 
    Computes \f$ -\frac{c_3}{2(2M_0)^2}\sigma\cdot\left( \tilde\Delta\times\tilde{E} - \tilde{E}\times\tilde\Delta \right)$\f where the tilde's mean O(a^2) improvement
  */
 void
 term_C3( struct halfspinor *H ,
 	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const struct NRQCD_derivs *D ,
+	 const double complex *Fmunu ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD ) ;
 
 /**
-   @fn void term_C4( struct halfspinor *H , const struct halfspinor *S , const struct field *Fmunu , const size_t i , const size_t t , const struct NRQCD_params NRQCD )
-   @brief c_4 term of NRQCD hamiltonian evaluated at site "i" on timeslice "t"
+   @fn void term_C4( struct halfspinor *H , const struct NRQCD_derivs *D , const size_t i , const struct NRQCD_params NRQCD )
+   @brief c_4 term of NRQCD hamiltonian evaluated at site "i"
 
    Computes \f$ -\frac{c_4}{2M_0}\sigma\cdot \tilde{B} $\f where the tilde implies O(a^2) improvement
  */
 void
 term_C4( struct halfspinor *H ,
-	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const struct NRQCD_derivs *D ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD ) ;
 
 /**
-   @fn void term_C7( struct halfspinor *H , const struct halfspinor *S , const struct field *Fmunu , const size_t i , const size_t t , const struct NRQCD_params NRQCD )
-   @brief c_7 term of NRQCD hamiltonian evaluated at site "i" on timeslice "t"
+   @fn void term_C7( struct halfspinor *H , const struct NRQCD_derivs *D , const double complex *Fmunu , const size_t i , const struct NRQCD_params NRQCD )
+   @brief c_7 term of NRQCD hamiltonian evaluated at site "i"
 
    Computes \f$ -\frac{c_7}{(2M_0)^3}\left\{ \tilde\Delta^{(2)} , \sigma\cdot \tilde{B} \right\} $\f where the tilde implies O(a^2) improvement
  */
 void
 term_C7( struct halfspinor *H ,
-	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const struct NRQCD_derivs *D ,
+	 const double complex *Fmunu ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD ) ;
 
 /**
-   @fn void term_C8( struct NRQCD_fields *F , const size_t t , const struct NRQCD_params NRQCD )
-   @brief c_8 term of NRQCD hamiltonian evaluated for sites on timeslice "t"
+   @fn void term_C8( struct halfspinor *H , const struct halfspinor *X , const struct NRQCD_derivs *D , const double complex *Fmunu , const size_t i , const struct NRQCD_params NRQCD )
+   @brief c_8 term of NRQCD hamiltonian evaluated at site "i", X is the field sigma_gradxE() of S over the timeslice
 
    Computes \f$ -\frac{c_8}{4(2M_0)^4}\left\{ \tilde\Delta^{(2)} , \sigma\cdot\left( \tilde\Delta\times\tilde{E} - \tilde{E}\times\tilde\Delta \right) \right\}$\f where the tilde implies O(a^2) improvement
  */
 void
-term_C8( struct NRQCD_fields *F ,
-	 const size_t t ,
+term_C8( struct halfspinor *H ,
+	 const struct halfspinor *X ,
+	 const struct NRQCD_derivs *D ,
+	 const double complex *Fmunu ,
+	 const size_t i ,
 	 const struct NRQCD_params NRQCD ) ;
 
 /**
-   @fn void term_C9EB( struct halfspinor *H , const struct halfspinor *S , const struct field *Fmunu , const size_t i , const size_t t , const struct NRQCD_params NRQCD )
-   @brief c_9 term of NRQCD hamiltonian evaluated at site "i" on timeslice "t"
+   @fn void term_C9EB( struct halfspinor *H , const struct halfspinor *S , const double complex *Fmunu , const size_t i , const struct NRQCD_params NRQCD )
+   @brief c_9 term of NRQCD hamiltonian evaluated at site "i"
 
    Computes \f$ -\frac{c_9}{(2M_0)^3}\sigma\cdot\left( \tilde{E}\times\tilde{E} + \tilde{B}\times\tilde{B} \right)$\f where the tilde implies O(a^2) improvement
 
@@ -69,9 +81,8 @@ term_C8( struct NRQCD_fields *F ,
 void
 term_C9EB( struct halfspinor *H ,
 	   const struct halfspinor *S ,
-	   const struct field *Fmunu ,
+	   const double complex *Fmunu ,
 	   const size_t i ,
-	   const size_t t ,
 	   const struct NRQCD_params NRQCD ) ;
 
 #endif
@@ -0,0 +1,26 @@
+/**
+   @file stored_props.h
+   @brief prototype declarations for writing NRQCD props to disk and reading them back
+ */
+#ifndef STORED_PROPS_H
+#define STORED_PROPS_H
+
+/**
+   @fn int load_NRQCD_props( struct propagator *prop , const size_t nprops )
+   @brief reads the props with NRQCD_STORE set that an earlier run stored for this gauge field and these parameters, sets NRQCD.LOADED for the ones it finds
+   @return #SUCCESS
+ */
+int
+load_NRQCD_props( struct propagator *prop ,
+		  const size_t nprops ) ;
+
+/**
+   @fn int store_NRQCD_props( const struct propagator *prop , const size_t nprops )
+   @brief writes the evolved props with NRQCD_STORE set as Nrel_fwd and Nrel_bwd files named by their hash
+   @return #SUCCESS
+ */
+int
+store_NRQCD_props( const struct propagator *prop ,
+		   const size_t nprops ) ;
+
+#endif
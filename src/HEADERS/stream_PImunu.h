@@ -0,0 +1,62 @@
+/**
+   @file stream_PImunu.h
+   @brief prototype functions for the timeslice by timeslice VPF accumulation
+ */
+#ifndef STREAM_PIMUNU_H
+#define STREAM_PIMUNU_H
+
+/**
+   @fn struct PIdata *PIstream_AA( const struct PIstream *P , const size_t t )
+   @brief where the contraction puts the LCU sites of timeslice t of the axial data
+ */
+struct PIdata *
+PIstream_AA( const struct PIstream *P ,
+	     const size_t t ) ;
+
+/**
+   @fn struct PIdata *PIstream_VV( const struct PIstream *P , const size_t t )
+   @brief where the contraction puts the LCU sites of timeslice t of the vector data
+ */
+struct PIdata *
+PIstream_VV( const struct PIstream *P ,
+	     const size_t t ) ;
+
+/**
+   @fn void PIstream_accumulate( struct PIstream *P , const struct site *lat , const size_t t )
+   @brief sums timeslice t into the time correlators and the config-space WI
+   @warning timeslices must be accumulated in order, every thread of the enclosing parallel region (if there is one) must call it
+ */
+void
+PIstream_accumulate( struct PIstream *P ,
+		     const struct site *lat ,
+		     const size_t t ) ;
+
+/**
+   @fn void PIstream_finish( struct PIstream *P , const struct site *lat , const struct cut_info CUTINFO , const char *outfile , const current_type current )
+   @brief prints the WI and writes the time moments and, if we kept the whole field, the momentum-space VPF
+ */
+void
+PIstream_finish( struct PIstream *P ,
+		 const struct site *lat ,
+		 const struct cut_info CUTINFO ,
+		 const char *outfile ,
+		 const current_type current ) ;
+
+/**
+   @fn void free_PIstream( struct PIstream *P )
+   @brief frees the stream
+ */
+void
+free_PIstream( struct PIstream *P ) ;
+
+/**
+   @fn int init_PIstream( struct PIstream *P , const current_type current , const GLU_bool full )
+   @brief allocates a timeslice of AA and a ring of two of VV, or the whole volume if full is set
+   @return #SUCCESS or #FAILURE
+ */
+int
+init_PIstream( struct PIstream *P ,
+	       const current_type current ,
+	       const GLU_bool full ) ;
+
+#endif
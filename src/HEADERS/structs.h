@@ -12,10 +12,14 @@
    @brief baryon contraction info
    @param map :: contraction map indices
    @param outfile :: output file name
+   @param gammas :: gamma indices of the Cgamma channels we compute
+   @param ngammas :: number of gammas in the list
  */
 struct baryon_info {
   size_t map[ 3 ] ;
   char outfile[ 256 ] ;
+  size_t gammas[ NSNS ] ;
+  size_t ngammas ;
 } ;
 
 /**
@@ -50,6 +54,17 @@ struct halfspinor_f {
   float complex D[ ND ][ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
 } ;
 
+/**
+   @struct halfspinor_split
+   @brief single precision heavy prop temporary
+   colour row b holds the NS*NC ( spin , colour ) entries of the
+   halfspinor with the real and imaginary parts split
+ */
+struct halfspinor_split {
+  float re[ NC ][ NS*NC ] __attribute__((aligned(ALIGNMENT))) ;
+  float im[ NC ][ NS*NC ] __attribute__((aligned(ALIGNMENT))) ;
+} ;
+
 /**
    @struct correlator
    @brief correlator data storage
@@ -73,6 +88,13 @@ struct cut_info{
   double proto_mom[ ND-1 ] ;
   double thetas[ 16 ] ;
   size_t Nalphas ;
+  // explicit list of sink momenta for the phase-table projection
+  double sink_moms[ MAX_SINK_MOMENTA ][ ND-1 ] ;
+  size_t Nsink_moms ;
+  // average over cubic-symmetry orbits of the momenta in-run
+  GLU_bool momavg ;
+  // keep the whole 4D VPF field for the momentum-space output
+  GLU_bool VPF_momspace ;
   // sink smearing params
   size_t nsink ;
   double sink_alpha ;
@@ -173,17 +195,25 @@ struct measurements {
   struct spinor **Sf ;
   struct spinor **S1 ; // sink smearing temp if we do it
   struct spinor *SUM ;
+  struct spinor **Sr2 ; // r^2-summed props if we convolve
+  double complex *rmask ; // FT of the r^2 offset mask
   struct gamma *GAMMAS ;
   struct veclist *list ;
   struct veclist *wwlist ;
   struct veclist_int *rlist ;
   int NR ;
+  size_t *rtable ; // site of each r-offset from every site, NR per site
   int *nmom ;
   int *wwnmom ;
+  struct veclist *olist ; // momentum orbits the correlators are stored as
+  int *nolist ;
+  size_t *omap ;   // list indices ordered by orbit
+  size_t *ostart ; // where each orbit starts in omap
   double complex **in ;
   double complex **out ;
 #ifdef HAVE_FFTW3_H
   fftw_plan *forward , *backward ;
+  fftw_plan conv_forward , conv_backward ;
 #else
   int *forward , *backward ;
 #endif
@@ -204,10 +234,14 @@ struct measurements {
    @brief meson contraction information
    @param map :: maps contractions indices
    @param outfile :: output file name
+   @param gammas :: gamma indices of the channels we compute
+   @param ngammas :: number of gammas in the list
  */
 struct meson_info {
   size_t map[2] ;
   char outfile[ 256 ] ;
+  size_t gammas[ NSNS ] ;
+  size_t ngammas ;
 } ;
 
 /**
@@ -230,6 +264,11 @@ struct NRQCD_params {
   size_t N ;   // number of hamiltonian applications
   GLU_bool FWD ; // do we compute fwc direction of propagator?
   GLU_bool BWD ; // do we compute bwd direction of propagator?
+  GLU_bool PIPELINE ; // evolve the fwd prop as it is read instead of storing it
+  fp_precision PRECISION ; // precision of the kinetic evolution
+  fp_precision ACCUM ; // what a single precision evolution accumulates in
+  GLU_bool STORE ; // write the evolved prop to disk or read it back if it is there
+  GLU_bool LOADED ; // set if the prop was read back instead of evolved
 } ;
 
 /**
@@ -240,6 +279,35 @@ struct PIdata {
   double complex PI[ ND ][ ND ] ;
 } ;
 
+/**
+   @struct PIstream
+   @brief timeslice by timeslice accumulation of the VPF
+   @param AA :: one timeslice of axial data, or the whole volume if full
+   @param VV :: ring of two timeslices of vector data, or the whole volume
+   @param VV0 :: copy of the first timeslice we see, closes the WI
+   @param ctAA :: zero spatial momentum axial correlators
+   @param ctVV :: zero spatial momentum vector correlators
+   @param WIsum :: backward config-space WI violation so far
+   @param nslice :: number of timeslices accumulated
+   @param tfirst :: first timeslice accumulated
+   @param tprev :: last timeslice accumulated
+   @param WI :: do we check the Ward identity (conserved currents only)
+   @param full :: have we materialised the whole 4D field
+ */
+struct PIstream {
+  struct PIdata *AA ;
+  struct PIdata *VV ;
+  struct PIdata *VV0 ;
+  struct mcorr **ctAA ;
+  struct mcorr **ctVV ;
+  double WIsum ;
+  size_t nslice ;
+  size_t tfirst ;
+  size_t tprev ;
+  GLU_bool WI ;
+  GLU_bool full ;
+} ;
+
 /**
    @struct source_info
    @brief information for the propagator sources
@@ -251,6 +319,7 @@ struct source_info {
   smearing smear ;
   sourcetype type ;
   size_t Z2_spacing ;
+  size_t Nhits ; // number of noise hits
 } ;
 
 /**
@@ -259,6 +328,7 @@ struct source_info {
  */
 struct propagator {
   FILE *file ;
+  long int data_start ; // where the first timeslice starts in file
   proptype basis ;
   size_t origin[ ND ] ;
   boundaries bound[ ND ] ;
@@ -267,11 +337,14 @@ struct propagator {
   double plaq ;
   struct halfspinor_f *Hfwd ;
   struct halfspinor_f *Hbwd ;
+  struct NRQCD_pipe *pipe ;
+  struct NRQCD_links *links ;
   struct NRQCD_params NRQCD ;
   fp_precision precision ;
   endianness endian ;
   struct source_info Source ;
   size_t t ;
+  size_t hit ; // which noise hit read_prop() gives us
 } ;
 
 /**
@@ -319,6 +392,53 @@ struct Ospinor {
   struct spinmatrix C[ NC ][ NC ] __attribute__((aligned(ALIGNMENT))) ;
 } ;
 
+/**
+   @struct penta_term
+   @brief one weighted term of a pentaquark colour contraction
+   @param K :: colour pair of the spinmatrix the term multiplies, if any
+   @param A :: flattened colour index of the left block
+   @param B :: flattened colour index of the right block
+   @param w :: weight from the epsilon identities
+ */
+struct penta_term {
+  uint8_t K , A , B ;
+  int w ;
+} ;
+
+/**
+   @struct penta_colors
+   @brief the nonzero colour terms of each pentaquark contraction
+   @param T :: term lists sorted by K then A then B
+   @param n :: length of each list
+ */
+struct penta_colors {
+  struct penta_term *T[ PENTA_NTERMS ] ;
+  size_t n[ PENTA_NTERMS ] ;
+} ;
+
+/**
+   @struct penta_site
+   @brief the pieces of a site shared by every pentaquark operator block
+   @param U :: light propagator
+   @param UT :: its spin and colour transpose
+   @param B :: backward-propagating heavy quark
+   @param OU :: colour-major U
+   @param OUT :: colour-major UT
+   @param G :: block gammas
+   @param CG :: C times the block gammas
+   @param tGt :: gamma_t G^dagger gamma_t of the block gammas
+   @param tCGt :: gamma_t (CG)^dagger gamma_t of the block gammas
+   @param GAMMAS :: gamma matrices
+   @param PC :: colour term lists from init_penta_colors()
+ */
+struct penta_site {
+  struct spinor U , UT , B ;
+  struct Ospinor OU , OUT ;
+  struct gamma G[ 4 ] , CG[ 4 ] , tGt[ 4 ] , tCGt[ 4 ] ;
+  const struct gamma *GAMMAS ;
+  const struct penta_colors *PC ;
+} ;
+
 /**
    @struct penta_info
    @brief pentaquark contraction info
@@ -393,18 +513,60 @@ struct WME_info {
   char outfile[ 256 ] ;
 } ;
 
-// allocation of a field
-struct field {
-  double complex **O ;
+// derivatives of S shared by all of the terms of one application
+// of the hamiltonian, laid out like S in the NRQCD temporaries
+struct NRQCD_derivs {
+  struct halfspinor *grad[ ND-1 ] ; // improved gradient
+  struct halfspinor *lapl ;         // grad^2 S
+  struct halfspinor *lapl2 ;        // grad^2 grad^2 S
+  struct halfspinor *lapl_imp ;     // improved grad^2 S
+  struct halfspinor *sigmaB ;       // sigma.B S
 } ;
 
-// little struct for the NRQCD temporaries
+// little struct for the NRQCD temporaries, S,S1,H and the derivatives
+// in D hold Nsrc sources one after the other each of length LCU,
+// Fmunu is a single slab of NFMUNU*LCU colormatrices indexed with FMUNU()
+// and order is the tiled order the sweeps visit the LCU sites in.
+// Sf, S1f and the split spatial and temporal links Uf are the single
+// precision copies the evolution between the spin-dependent terms
+// uses, if any prop asks for it
 struct NRQCD_fields {
   struct halfspinor *S ;
   struct halfspinor *S1 ;
-  struct halfspinor *S2 ;
   struct halfspinor *H ;
-  struct field *Fmunu ;
+  struct NRQCD_derivs D ;
+  double complex *Fmunu ;
+  size_t *order ;
+  struct halfspinor_split *Sf ;
+  struct halfspinor_split *S1f ;
+  float *Uf ;
+  size_t Nsrc ;
+} ;
+
+// tadpole improved and twisted links shared by the NRQCD props with
+// the same U0 and twist, ND colormatrices per site for consecutive
+// timeslices from first, the neighbours are those of the global lat.
+// Timeslice t of U is only filled in once built[t] is set. If Fmunu
+// is not NULL it caches LT clover slabs, valid once have_clovers[t]
+// is set. A window only holds the NRQCD_WINDOW timeslices from first
+struct NRQCD_links {
+  double complex *U ;
+  GLU_bool *built ;
+  double complex *Fmunu ;
+  GLU_bool *have_clovers ;
+  GLU_bool window ;
+  size_t first ;
+  double U0 ;
+  double twist[ ND ] ;
+} ;
+
+// state of a pipelined NRQCD evolution, F holds the timeslice
+// the noise hit hit has been evolved to after nsteps steps from the source
+struct NRQCD_pipe {
+  struct NRQCD_fields F ;
+  size_t nsteps ;
+  size_t hit ;
+  GLU_bool started ;
 } ;
 
 #endif
@@ -5,6 +5,13 @@
 #ifndef SU2_DIBARYON_H
 #define SU2_DIBARYON_H
 
+/**
+   @fn size_t su2_dibaryon_scratch_bytes( void )
+   @brief per-thread scratch su2_dibaryon() draws for its gamma blocks
+ */
+size_t
+su2_dibaryon_scratch_bytes( void ) ;
+
 /**
    @fn int su2_dibaryon( struct propagator prop1 , struct cut_info CUTINFO , const char *outfile )
    @brief su2 dibaryon contraction code
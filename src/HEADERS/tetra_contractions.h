@@ -39,10 +39,17 @@ precompute_block( struct block *C1 ,
 		  const struct spinor S2 ,
 		  const struct gamma G2 ) ;
 
+/**
+   @fn size_t tetras_scratch_bytes( void )
+   @brief per-thread scratch tetras() draws for its colour blocks
+ */
+size_t
+tetras_scratch_bytes( void ) ;
+
 /**
    @fn int tetras( double complex *result , const struct spinor L1 , const struct spinor L2 , const struct spinor bwdH1 , const struct spinor bwdH2 , const struct gamma *GAMMAS , const size_t mu , const GLU_bool L1L2_degenerate , const GLU_bool H1H2_degenerate )
    @brief perform all tetraquark contractions
-   @return #SUCCES or #FAILURE
+   @return #SUCCES or #FAILURE if the scratch arena is too small
  */
 int
 tetras( double complex *result ,
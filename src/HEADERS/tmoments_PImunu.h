@@ -7,12 +7,21 @@
 #define TMOMENTS_PIMUNU_H
 
 /**
-   @fn void tmoments( const struct PIdata *AA , const struct PIdata *VV , const char *outfile , const current_type current )
-   @brief time moments computation
+   @fn void tmoments_slice( struct mcorr **corr , const struct PIdata *data , const size_t t )
+   @brief sums the LCU sites of timeslice data into the zero spatial momentum corr at t, the ND*ND components are shared out over the threads of the enclosing parallel region
  */
 void
-tmoments( const struct PIdata *AA ,
-	  const struct PIdata *VV ,
+tmoments_slice( struct mcorr **corr ,
+		const struct PIdata *data ,
+		const size_t t ) ;
+
+/**
+   @fn void tmoments( const struct mcorr **ctAA , const struct mcorr **ctVV , const char *outfile , const current_type current )
+   @brief writes the zero spatial momentum correlators and their time moments
+ */
+void
+tmoments( const struct mcorr **ctAA ,
+	  const struct mcorr **ctVV ,
 	  const char *outfile ,
 	  const current_type current ) ;
 
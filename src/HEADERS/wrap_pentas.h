@@ -19,4 +19,11 @@ contract_pentas( struct propagator *prop ,
 		 const struct cut_info CUTINFO ,
 		 const size_t npentas ) ;
 
+/**
+   @fn size_t penta_scratch_bytes( void )
+   @brief per-thread scratch the pentaquark contractions draw for their results
+ */
+size_t
+penta_scratch_bytes( void ) ;
+
 #endif
@@ -15,4 +15,11 @@ contract_tetras( struct propagator *prop ,
 		 const struct cut_info CUTINFO ,
 		 const size_t ntetras ) ;
 
+/**
+   @fn size_t tetra_scratch_bytes( void )
+   @brief per-thread scratch the tetraquark contractions of this build draw
+ */
+size_t
+tetra_scratch_bytes( void ) ;
+
 #endif
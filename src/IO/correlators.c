@@ -12,7 +12,7 @@
   #include "SSE2_OPS.h"
 #endif
 
-// does a DFT with +/- M -> sum_mom
+// does a DFT with +/- M -> sum_mom, averaging over each momentum orbit
 static int
 DFT_correlator( struct measurements *M ,
 		const size_t stride1 ,
@@ -22,37 +22,61 @@ DFT_correlator( struct measurements *M ,
 {
   size_t idx ;
 #pragma omp for private(idx) schedule(dynamic)
-  for( idx = 0 ; idx < stride1*stride2*M->nmom[0] ; idx++ ) {
+  for( idx = 0 ; idx < stride1*stride2*M->nolist[0] ; idx++ ) {
     
     const size_t gidx = idx%(stride1*stride2) ;
-    const size_t p = idx/(stride1*stride2) ;
+    const size_t o = idx/(stride1*stride2) ;
     const size_t i = gidx/stride2 ;
     const size_t j = gidx%stride2 ;
-    size_t site ;
+    size_t k , site ;
     
     #ifdef HAVE_IMMINTRIN_H
-    const __m128d *in = (const __m128d*)M -> in[ gidx ] ;
-    const __m128d *eipx = (const __m128d*)M -> dft_mom[ p ] ;
     register __m128d s = _mm_setzero_pd() ;
-    for( site = 0 ; site < LCU ; site++ ) {
-      s = _mm_add_pd( s , SSE2_MUL( *in , *eipx ) ) ;
-      in++ ; eipx++ ;
+    for( k = M -> ostart[ o ] ; k < M -> ostart[ o+1 ] ; k++ ) {
+      const __m128d *in = (const __m128d*)M -> in[ gidx ] ;
+      const __m128d *eipx = (const __m128d*)M -> dft_mom[ M -> omap[k] ] ;
+      for( site = 0 ; site < LCU ; site++ ) {
+	s = _mm_add_pd( s , SSE2_MUL( *in , *eipx ) ) ;
+	in++ ; eipx++ ;
+      }
     }
     // cast into void
     double complex sum = 0.0 ;
     _mm_store_pd( (void*)&sum , s ) ;
     #else
     register double complex sum = 0.0 ;
-    for( site = 0 ; site < LCU ; site++ ) {
-      sum +=
-	M -> in[ gidx ][ site ] * M -> dft_mom[ p ][ site ] ;
+    for( k = M -> ostart[ o ] ; k < M -> ostart[ o+1 ] ; k++ ) {
+      const double complex *eipx = M -> dft_mom[ M -> omap[k] ] ;
+      for( site = 0 ; site < LCU ; site++ ) {
+	sum += M -> in[ gidx ][ site ] * eipx[ site ] ;
+      }
     }
     #endif
-    M -> corr[ i ][ j ].mom[ p ].C[ tshifted ] = sum ;
+    M -> corr[ i ][ j ].mom[ o ].C[ tshifted ] = 
+      sum / (double)( M -> ostart[ o+1 ] - M -> ostart[ o ] ) ;
   }
   return SUCCESS ;
 }
 
+// average the projected data over each momentum orbit
+static void
+orbit_average( struct correlator *mom ,
+	       const double complex *data ,
+	       const struct measurements *M ,
+	       const size_t tshifted )
+{
+  size_t o , k ;
+  for( o = 0 ; o < (size_t)M -> nolist[ 0 ] ; o++ ) {
+    register double complex sum = 0.0 ;
+    for( k = M -> ostart[ o ] ; k < M -> ostart[ o+1 ] ; k++ ) {
+      sum += data[ M -> list[ M -> omap[k] ].idx ] ;
+    }
+    mom[ o ].C[ tshifted ] = 
+      sum / (double)( M -> ostart[ o+1 ] - M -> ostart[ o ] ) ;
+  }
+  return ;
+}
+
 // FFT using FFTW OR we just do the zero momentum sum
 static int
 FFT_correlator( struct measurements *M ,
@@ -69,14 +93,11 @@ FFT_correlator( struct measurements *M ,
   for( idx = 0 ; idx < stride1*stride2 ; idx++ ) {
     const size_t i = idx/stride2 ;
     const size_t j = idx%stride2 ;
-    size_t p ;
     #ifdef HAVE_FFTW3_H
     fftw_execute( fwd[ idx ] ) ;
-    for( p = 0 ; p < (size_t)M -> nmom[ 0 ] ; p++ ) {
-      M -> corr[ i ][ j ].mom[ p ].C[ tshifted ] =
-	M -> out[ idx ][ M -> list[ p ].idx ] ;
-    }
+    orbit_average( M -> corr[ i ][ j ].mom , M -> out[ idx ] , M , tshifted ) ;
     #else
+    size_t p ;
     register double complex sum = 0.0 ;
     for( p = 0 ; p < LCU ; p++ ) {
       sum += M -> in[ idx ][ p ] ;
@@ -126,11 +147,7 @@ compute_correlator( struct measurements *M ,
     for( idx = 0 ; idx < stride1*stride2 ; idx++ ) {
       const size_t i = idx/stride2 ;
       const size_t j = idx%stride2 ;
-      size_t p ;
-      for( p = 0 ; p < (size_t)M -> nmom[ 0 ] ; p++ ) {
-	M -> corr[ i ][ j ].mom[ p ].C[ tshifted ] =
-	  M -> in[ idx ][ M -> list[ p ].idx ] ;
-      }
+      orbit_average( M -> corr[ i ][ j ].mom , M -> in[ idx ] , M , tshifted ) ;
     }
   } else if( M -> is_wall_mom == GLU_TRUE ||
 	     M -> is_dft == GLU_TRUE ) {
@@ -162,16 +179,20 @@ free_momcorrs( struct mcorr **mcorr ,
   return ;
 }
 
-// write the full correlator matrix
-void
-write_momcorr( const char *outfile ,
-	       const struct mcorr **corr ,
-	       const struct veclist *list ,
-	       const double twist[ ND ] ,
-	       const size_t NSRC ,
-	       const size_t NSNK ,
-	       const int *nmom , 
-	       const char *type )
+// write the correlator matrix, if srcg or snkg is not NULL the file
+// is a compact one that lists the gamma channel of each row and column
+// in its header. A NULL list with the other set is 0,1,..
+static void
+write_corr( const char *outfile ,
+	    const struct mcorr **corr ,
+	    const struct veclist *list ,
+	    const double twist[ ND ] ,
+	    const size_t NSRC ,
+	    const size_t NSNK ,
+	    const uint32_t *srcg ,
+	    const uint32_t *snkg ,
+	    const int *nmom , 
+	    const char *type )
 {
   // write out the correlator
   char outstr[ strlen(outfile)+strlen(type)+2 ] ;
@@ -185,9 +206,26 @@ write_momcorr( const char *outfile ,
 
   FILE *output_file = fopen( outstr , "wb" ) ;
 
-  uint32_t magic[ 1 ] = { CORR_MAGIC } ; // THIS SPELLS CORR in ascii
-
-  fwrite( magic , sizeof( uint32_t ) , 1 , output_file ) ;
+  size_t GSRC , GSNK ;
+  if( srcg == NULL && snkg == NULL ) {
+    uint32_t magic[ 1 ] = { CORR_MAGIC } ; // THIS SPELLS CORR in ascii
+    fwrite( magic , sizeof( uint32_t ) , 1 , output_file ) ;
+  } else {
+    uint32_t magic[ 1 ] = { CORR_GAMMA_MAGIC } ;
+    fwrite( magic , sizeof( uint32_t ) , 1 , output_file ) ;
+    uint32_t N[ 1 ] = { (uint32_t)NSRC } ;
+    fwrite( N , sizeof( uint32_t ) , 1 , output_file ) ;
+    for( GSRC = 0 ; GSRC < NSRC ; GSRC++ ) {
+      uint32_t G[ 1 ] = { srcg == NULL ? (uint32_t)GSRC : srcg[ GSRC ] } ;
+      fwrite( G , sizeof( uint32_t ) , 1 , output_file ) ;
+    }
+    N[ 0 ] = (uint32_t)NSNK ;
+    fwrite( N , sizeof( uint32_t ) , 1 , output_file ) ;
+    for( GSNK = 0 ; GSNK < NSNK ; GSNK++ ) {
+      uint32_t G[ 1 ] = { snkg == NULL ? (uint32_t)GSNK : snkg[ GSNK ] } ;
+      fwrite( G , sizeof( uint32_t ) , 1 , output_file ) ;
+    }
+  }
 
   write_mom_veclist( output_file , twist , nmom , list , ND-1 ) ;
 
@@ -206,7 +244,6 @@ write_momcorr( const char *outfile ,
     fwrite( NGSRC , sizeof( uint32_t ) , 1 , output_file ) ;
     fwrite( NGSNK , sizeof( uint32_t ) , 1 , output_file ) ;
 
-    size_t GSRC , GSNK ;
     for( GSRC = 0 ; GSRC < NSRC ; GSRC++ ) {
       for( GSNK = 0 ; GSNK < NSNK ; GSNK++ ) {
 	fwrite( L0 , sizeof( uint32_t ) , 1 , output_file ) ;
@@ -228,6 +265,64 @@ write_momcorr( const char *outfile ,
   return ;
 }
 
+// the gamma channel of each entry of a gamma list, if pairs is true
+// the channels are the flattened source-sink gamma pairs of the list.
+// Returns GLU_FALSE if the list is the whole basis in order
+GLU_bool
+gamma_channel_list( uint32_t *chan ,
+		    const size_t *gammas ,
+		    const size_t ngammas ,
+		    const GLU_bool pairs )
+{
+  GLU_bool subset = ( ngammas != NSNS ) ? GLU_TRUE : GLU_FALSE ;
+  size_t i , j ;
+  for( i = 0 ; i < ngammas ; i++ ) {
+    if( gammas[ i ] != i ) subset = GLU_TRUE ;
+    if( pairs == GLU_TRUE ) {
+      for( j = 0 ; j < ngammas ; j++ ) {
+	chan[ j + ngammas * i ] = (uint32_t)( gammas[ j ] + NSNS * gammas[ i ] ) ;
+      }
+    } else {
+      chan[ i ] = (uint32_t)gammas[ i ] ;
+    }
+  }
+  return subset ;
+}
+
+// write the full correlator matrix
+void
+write_momcorr( const char *outfile ,
+	       const struct mcorr **corr ,
+	       const struct veclist *list ,
+	       const double twist[ ND ] ,
+	       const size_t NSRC ,
+	       const size_t NSNK ,
+	       const int *nmom , 
+	       const char *type )
+{
+  write_corr( outfile , corr , list , twist , NSRC , NSNK ,
+	      NULL , NULL , nmom , type ) ;
+  return ;
+}
+
+// write a correlator matrix of the gamma channels srcg and snkg
+void
+write_momcorr_gammas( const char *outfile ,
+		      const struct mcorr **corr ,
+		      const struct veclist *list ,
+		      const double twist[ ND ] ,
+		      const size_t NSRC ,
+		      const size_t NSNK ,
+		      const uint32_t *srcg ,
+		      const uint32_t *snkg ,
+		      const int *nmom , 
+		      const char *type )
+{
+  write_corr( outfile , corr , list , twist , NSRC , NSNK ,
+	      srcg , snkg , nmom , type ) ;
+  return ;
+}
+
 // little wrapper function
 void
 write_momcorr_WW( const struct measurements M ,
@@ -236,9 +331,26 @@ write_momcorr_WW( const struct measurements M ,
 		  const size_t NSNK )
 {
   // write out the ND-1 momentum-injected correlator and maybe the wall
-  write_momcorr( outfile , (const struct mcorr**)M.corr , M.list ,
-		 M.sum_twist , NSRC , NSNK , M.nmom , "" ) ;
+  write_momcorr( outfile , (const struct mcorr**)M.corr , M.olist ,
+		 M.sum_twist , NSRC , NSNK , M.nolist , "" ) ;
   write_momcorr( outfile , (const struct mcorr**)M.wwcorr , M.wwlist ,
 		 M.sum_twist , NSRC , NSNK , M.wwnmom , "ww" ) ;
   return ;
 }
+
+// write only the gamma channels we computed, both lists NULL is the
+// usual full file
+void
+write_momcorr_WW_gammas( const struct measurements M ,
+			 const char *outfile ,
+			 const size_t NSRC ,
+			 const size_t NSNK ,
+			 const uint32_t *srcg ,
+			 const uint32_t *snkg )
+{
+  write_corr( outfile , (const struct mcorr**)M.corr , M.olist ,
+	      M.sum_twist , NSRC , NSNK , srcg , snkg , M.nolist , "" ) ;
+  write_corr( outfile , (const struct mcorr**)M.wwcorr , M.wwlist ,
+	      M.sum_twist , NSRC , NSNK , srcg , snkg , M.wwnmom , "ww" ) ;
+  return ;
+}
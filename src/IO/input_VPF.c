@@ -20,6 +20,8 @@ get_current_type( current_type *current ,
     *current = LOCAL_LOCAL ;
   } else if( are_equal( token , "CONSERVED_LOCAL" ) ) {
     *current = CONSERVED_LOCAL ;
+  } else if( are_equal( token , "CL_AND_LL" ) ) {
+    *current = CL_AND_LL ;
   } else {
     fprintf( stderr , "[IO] I don't understand VPF type %s\n" , token ) ;
     return FAILURE ;
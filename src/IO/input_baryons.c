@@ -50,6 +50,7 @@ threepoint_tokens( struct baryon_info *baryons ,
 }
 
 // baryon contractions of the form prop_idx1,prop_idx2,proptype,outfile
+// with an optional BARYON{idx}_GAMMAS = G0,G1,... list of Cgamma channels
 int
 baryon_contractions( struct baryon_info *baryons , 
 		     size_t *nbaryons ,
@@ -68,6 +69,10 @@ baryon_contractions( struct baryon_info *baryons ,
 			     INPUT[ baryon_idx ].VALUE , 
 			     nprops , *nbaryons , "Baryon" ) 
 	  == FAILURE ) return FAILURE ;
+      sprintf( str , "BARYON%zu_GAMMAS" , *nbaryons ) ;
+      if( get_gamma_list( baryons[ *nbaryons ].gammas , 
+			  &( baryons[ *nbaryons ].ngammas ) ,
+			  str , B_CHANNELS ) == FAILURE ) return FAILURE ;
     }
     *nbaryons = *nbaryons + 1 ;
   }
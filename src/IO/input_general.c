@@ -58,6 +58,45 @@ get_DFT( double *proto_mom ,
   return SUCCESS ;
 }
 
+// get the explicit list of sink momenta, in units of 2\pi/L
+static int
+get_sink_momenta( double sink_moms[ MAX_SINK_MOMENTA ][ ND-1 ] ,
+		  size_t *nmoms ,
+		  const struct inputs *INPUT )
+{
+  *nmoms = 0 ;
+  const int mom_idx = tag_search( "SINK_MOMENTA" ) ;
+  if( mom_idx == FAILURE ) { 
+    return SUCCESS ;
+  }
+  char *token , *endptr ;
+  size_t mu = 0 ;
+  token = strtok( (char*)INPUT[mom_idx].VALUE , "," ) ;
+  while( token != NULL ) {
+    if( mu == MAX_SINK_MOMENTA*(ND-1) ) {
+      fprintf( stderr , "[IO] more than %d SINK_MOMENTA given\n" ,
+	       MAX_SINK_MOMENTA ) ;
+      return FAILURE ;
+    }
+    errno = 0 ;
+    sink_moms[ mu/(ND-1) ][ mu%(ND-1) ] = strtod( token , &endptr ) ;
+    if( endptr == token || errno == ERANGE ) {
+      fprintf( stderr , "[IO] non-sensical SINK_MOMENTA entry %s\n" , token ) ;
+      return FAILURE ;
+    }
+    mu++ ;
+    token = strtok( NULL , "," ) ;
+  }
+  if( mu == 0 || mu%(ND-1) != 0 ) {
+    fprintf( stderr , "[IO] SINK_MOMENTA needs multiples of %d components, "
+	     "got %zu\n" , ND-1 , mu ) ;
+    return FAILURE ;
+  }
+  *nmoms = mu/(ND-1) ;
+  fprintf( stdout , "[IO] projecting onto %zu sink momenta\n" , *nmoms ) ;
+  return SUCCESS ;
+}
+
 // get the lattice dimensions from the input_file
 int
 get_dims( size_t *dims , 
@@ -218,6 +257,29 @@ read_cuts_struct( struct cut_info *CUTINFO ,
       CUTINFO -> proto_mom[mu] = 0.0 ;
     }
   }
+  // explicit sink momenta
+  if( get_sink_momenta( CUTINFO -> sink_moms ,
+			&CUTINFO -> Nsink_moms , INPUT ) == FAILURE ) {
+    return FAILURE ;
+  }
+  // in-run momentum orbit averaging
+  const int momavg_idx = tag_search( "MOM_AVG" ) ;
+  if( momavg_idx != FAILURE && 
+      are_equal( INPUT[momavg_idx].VALUE , "TRUE" ) ) {
+    fprintf( stdout , "[IO] averaging momentum orbits\n" ) ;
+    CUTINFO -> momavg = GLU_TRUE ;
+  } else {
+    CUTINFO -> momavg = GLU_FALSE ;
+  }
+  // the 4D momentum-space VPF needs the whole field in memory
+  const int vpfmom_idx = tag_search( "VPF_MOMSPACE" ) ;
+  if( vpfmom_idx != FAILURE && 
+      are_equal( INPUT[vpfmom_idx].VALUE , "TRUE" ) ) {
+    fprintf( stdout , "[IO] keeping the 4D VPF for momentum space\n" ) ;
+    CUTINFO -> VPF_momspace = GLU_TRUE ;
+  } else {
+    CUTINFO -> VPF_momspace = GLU_FALSE ;
+  }
   // config space
   const int cspace_idx = tag_search( "CONFIGSPACE" ) ;
   if( are_equal( INPUT[cspace_idx].VALUE , "TRUE" ) ) {
@@ -227,6 +289,12 @@ read_cuts_struct( struct cut_info *CUTINFO ,
     fprintf( stdout , "[IO] computing momentum space correlators\n" ) ;
     CUTINFO -> configspace = GLU_FALSE ;
   }
+  // sink momenta are a momentum-space projection
+  if( CUTINFO -> configspace == GLU_TRUE && CUTINFO -> Nsink_moms > 0 ) {
+    fprintf( stderr , "[IO] SINK_MOMENTA cannot be used with "
+	     "CONFIGSPACE = TRUE\n" ) ;
+    return FAILURE ;
+  }
   // maximum R2
   const int maxr2_idx = tag_search( "MAXR2" ) ;
   if( maxr2_idx == FAILURE ) { return tag_failure( "MAXR2" ) ; }
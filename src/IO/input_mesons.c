@@ -44,6 +44,7 @@ twopoint_tokens( struct meson_info *mesons ,
 }
 
 // diquark contractions of the form prop_idx1,prop_idx2,outfile
+// with an optional DIQUARK{idx}_GAMMAS = G0,G1,... channel list
 int
 diquark_contractions( struct meson_info *diquarks , 
 		      size_t *ndiquarks ,
@@ -62,6 +63,10 @@ diquark_contractions( struct meson_info *diquarks ,
 			   INPUT[ diquark_idx ].VALUE , 
 			   nprops , *ndiquarks , "Diquark" ) 
 	  == FAILURE ) return FAILURE ;
+      sprintf( str , "DIQUARK%zu_GAMMAS" , *ndiquarks ) ;
+      if( get_gamma_list( diquarks[ *ndiquarks ].gammas , 
+			  &( diquarks[ *ndiquarks ].ngammas ) ,
+			  str , M_CHANNELS ) == FAILURE ) return FAILURE ;
     }
     *ndiquarks = *ndiquarks + 1 ;
   }
@@ -69,6 +74,7 @@ diquark_contractions( struct meson_info *diquarks ,
 }
 
 // meson contractions of the form prop_idx1,prop_idx2,outfile
+// with an optional MESON{idx}_GAMMAS = G0,G1,... channel list
 int
 meson_contractions( struct meson_info *mesons , 
 		    size_t *nmesons ,
@@ -87,6 +93,10 @@ meson_contractions( struct meson_info *mesons ,
 			   INPUT[ meson_idx ].VALUE , 
 			   nprops , *nmesons , "Meson" ) 
 	  == FAILURE ) return FAILURE ;
+      sprintf( str , "MESON%zu_GAMMAS" , *nmesons ) ;
+      if( get_gamma_list( mesons[ *nmesons ].gammas , 
+			  &( mesons[ *nmesons ].ngammas ) ,
+			  str , M_CHANNELS ) == FAILURE ) return FAILURE ;
     }
     *nmesons = *nmesons + 1 ;
   }
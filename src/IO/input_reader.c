@@ -110,6 +110,62 @@ get_contraction_map( size_t *map ,
   return SUCCESS ;
 }
 
+// read an optional list of gammas "TAG = G0,G1,..." and default to
+// the first ndefault gammas if the tag isn't there
+int
+get_gamma_list( size_t *gammas ,
+		size_t *ngammas ,
+		const char *tag ,
+		const size_t ndefault )
+{
+  size_t i ;
+  const int gamma_idx = tag_search( tag ) ;
+  if( gamma_idx == FAILURE ) {
+    *ngammas = ndefault ;
+    for( i = 0 ; i < ndefault ; i++ ) {
+      gammas[ i ] = i ;
+    }
+    return SUCCESS ;
+  }
+  *ngammas = 0 ;
+  char *token = (char*)strtok( (char*)INPUT[ gamma_idx ].VALUE , "," ) ;
+  while( token != NULL ) {
+    errno = 0 ;
+    char *endptr ;
+    const long int gamma = strtol( token , &endptr , 10 ) ;
+    if( token == endptr || errno == ERANGE ||
+	gamma < 0 || gamma >= NSNS ) {
+      fprintf( stderr , "[IO] %s :: non-sensical gamma index %s \n" ,
+	       tag , token ) ;
+      return FAILURE ;
+    }
+    if( *ngammas == NSNS ) {
+      fprintf( stderr , "[IO] %s :: more than %d gammas given \n" ,
+	       tag , NSNS ) ;
+      return FAILURE ;
+    }
+    for( i = 0 ; i < *ngammas ; i++ ) {
+      if( gammas[ i ] == (size_t)gamma ) {
+	fprintf( stderr , "[IO] %s :: gamma %ld repeated \n" ,
+		 tag , gamma ) ;
+	return FAILURE ;
+      }
+    }
+    gammas[ *ngammas ] = (size_t)gamma ;
+    *ngammas = *ngammas + 1 ;
+    token = (char*)strtok( NULL , "," ) ;
+  }
+  if( *ngammas == 0 ) {
+    return unexpected_NULL( ) ;
+  }
+  fprintf( stdout , "[IO] %s :: contracting %zu gamma(s) (" , tag , *ngammas ) ;
+  for( i = 0 ; i < *ngammas ; i++ ) {
+    fprintf( stdout , " %zu" , gammas[ i ] ) ;
+  }
+  fprintf( stdout , " ) \n" ) ;
+  return SUCCESS ;
+}
+
 // little wrapper to free our inputs. I invisage it will grow with time
 void
 free_inputs( struct input_info inputs ) 
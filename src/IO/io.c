@@ -5,6 +5,7 @@
 #include "common.h"
 
 #include "crc32.h"        // checksum calc
+#include "evolve.h"       // NRQCD_pipe_evolve()
 #include "gammas.h"       // gamma matrix technology
 #include "GLU_bswap.h"    // byteswaps
 #include "io.h"           // alphabetising
@@ -91,6 +92,24 @@ check_checksum( FILE *fprop )
   return SUCCESS ;
 }
 
+// move the file to the start of timeslice t, which it usually is
+// already as the contractions read the timeslices in order
+static int
+seek_slice( const struct propagator prop ,
+	    const size_t t )
+{
+  const size_t spinsize = ( prop.basis == CHIRAL ) ? NSNS*NCNC : (NS/2)*(NS/2)*NCNC ;
+  const size_t word = ( prop.precision == SINGLE ) ?
+    sizeof( float complex ) : sizeof( double complex ) ;
+  const long int pos = prop.data_start + (long int)( t*LCU*spinsize*word ) ;
+  if( ftell( prop.file ) != pos &&
+      fseek( prop.file , pos , SEEK_SET ) != 0 ) {
+    fprintf( stderr , "[IO] could not seek to timeslice %zu\n" , t ) ;
+    return FAILURE ;
+  }
+  return SUCCESS ;
+}
+
 // Read light propagator on a time slice 
 // should we accumulate the checksum? Probably
 static int 
@@ -236,23 +255,48 @@ set_nrprop( struct propagator prop ,
     fprintf( stderr , "[IO] NULL BWD NRQCD prop found\n" ) ;
     return FAILURE ;
   }
-  if( prop.Hfwd == NULL && prop.NRQCD.FWD == GLU_TRUE ) {
+  if( prop.Hfwd == NULL && prop.pipe == NULL && prop.NRQCD.FWD == GLU_TRUE ) {
     fprintf( stderr , "[IO] NULL FWD NRQCD prop found\n" ) ;
     return FAILURE ;
   }
+
+  // pipelined props were evolved up to this timeslice by read_ahead()
+  if( prop.pipe != NULL &&
+      ( prop.pipe -> started == GLU_FALSE || prop.pipe -> hit != prop.hit ||
+	prop.pipe -> nsteps != ( t + LT - prop.origin[ND-1]%LT )%LT ) ) {
+    fprintf( stderr , "[IO] pipelined NRQCD prop not evolved to t=%zu\n" , t ) ;
+    return FAILURE ;
+  }
+  
+  // the timeslice of the hit we are contracting
+  const size_t shift = LCU*( t + prop.hit*T_NRQCD ) ;
+  const struct halfspinor_f *Hfwd = prop.Hfwd != NULL ? prop.Hfwd + shift : NULL ;
+  const struct halfspinor_f *Hbwd = prop.Hbwd != NULL ? prop.Hbwd + shift : NULL ;
   
   for( i = 0 ; i < LCU ; i++ ) {
     if( prop.NRQCD.BWD == GLU_TRUE ) {
-      colormatrix_equiv_f2d( (void*)S[i].D[0][0].C , (void*)prop.Hbwd[i+LCU*t].D[0] ) ;
-      colormatrix_equiv_f2d( (void*)S[i].D[0][1].C , (void*)prop.Hbwd[i+LCU*t].D[1] ) ;
-      colormatrix_equiv_f2d( (void*)S[i].D[1][0].C , (void*)prop.Hbwd[i+LCU*t].D[2] ) ;
-      colormatrix_equiv_f2d( (void*)S[i].D[1][1].C , (void*)prop.Hbwd[i+LCU*t].D[3] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[0][0].C , (void*)Hbwd[i].D[0] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[0][1].C , (void*)Hbwd[i].D[1] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[1][0].C , (void*)Hbwd[i].D[2] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[1][1].C , (void*)Hbwd[i].D[3] ) ;
     }
-    if( prop.NRQCD.FWD == GLU_TRUE ) {
-      colormatrix_equiv_f2d( (void*)S[i].D[2][2].C , (void*)prop.Hfwd[i+LCU*t].D[0] ) ;
-      colormatrix_equiv_f2d( (void*)S[i].D[2][3].C , (void*)prop.Hfwd[i+LCU*t].D[1] ) ;
-      colormatrix_equiv_f2d( (void*)S[i].D[3][2].C , (void*)prop.Hfwd[i+LCU*t].D[2] ) ;
-      colormatrix_equiv_f2d( (void*)S[i].D[3][3].C , (void*)prop.Hfwd[i+LCU*t].D[3] ) ;
+    if( prop.pipe != NULL ) {
+      // round through single precision as if we had stored it
+      const struct halfspinor *H = prop.pipe -> F.S + i ;
+      struct halfspinor_f Hf ;
+      colormatrix_equiv_d2f( Hf.D[0] , H -> D[0] ) ;
+      colormatrix_equiv_d2f( Hf.D[1] , H -> D[1] ) ;
+      colormatrix_equiv_d2f( Hf.D[2] , H -> D[2] ) ;
+      colormatrix_equiv_d2f( Hf.D[3] , H -> D[3] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[2][2].C , (void*)Hf.D[0] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[2][3].C , (void*)Hf.D[1] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[3][2].C , (void*)Hf.D[2] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[3][3].C , (void*)Hf.D[3] ) ;
+    } else if( prop.NRQCD.FWD == GLU_TRUE ) {
+      colormatrix_equiv_f2d( (void*)S[i].D[2][2].C , (void*)Hfwd[i].D[0] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[2][3].C , (void*)Hfwd[i].D[1] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[3][2].C , (void*)Hfwd[i].D[2] ) ;
+      colormatrix_equiv_f2d( (void*)S[i].D[3][3].C , (void*)Hfwd[i].D[3] ) ;
     }
   }
   return SUCCESS ;
@@ -266,6 +310,15 @@ read_ahead( struct propagator *prop ,
 	    const size_t Nprops ,
 	    const size_t t )
 { 
+  size_t mu ;
+  // the whole team evolves the pipelined NRQCD props first
+  for( mu = 0 ; mu < Nprops ; mu++ ) {
+    if( prop[mu].pipe != NULL &&
+	NRQCD_pipe_evolve( prop[mu] , t ) == FAILURE ) {
+      #pragma omp atomic write
+      *error_code = FAILURE ;
+    }
+  }
   // loops for IO
 #pragma omp master
   {
@@ -273,7 +326,6 @@ read_ahead( struct propagator *prop ,
       *error_code = FAILURE ;
     }
   }
-  size_t mu ;
   for( mu = 1 ; mu < Nprops ; mu++ ) {
 #pragma omp single nowait
     {
@@ -293,13 +345,30 @@ read_prop( struct propagator prop ,
 {
   switch( prop.basis ) {
   case CHIRAL :
+    if( seek_slice( prop , t ) == FAILURE ) return FAILURE ;
     return read_chiralprop( prop , S ) ;
   case NREL_CORR :
     return set_nrprop( prop , S , t ) ;
   case NREL_FWD :
   case NREL_BWD :
+    if( seek_slice( prop , t ) == FAILURE ) return FAILURE ;
     return read_nrprop( prop , S , prop.basis ) ;
   }
   return FAILURE ;
 }
 
+// the first timeslice a contraction reads, the source of the first
+// pipelined prop so that it is only evolved once
+size_t
+sweep_start( const struct propagator *prop ,
+	     const size_t Nprops )
+{
+  size_t mu ;
+  for( mu = 0 ; mu < Nprops ; mu++ ) {
+    if( prop[mu].pipe != NULL ) {
+      return prop[mu].origin[ND-1]%LT ;
+    }
+  }
+  return 0 ;
+}
+
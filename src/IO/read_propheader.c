@@ -399,6 +399,17 @@ summarize_NRQCD_params( struct NRQCD_params NRQCD )
   if( NRQCD.FWD == GLU_TRUE ) {
     fprintf( stdout , "[IO] NRQCD forward propagator\n" ) ;
   }
+  if( NRQCD.PIPELINE == GLU_TRUE ) {
+    fprintf( stdout , "[IO] NRQCD forward propagator evolved as it is read\n" ) ;
+  }
+  if( NRQCD.PRECISION == SINGLE ) {
+    fprintf( stdout , "[IO] NRQCD kinetic term evolved in single precision, "
+	     "accumulating in %s precision\n" ,
+	     NRQCD.ACCUM == SINGLE ? "single" : "double" ) ;
+  }
+  if( NRQCD.STORE == GLU_TRUE ) {
+    fprintf( stdout , "[IO] NRQCD propagator stored on disk and reused\n" ) ;
+  }
   
 #ifdef NRQCD_NONSYM
   fprintf( stdout , "[IO] NRQCD single application of spin-dependent part\n" ) ;
@@ -470,16 +481,22 @@ summarize_prop_source( const struct propagator prop )
     fprintf( stdout , "[IO] propagator is a Z2_WALL source\n" ) ;
     fprintf( stdout , "[IO] propagator has spacing %zu\n" ,
 	     prop.Source.Z2_spacing ) ;
+    fprintf( stdout , "[IO] propagator has %zu noise hit(s)\n" ,
+	     prop.Source.Nhits ) ;
     break ;
   case Z3_WALL :
     fprintf( stdout , "[IO] propagator is a Z3_WALL source\n" ) ;
     fprintf( stdout , "[IO] propagator has spacing %zu\n" ,
 	     prop.Source.Z2_spacing ) ;
+    fprintf( stdout , "[IO] propagator has %zu noise hit(s)\n" ,
+	     prop.Source.Nhits ) ;
     break ;
   case U1_WALL :
     fprintf( stdout , "[IO] propagator is a U1_WALL source\n" ) ;
     fprintf( stdout , "[IO] propagator has spacing %zu\n" ,
 	     prop.Source.Z2_spacing ) ;
+    fprintf( stdout , "[IO] propagator has %zu noise hit(s)\n" ,
+	     prop.Source.Nhits ) ;
     break ;
   }
   
@@ -505,6 +522,8 @@ read_propheader( struct propagator *prop ,
   // set this to NULL
   prop -> Hfwd = NULL ;
   prop -> Hbwd = NULL ;
+  prop -> pipe = NULL ;
+  prop -> links = NULL ;
   
   // initialise NRQCD parameters regardless of if we use them
   prop -> NRQCD.C0    = 0.0 ; prop -> NRQCD.C1   = 0.0 ;
@@ -517,6 +536,11 @@ read_propheader( struct propagator *prop ,
   prop -> NRQCD.N     = 0   ;
   prop -> NRQCD.FWD = GLU_FALSE ;
   prop -> NRQCD.BWD = GLU_FALSE ;
+  prop -> NRQCD.PIPELINE = GLU_FALSE ;
+  prop -> NRQCD.PRECISION = DOUBLE ;
+  prop -> NRQCD.ACCUM = DOUBLE ;
+  prop -> NRQCD.STORE = GLU_FALSE ;
+  prop -> NRQCD.LOADED = GLU_FALSE ;
 
   // some defaults for the smearing and Z2 stuff
 
@@ -525,6 +549,8 @@ read_propheader( struct propagator *prop ,
   prop -> Source.Nsmear = 0 ;
   prop -> Source.smalpha = 1.0 ;
   prop -> Source.Z2_spacing = 1 ;
+  prop -> Source.Nhits = 1 ;
+  prop -> hit = 0 ;
 
   // initialise these to zero
   size_t mu ;
@@ -640,15 +666,21 @@ read_propheader( struct propagator *prop ,
     if( are_equal( tag , "NRQCD_N" ) ) get_size_t( &prop -> NRQCD.N ) ;
     if( are_equal( tag , "NRQCD_BWD" ) ) get_GLU_bool( &prop -> NRQCD.BWD ) ;
     if( are_equal( tag , "NRQCD_FWD" ) ) get_GLU_bool( &prop -> NRQCD.FWD ) ;
+    if( are_equal( tag , "NRQCD_PIPELINE" ) ) get_GLU_bool( &prop -> NRQCD.PIPELINE ) ;
+    if( are_equal( tag , "NRQCD_PRECISION" ) ) get_propprec( &prop -> NRQCD.PRECISION ) ;
+    if( are_equal( tag , "NRQCD_ACCUM" ) ) get_propprec( &prop -> NRQCD.ACCUM ) ;
+    if( are_equal( tag , "NRQCD_STORE" ) ) get_GLU_bool( &prop -> NRQCD.STORE ) ;
 
     // NRQCD sources
     if( are_equal( tag , "Boxsize:" ) ) get_size_t( &prop -> Source.boxsize ) ;
     if( are_equal( tag , "Nsmear:" ) ) get_size_t( &prop -> Source.Nsmear ) ;
     if( are_equal( tag , "Smalpha:" ) ) get_double( &prop -> Source.smalpha ) ;
     if( are_equal( tag , "Z2_spacing:" ) ) get_size_t( &prop -> Source.Z2_spacing ) ;
+    if( are_equal( tag , "Nhits:" ) ) get_size_t( &prop -> Source.Nhits ) ;
     
     // break when we hit the desired end_header
     if( are_equal( line , "<end_header>\n" ) ) {
+      prop -> data_start = ftell( prop -> file ) ;
       break ;
     }
     n++ ;
@@ -695,6 +727,19 @@ read_propheader( struct propagator *prop ,
     }
   }
 
+  // only on the fly noise sources can have more than one hit
+  if( prop -> Source.Nhits == 0 ) {
+    fprintf( stderr , "[IO] prop header non sensical Nhits of 0\n" ) ;
+    return FAILURE ;
+  }
+  if( prop -> Source.Nhits > 1 &&
+      ( prop -> basis != NREL_CORR || prop -> Source.type == POINT ||
+	prop -> Source.type == WALL ) ) {
+    fprintf( stderr , "[IO] Nhits %zu is only for NRQCD noise sources\n" ,
+	     prop -> Source.Nhits ) ;
+    return FAILURE ;
+  }
+
   // Randy's NRQCD code counts from 1 instead of zero, shift to c-counting
   // instead of Fortran counting ->  I hate this so much
   if( prop -> basis == NREL_FWD || prop -> basis == NREL_BWD ) {
@@ -745,11 +790,19 @@ int
 sanity_check_props( const struct propagator *prop ,
 		    const size_t *map ,
 		    const size_t Nmap ,
-		    const char *label )
+		    const char *label ,
+		    const GLU_bool loops_hits )
 {
   // test that all the origins are equal to prop[0]s
   size_t i , mu ;
   for( i = 0 ; i < Nmap ; i++ ) {
+    // only the first hit would be used otherwise
+    if( loops_hits == GLU_FALSE && prop[ map[ i ] ].Source.Nhits > 1 ) {
+      fprintf( stderr , "%s contraction does not loop over the %zu "
+	       "noise hits of prop %zu\n" , label ,
+	       prop[ map[ i ] ].Source.Nhits , map[ i ] ) ;
+      return FAILURE ;
+    }
     // check origins
     for( mu = 0 ; mu < ND ; mu++ ) {
       if( prop[ map[ 0 ] ].origin[ mu ] != prop[ map[ i ] ].origin[ mu ] ) {
@@ -767,6 +820,15 @@ sanity_check_props( const struct propagator *prop ,
 	       label , prop[ map[ 0 ] ].plaq , prop[ map[ i ] ].plaq , i ) ;
       return FAILURE ;
     }
+    // noise props contracted together have to have the same hits
+    if( prop[ map[ 0 ] ].Source.Nhits != prop[ map[ i ] ].Source.Nhits &&
+	prop[ map[ 0 ] ].Source.Nhits > 1 && prop[ map[ i ] ].Source.Nhits > 1 ) {
+      fprintf( stderr , "%s contraction of props with unequal "
+	       "noise hits %zu vs %zu ( index %zu )\n" , label ,
+	       prop[ map[ 0 ] ].Source.Nhits ,
+	       prop[ map[ i ] ].Source.Nhits , i ) ;
+      return FAILURE ;
+    }
     // check sources are all the same
     if( prop[ map[ 0 ] ].Source.type != prop[ map[ i ] ].Source.type ) {
       fprintf( stderr , "%s Caught unequal sources contraction "
@@ -143,17 +143,21 @@ halfspinor_multiply( struct halfspinor *a ,
 
 void
 sigmaB_halfspinor( struct halfspinor *S1 ,
-		   const struct field Fmunu ,
+		   const double complex *Fmunu ,
+		   const size_t i ,
 		   const struct halfspinor S )
 {
+  const double complex *B0 = FMUNU( Fmunu , i , 0 ) ;
+  const double complex *B1 = FMUNU( Fmunu , i , 1 ) ;
+  const double complex *B2 = FMUNU( Fmunu , i , 2 ) ;
   struct halfspinor t1 ;
   // initialise sigma.B into t1
   size_t j ;
   for( j = 0 ; j < NCNC ; j++ ) {
-    t1.D[0][j] =  Fmunu.O[2][j] ;
-    t1.D[1][j] =  Fmunu.O[0][j] - I * Fmunu.O[1][j] ;
-    t1.D[2][j] =  Fmunu.O[0][j] + I * Fmunu.O[1][j] ;
-    t1.D[3][j] = -Fmunu.O[2][j] ;
+    t1.D[0][j] =  B2[j] ;
+    t1.D[1][j] =  B0[j] - I * B1[j] ;
+    t1.D[2][j] =  B0[j] + I * B1[j] ;
+    t1.D[3][j] = -B2[j] ;
   }
   halfspinor_multiply( S1 , t1 , S ) ;
   return ;
@@ -382,15 +382,16 @@ halfspinor_multiply( struct halfspinor *a ,
 
 void
 sigmaB_halfspinor( struct halfspinor *S1 ,
-		   const struct field Fmunu ,
+		   const double complex *Fmunu ,
+		   const size_t i ,
 		   const struct halfspinor S )
 {
   struct halfspinor t1 ;
   
   // initialise sigma.B into t1
-  const __m128d *pF0 = (const __m128d*)Fmunu.O[0] ;
-  const __m128d *pF1 = (const __m128d*)Fmunu.O[1] ;
-  const __m128d *pF2 = (const __m128d*)Fmunu.O[2] ;
+  const __m128d *pF0 = (const __m128d*)FMUNU( Fmunu , i , 0 ) ;
+  const __m128d *pF1 = (const __m128d*)FMUNU( Fmunu , i , 1 ) ;
+  const __m128d *pF2 = (const __m128d*)FMUNU( Fmunu , i , 2 ) ;
   __m128d *pt0 = (__m128d*)t1.D[0] ;
 #if NC == 3
   // t1.D[0]
@@ -414,9 +415,9 @@ sigmaB_halfspinor( struct halfspinor *S1 ,
   *pt0 = _mm_sub_pd( *( pF0 ) , SSE2_iMUL( *( pF1) ) ) ; pt0++ ; pF0++ ; pF1++ ;
   *pt0 = _mm_sub_pd( *( pF0 ) , SSE2_iMUL( *( pF1) ) ) ; pt0++ ; pF0++ ; pF1++ ;
   // t1.D[2]
-  pF0 = (const __m128d*)Fmunu.O[0] ;
-  pF1 = (const __m128d*)Fmunu.O[1] ;
-  pF2 = (const __m128d*)Fmunu.O[2] ;
+  pF0 = (const __m128d*)FMUNU( Fmunu , i , 0 ) ;
+  pF1 = (const __m128d*)FMUNU( Fmunu , i , 1 ) ;
+  pF2 = (const __m128d*)FMUNU( Fmunu , i , 2 ) ;
   *pt0 = _mm_add_pd( *( pF0 ) , SSE2_iMUL( *( pF1 ) ) ) ; pt0++ ; pF0++ ; pF1++ ;
   *pt0 = _mm_add_pd( *( pF0 ) , SSE2_iMUL( *( pF1 ) ) ) ; pt0++ ; pF0++ ; pF1++ ;
   *pt0 = _mm_add_pd( *( pF0 ) , SSE2_iMUL( *( pF1 ) ) ) ; pt0++ ; pF0++ ; pF1++ ;
@@ -24,11 +24,13 @@ int
 mesons_offdiagonal( struct propagator prop1 ,
 		    struct propagator prop2 ,
 		    const struct cut_info CUTINFO ,
+		    const size_t *gammas ,
+		    const size_t ngammas ,
 		    const char *outfile )
 {
   // counters
-  const size_t stride1 = M_CHANNELS ;
-  const size_t stride2 = M_CHANNELS ;
+  const size_t stride1 = ngammas ;
+  const size_t stride2 = ngammas ;
 
   // flat dirac indices are all colors and all single gamma combinations
   const size_t flat_dirac = stride1*stride2 ;
@@ -47,23 +49,28 @@ mesons_offdiagonal( struct propagator prop1 ,
   }
 
   // open the parallel region
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
 #pragma omp parallel
   {
     // loop counters
-    size_t t = 0 , site ;
+    size_t tt = 0 , site ;
     
     // initial read of a timeslice
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
     // smear it if we wish
-    sink_smear( M.S , M.S1 , t , CUTINFO , Nprops ) ;
+    sink_smear( M.S , M.S1 , tstart , CUTINFO , Nprops ) ;
 
     {
        #pragma omp barrier
     }
     
     // Time slice loop 
-    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
 
       // if we are doing nonrel-chiral mesons we switch chiral to nrel      
       rotate_offdiag( M.S , prop , Nprops ) ;
@@ -78,10 +85,13 @@ mesons_offdiagonal( struct propagator prop1 ,
       const size_t tshifted = ( t - prop1.origin[ ND-1 ] + LT ) % LT ;
       
       // master-slave the IO and perform each FFT in parallel
-      if( t < ( LT - 1 ) ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
 
+      // spatial sums by FFT convolution if that is cheaper
+      sum_spatial_conv( &M ) ;
+
       // parallelise the furthest out loop :: flatten the gammas
       #pragma omp for private(site)
       for( site = 0 ; site < LCU ; site++ ) {
@@ -94,15 +104,11 @@ mesons_offdiagonal( struct propagator prop1 ,
 	for( GSGK = 0 ; GSGK < flat_dirac ; GSGK++ ) {
 	  const size_t GSRC = GSGK / stride1 ;
 	  const size_t GSNK = GSGK % stride2 ;
-	  #ifdef TWOPOINT_FILTER
-	  if( !filter[ GSRC ][ GSNK ] ) continue ;
-	  #endif
-	  
-	  const struct gamma gt_GSNKdag_gt = gt_Gdag_gt( M.GAMMAS[ GSNK ] , 
+	  const struct gamma gt_GSNKdag_gt = gt_Gdag_gt( M.GAMMAS[ gammas[ GSNK ] ] , 
 							 M.GAMMAS[ GAMMA_T ] ) ;
 	  M.in[ GSGK ][ site ] = 
 	    meson_contract( gt_GSNKdag_gt    , SUM_r2[1] , 
-			    M.GAMMAS[ GSRC ] , SUM_r2[0] , 
+			    M.GAMMAS[ gammas[ GSRC ] ] , SUM_r2[0] , 
 			    M.GAMMAS[ GAMMA_5 ] ) ;
 	}
       }
@@ -111,16 +117,12 @@ mesons_offdiagonal( struct propagator prop1 ,
       for( GSGK = 0 ; GSGK < flat_dirac ; GSGK++ ) {
 	const size_t GSRC = GSGK / stride1 ;
 	const size_t GSNK = GSGK % stride2 ;
-        #ifdef TWOPOINT_FILTER
-	if( !filter[ GSRC ][ GSNK ] ) continue ;
-	#endif
-
-	const struct gamma gt_GSNKdag_gt = gt_Gdag_gt( M.GAMMAS[ GSNK ] , 
+	const struct gamma gt_GSNKdag_gt = gt_Gdag_gt( M.GAMMAS[ gammas[ GSNK ] ] , 
 						       M.GAMMAS[ GAMMA_T ] ) ;
 	// and contract the walls
 	M.wwcorr[ GSRC ][ GSNK ].mom[ 0 ].C[ tshifted ] =	\
 	  meson_contract( gt_GSNKdag_gt    , M.SUM[1] ,
-			  M.GAMMAS[ GSRC ] , M.SUM[0] ,
+			  M.GAMMAS[ gammas[ GSRC ] ] , M.SUM[0] ,
 			  M.GAMMAS[ GAMMA_5 ] ) ;
       }
 
@@ -128,8 +130,8 @@ mesons_offdiagonal( struct propagator prop1 ,
       compute_correlator( &M , stride1 , stride2 , tshifted ) ;
 
       // smear the forward prop
-      if( t < (LT-1) ) {
-	sink_smear( M.Sf , M.S1 , t+1 , CUTINFO , Nprops ) ;
+      if( tt < LT-1 ) {
+	sink_smear( M.Sf , M.S1 , (t+1)%LT , CUTINFO , Nprops ) ;
       }
       
       #pragma omp single
@@ -138,7 +140,7 @@ mesons_offdiagonal( struct propagator prop1 ,
 	copy_props( &M , Nprops ) ;
 	
 	// status of the computation
-	progress_bar( t , LT ) ;
+	progress_bar( tt , LT ) ;
       }
       // tloop
     }
@@ -148,7 +150,13 @@ mesons_offdiagonal( struct propagator prop1 ,
   if( error_code == FAILURE ) goto memfree ;
   
   // write out the ND-1 momentum-injected correlator
-  write_momcorr_WW( M , outfile , stride1 , stride2 ) ;
+  // a gamma subset only writes the channels it computed
+  uint32_t chan[ M_CHANNELS ] ;
+  if( gamma_channel_list( chan , gammas , ngammas , GLU_FALSE ) == GLU_TRUE ) {
+    write_momcorr_WW_gammas( M , outfile , stride1 , stride2 , chan , chan ) ;
+  } else {
+    write_momcorr_WW( M , outfile , stride1 , stride2 ) ;
+  }
 
   // memory freeing part
  memfree :
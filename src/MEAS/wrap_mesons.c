@@ -26,26 +26,46 @@ contract_mesons( struct propagator *prop ,
 
     // check origins are the same and plaquettes are the same
     if( sanity_check_props( prop , mesons[ measurements ].map ,
-			    2 , "[MESONS]" ) == FAILURE ) {
+			    2 , "[MESONS]" , GLU_TRUE ) == FAILURE ) {
       return FAILURE ;
     }
 
-    // flavour diagonal meson
-    if( p1 == p2 ) {
-      if( mesons_diagonal( prop[ p1 ] , CUTINFO , 
-			   mesons[ measurements ].outfile ) == FAILURE ) {
-	return FAILURE ;
+    // noise props are contracted hit by hit, each hit to its own file
+    const size_t Nhits = prop[ p1 ].Source.Nhits > prop[ p2 ].Source.Nhits ?
+      prop[ p1 ].Source.Nhits : prop[ p2 ].Source.Nhits ;
+    size_t hit ;
+    for( hit = 0 ; hit < Nhits ; hit++ ) {
+      char outfile[ 256+32 ] ;
+      if( Nhits > 1 ) {
+	sprintf( outfile , "%s.hit%zu" , mesons[ measurements ].outfile , hit ) ;
+      } else {
+	sprintf( outfile , "%s" , mesons[ measurements ].outfile ) ;
       }
-      if( reread_propheaders( &prop[ p1 ] ) == FAILURE ) { return FAILURE ; }
-    } else {
-      // otherwise we plough on
-      if( mesons_offdiagonal( prop[ p1 ] , prop[ p2 ] , CUTINFO , 
-			      mesons[ measurements ].outfile ) == FAILURE ) {
-	return FAILURE ;
+      prop[ p1 ].hit = prop[ p1 ].Source.Nhits > 1 ? hit : 0 ;
+      prop[ p2 ].hit = prop[ p2 ].Source.Nhits > 1 ? hit : 0 ;
+
+      // flavour diagonal meson
+      if( p1 == p2 ) {
+	if( mesons_diagonal( prop[ p1 ] , CUTINFO ,
+			     mesons[ measurements ].gammas ,
+			     mesons[ measurements ].ngammas ,
+			     outfile ) == FAILURE ) {
+	  return FAILURE ;
+	}
+	if( reread_propheaders( &prop[ p1 ] ) == FAILURE ) { return FAILURE ; }
+      } else {
+	// otherwise we plough on
+	if( mesons_offdiagonal( prop[ p1 ] , prop[ p2 ] , CUTINFO ,
+				mesons[ measurements ].gammas ,
+				mesons[ measurements ].ngammas ,
+				outfile ) == FAILURE ) {
+	  return FAILURE ;
+	}
+	if( reread_propheaders( &prop[ p1 ] ) == FAILURE ) { return FAILURE ; }
+	if( reread_propheaders( &prop[ p2 ] ) == FAILURE ) { return FAILURE ; }
       }
-      if( reread_propheaders( &prop[ p1 ] ) == FAILURE ) { return FAILURE ; }
-      if( reread_propheaders( &prop[ p2 ] ) == FAILURE ) { return FAILURE ; }
     }
+    prop[ p1 ].hit = prop[ p2 ].hit = 0 ;
     // loop on measurements
     print_time( ) ;
   }
@@ -76,10 +76,23 @@ Hermitian_proj( double complex Q[ NCNC ] ,
   return ;
 }
 
+// link mu of the lattice site s in the improved copy U, which starts
+// at the site index off and wraps round the time direction
+static inline const double complex *
+ulink( const double complex *U ,
+       const size_t off ,
+       const size_t s ,
+       const size_t mu )
+{
+  const size_t k = ( s >= off ) ? s - off : s + LVOLUME - off ;
+  return U + ( k*ND + mu )*NCNC ;
+}
+
 // does what it says and computes the clover
 static void
 compute_clover( double complex *F ,
-		const struct site *lat ,
+		const double complex *U ,
+		const size_t off ,
 		const size_t i ,
 		const size_t mu ,
 		const size_t nu )
@@ -93,33 +106,37 @@ compute_clover( double complex *F ,
   // top right
   s1 = lat[i].neighbor[mu] ;
   s2 = lat[i].neighbor[nu] ;
-  multab( (void*)u , (void*)lat[i].O[mu] , (void*)lat[s1].O[nu] ) ;
-  multab_dag( (void*)v , (void*)u , (void*)lat[s2].O[mu] ) ;
-  multab_dag( (void*)sum , (void*)v , (void*)lat[i].O[nu] ) ;
+  multab( (void*)u , (void*)ulink( U , off , i , mu ) ,
+	  (void*)ulink( U , off , s1 , nu ) ) ;
+  multab_dag( (void*)v , (void*)u , (void*)ulink( U , off , s2 , mu ) ) ;
+  multab_dag( (void*)sum , (void*)v , (void*)ulink( U , off , i , nu ) ) ;
 
   // bottom right
   s1 = lat[i].back[nu] ;
   s2 = lat[s1].neighbor[mu] ;
-  multabdag( (void*)u , (void*)lat[s1].O[nu] , (void*)lat[s1].O[mu] ) ;
-  multab( (void*)v , (void*)u , (void*)lat[s2].O[nu] ) ;
-  multab_dag( (void*)u , (void*)v , (void*)lat[i].O[mu] ) ;
+  multabdag( (void*)u , (void*)ulink( U , off , s1 , nu ) ,
+	     (void*)ulink( U , off , s1 , mu ) ) ;
+  multab( (void*)v , (void*)u , (void*)ulink( U , off , s2 , nu ) ) ;
+  multab_dag( (void*)u , (void*)v , (void*)ulink( U , off , i , mu ) ) ;
   add_mat( (void*)sum , (void*)u ) ;
 
   // bottom left
   s1 = lat[i].back[mu] ;
   s2 = lat[s1].back[nu] ;
   s3 = lat[i].back[nu] ;
-  multab_dagdag( (void*)u , (void*)lat[s1].O[mu] , (void*)lat[s2].O[nu] ) ;
-  multab( (void*)v , (void*)u , (void*)lat[s2].O[mu] ) ;
-  multab( (void*)u , (void*)v , (void*)lat[s3].O[nu] ) ;
+  multab_dagdag( (void*)u , (void*)ulink( U , off , s1 , mu ) ,
+		 (void*)ulink( U , off , s2 , nu ) ) ;
+  multab( (void*)v , (void*)u , (void*)ulink( U , off , s2 , mu ) ) ;
+  multab( (void*)u , (void*)v , (void*)ulink( U , off , s3 , nu ) ) ;
   add_mat( (void*)sum , (void*)u ) ;
 
   // top left
   s2 = lat[i].back[mu] ;
   s1 = lat[s2].neighbor[nu] ;
-  multab_dag( (void*)u , (void*)lat[i].O[nu] , (void*)lat[s1].O[mu] ) ;
-  multab_dag( (void*)v , (void*)u , (void*)lat[s2].O[nu] ) ;
-  multab( (void*)u , (void*)v , (void*)lat[s2].O[mu] ) ;
+  multab_dag( (void*)u , (void*)ulink( U , off , i , nu ) ,
+	      (void*)ulink( U , off , s1 , mu ) ) ;
+  multab_dag( (void*)v , (void*)u , (void*)ulink( U , off , s2 , nu ) ) ;
+  multab( (void*)u , (void*)v , (void*)ulink( U , off , s2 , mu ) ) ;
   add_mat( (void*)sum , (void*)u ) ;
 
   // clover norm, apparently a convention is to give this a minus sign
@@ -136,7 +153,8 @@ compute_clover( double complex *F ,
 // computes the improved clover of lepage and magnea
 static void
 improve_clover( double complex *res ,
-		const struct site *lat ,
+		const double complex *U ,
+		const size_t off ,
 		const size_t i ,
 		const size_t mu ,
 		const size_t nu ,
@@ -149,34 +167,34 @@ improve_clover( double complex *res ,
   double complex Edn[ NCNC ]   __attribute__((aligned(ALIGNMENT)));
   
   // standard clover term
-  compute_clover( res , lat , i , mu , nu ) ;
+  compute_clover( res , U , off , i , mu , nu ) ;
   
   zero_colormatrix( sum ) ;
 
   // mu index contributions
   const size_t bck_mu = lat[i].back[mu] ;
-  compute_clover( Eup , lat , lat[i].neighbor[mu] , mu , nu ) ;
-  compute_clover( Edn , lat , lat[i].back[mu] , mu , nu ) ;
+  compute_clover( Eup , U , off , lat[i].neighbor[mu] , mu , nu ) ;
+  compute_clover( Edn , U , off , bck_mu , mu , nu ) ;
   
-  multab_dag( (void*)temp1 , (void*)Eup , (void*)lat[i].O[mu] ) ;
-  multab( (void*)temp2 , (void*)lat[i].O[mu] , (void*)temp1 ) ;
+  multab_dag( (void*)temp1 , (void*)Eup , (void*)ulink( U , off , i , mu ) ) ;
+  multab( (void*)temp2 , (void*)ulink( U , off , i , mu ) , (void*)temp1 ) ;
   add_mat( (void*)sum , (void*)temp2 ) ;
   
-  multab( (void*)temp1 , (void*)Edn , (void*)lat[bck_mu].O[mu] ) ;
-  multabdag( (void*)temp2 , (void*)lat[bck_mu].O[mu] , (void*)temp1 ) ; 
+  multab( (void*)temp1 , (void*)Edn , (void*)ulink( U , off , bck_mu , mu ) ) ;
+  multabdag( (void*)temp2 , (void*)ulink( U , off , bck_mu , mu ) , (void*)temp1 ) ; 
   add_mat( (void*)sum , (void*)temp2 ) ;
 
   // now do the nu index
   const size_t bck_nu = lat[i].back[nu] ;
-  compute_clover( Eup , lat , lat[i].neighbor[nu] , mu , nu ) ;
-  compute_clover( Edn , lat , bck_nu , mu , nu ) ;
+  compute_clover( Eup , U , off , lat[i].neighbor[nu] , mu , nu ) ;
+  compute_clover( Edn , U , off , bck_nu , mu , nu ) ;
   
-  multab_dag( (void*)temp1 , (void*)Eup , (void*)lat[i].O[nu] ) ;
-  multab( (void*)temp2 , (void*)lat[i].O[nu] , (void*)temp1 ) ;
+  multab_dag( (void*)temp1 , (void*)Eup , (void*)ulink( U , off , i , nu ) ) ;
+  multab( (void*)temp2 , (void*)ulink( U , off , i , nu ) , (void*)temp1 ) ;
   add_mat( (void*)sum , (void*)temp2 ) ;
   
-  multab( (void*)temp1 , (void*)Edn , (void*)lat[bck_nu].O[nu] ) ;
-  multabdag( (void*)temp2 , (void*)lat[bck_nu].O[nu] , (void*)temp1 ) ; 
+  multab( (void*)temp1 , (void*)Edn , (void*)ulink( U , off , bck_nu , nu ) ) ;
+  multabdag( (void*)temp2 , (void*)ulink( U , off , bck_nu , nu ) , (void*)temp1 ) ; 
   add_mat( (void*)sum , (void*)temp2 ) ;
 
   // improve the clover fields
@@ -189,39 +207,48 @@ improve_clover( double complex *res ,
 
 // computes the E and B fields needed in the NRQCD action
 void
-compute_clovers( struct NRQCD_fields *F ,
-		 const struct site *lat ,
-		 const size_t t ,
-		 const double U_0 )
+compute_clovers( double complex *Fmunu ,
+		 const struct NRQCD_links *L ,
+		 const size_t t )
 {
   // e-clover factor, second term is to correct for the non-unitary ness
-  const double efac = ( 4. + 1./( U_0 * U_0 ) ) / 3. ;
+  const double efac = ( 4. + 1./( L -> U0 * L -> U0 ) ) / 3. ;
+
+  // the improved links start at this site index
+  const double complex *U = L -> U ;
+  const size_t off = LCU*( L -> first ) ;
   
   const size_t idx = LCU*t ;
   size_t i ;
   #pragma omp for private(i)
   for( i = 0 ; i < LCU ; i++ ) {
     // B fields are defined as B_{i} = \epsilon_{ijk} F_{jk}
-    improve_clover( F -> Fmunu[i].O[0] , lat , i + idx , 1 , 2 , efac ) ;
-    improve_clover( F -> Fmunu[i].O[1] , lat , i + idx , 2 , 0 , efac ) ;
-    improve_clover( F -> Fmunu[i].O[2] , lat , i + idx , 0 , 1 , efac ) ;
+    improve_clover( FMUNU( Fmunu , i , 0 ) , U , off , i + idx , 1 , 2 , efac ) ;
+    improve_clover( FMUNU( Fmunu , i , 1 ) , U , off , i + idx , 2 , 0 , efac ) ;
+    improve_clover( FMUNU( Fmunu , i , 2 ) , U , off , i + idx , 0 , 1 , efac ) ;
     // E fields are defined as E_{i} = F_{t i}
-    improve_clover( F -> Fmunu[i].O[3] , lat , i + idx , 3 , 0 , efac ) ;
-    improve_clover( F -> Fmunu[i].O[4] , lat , i + idx , 3 , 1 , efac ) ;
-    improve_clover( F -> Fmunu[i].O[5] , lat , i + idx , 3 , 2 , efac ) ;
+    improve_clover( FMUNU( Fmunu , i , 3 ) , U , off , i + idx , 3 , 0 , efac ) ;
+    improve_clover( FMUNU( Fmunu , i , 4 ) , U , off , i + idx , 3 , 1 , efac ) ;
+    improve_clover( FMUNU( Fmunu , i , 5 ) , U , off , i + idx , 3 , 2 , efac ) ;
     // these last ones are used in the improved derivative
+    const size_t Uidx = i + idx ;
     size_t mu ;
     for( mu = 0 ; mu < ND-1 ; mu++ ) {
-      const size_t Uidx = i + t*LCU ;
       const size_t Ufwd = lat[ Uidx ].neighbor[mu] ;
       const size_t Ubck = lat[ Uidx ].back[mu] ;
       const size_t Ubck2 = lat[ Ubck ].back[mu] ;
-      multab( (void*)F -> Fmunu[i].O[6+2*mu] , (void*)lat[ Uidx ].O[mu] , (void*)lat[ Ufwd ].O[mu] ) ;
-      multab( (void*)F -> Fmunu[i].O[7+2*mu] , (void*)lat[ Ubck2 ].O[mu] , (void*)lat[ Ubck ].O[mu] ) ;
+      multab( (void*)FMUNU( Fmunu , i , 6+2*mu ) , (void*)ulink( U , off , Uidx , mu ) ,
+	      (void*)ulink( U , off , Ufwd , mu ) ) ;
+      multab( (void*)FMUNU( Fmunu , i , 7+2*mu ) , (void*)ulink( U , off , Ubck2 , mu ) ,
+	      (void*)ulink( U , off , Ubck , mu ) ) ;
+      colormatrix_equiv( FMUNU( Fmunu , i , FMUNU_LINK+mu ) , ulink( U , off , Uidx , mu ) ) ;
     }
+    // temporal links out of and into this timeslice
+    colormatrix_equiv( FMUNU( Fmunu , i , FMUNU_LINK+ND-1 ) ,
+		       ulink( U , off , Uidx , ND-1 ) ) ;
+    colormatrix_equiv( FMUNU( Fmunu , i , FMUNU_LINK+ND ) ,
+		       ulink( U , off , lat[ Uidx ].back[ND-1] , ND-1 ) ) ;
   }
   
   return ;
 }
-
-
@@ -2,14 +2,15 @@
    @file evolve.c
    @brief evolve the NRQCD action
  */
-#define _GNU_SOURCE // sincos
-
 #include "common.h"
 
-#include "clover.h"           // O(a^2) improved clover
 #include "geometry.h"
+#include "evolve_f.h"         // evolve_H_f() ..
 #include "GLU_timer.h"        // tells us how long it takes
+#include "grad.h"             // grad_imp()
+#include "grad_2.h"           // gradsq() and gradsq_imp()
 #include "halfspinor_ops.h"   // halfspinor_Saxpy
+#include "improved_links.h"   // NRQCD_clovers()
 #include "matrix_ops.h"       // colormatrix_*
 #include "mmul.h"             // multabs
 #include "progress_bar.h"     // show the progress bar
@@ -17,7 +18,7 @@
 #include "spin_dependent.h"   // spin-dependent NRQCD terms
 #include "spin_independent.h" // spin-independent NRQCD terms
 
-// for the tadpole improvement
+// for the inlined C0 term
 #ifdef HAVE_IMMINTRIN_H
   #include "SSE2_OPS.h"
 
@@ -91,25 +92,27 @@ C0_term( double complex *H ,
 
 #endif
 
-// inline mu loop macro for unrolling
+// inline mu loop macro for unrolling, the links are loaded once
+// and applied to all of the sources in the batch
 #define inline__mu_C0(mu)					\
   Sfwd = lat[ i ].neighbor[mu] ;				\
   Sbck = lat[ i ].back[mu] ;					\
-  Ubck = lat[ Uidx ].back[mu] ;					\
-  dagger_gauge( C , (void*)lat[ Ubck ].O[mu] ) ;		\
-  colormatrix_halfspinor( (void*)A.D ,				\
-			  (const void*)lat[ Uidx ].O[mu] ,	\
-			  (const void*)F -> S[ Sfwd ].D ) ;	\
-  colormatrix_halfspinor( (void*)B.D , C ,			\
-			  (const void*)F -> S[ Sbck ].D ) ;	\
-  C0_term( (void*)F ->H[i].D , (void*)A.D , (void*)B.D ,	\
-	   (void*)F ->S[i].D , C0 ) ;				\
-
-// so in principle this could be checkerboarded and the
-// whole LCU loop could be done in this level in parallel
+  dagger_gauge( C , (void*)FMUNU( F -> Fmunu , Sbck , FMUNU_LINK+mu ) ) ; \
+  for( n = 0 ; n < F -> Nsrc ; n++ ) {				\
+    const size_t off = n*LCU ;					\
+    colormatrix_halfspinor( (void*)A.D ,			\
+			    (const void*)FMUNU( F -> Fmunu , i , FMUNU_LINK+mu ) , \
+			    (const void*)F -> S[ Sfwd+off ].D ) ;	\
+    colormatrix_halfspinor( (void*)B.D , C ,			\
+			    (const void*)F -> S[ Sbck+off ].D ) ;	\
+    C0_term( (void*)F ->H[i+off].D , (void*)A.D , (void*)B.D ,	\
+	     (void*)F ->S[i+off].D , C0 ) ;				\
+  }								\
+
+// sites are visited tile by tile so the neighbours of one site are
+// mostly still in cache from the ones before it
 static void
 evolve_H( struct NRQCD_fields *F ,
-	  const size_t t ,
 	  const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C0 ) < NRQCD_TOL ) return ;
@@ -118,9 +121,10 @@ evolve_H( struct NRQCD_fields *F ,
 
   // simplest hamiltonian term first \grad^2 / 2M_0
   // grad^2 is inlined from derivs.c
-  size_t i ;
-  #pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
+  size_t k ;
+  #pragma omp for private(k)
+  for( k = 0 ; k < LCU ; k++ ) {
+    const size_t i = F -> order[k] ;
 
     // temporary storage matrices
     struct halfspinor A , B ;
@@ -130,11 +134,12 @@ evolve_H( struct NRQCD_fields *F ,
     double complex C[ NCNC ] ;
     #endif
     
-    const size_t Uidx = i + t*LCU ;
-    size_t Sfwd , Sbck , Ubck ;
+    size_t Sfwd , Sbck , n ;
     
     // set hamiltonian storage to zero
-    zero_halfspinor( &F -> H[i] ) ;
+    for( n = 0 ; n < F -> Nsrc ; n++ ) {
+      zero_halfspinor( &F -> H[i+n*LCU] ) ;
+    }
 
     // inner mu sum much more cache friendly
     #if ND==4
@@ -148,10 +153,13 @@ evolve_H( struct NRQCD_fields *F ,
     }
     #endif
 
-    // set S1 to S
-    F -> S1[i] = F -> S[i] ;
-    // S1 = S1 - H/(2n)
-    halfspinor_Saxpy( &F -> S1[i] , F -> H[i] , -1./(2*NRQCD.N) ) ;
+    for( n = 0 ; n < F -> Nsrc ; n++ ) {
+      const size_t j = i + n*LCU ;
+      // set S1 to S
+      F -> S1[j] = F -> S[j] ;
+      // S1 = S1 - H/(2n)
+      halfspinor_Saxpy( &F -> S1[j] , F -> H[j] , -1./(2*NRQCD.N) ) ;
+    }
   }
 
   // shallow pointer swap
@@ -165,181 +173,297 @@ evolve_H( struct NRQCD_fields *F ,
   return ;
 }
 
-// applies the hamiltonian s.t. S = ( 1 - dH ) S
+// the NRQCD.N applications of the kinetic term in double precision
 static void
-evolve_dH( struct NRQCD_fields *F ,
-	   const size_t t ,
-	   const struct NRQCD_params NRQCD )
+evolve_kinetic( struct NRQCD_fields *F ,
+		const struct NRQCD_params NRQCD )
+{
+  size_t n ;
+  for( n = 0 ; n < NRQCD.N ; n++ ) {
+    evolve_H( F , NRQCD ) ;
+  }
+  return ;
+}
+
+// multiplies S by U_t(x)^dagger going forward or by U_t(x-t) going
+// backward, flip is set when we pass through an antiperiodic boundary
+static void
+temporal_link( struct NRQCD_fields *F ,
+	       const GLU_bool backward ,
+	       const GLU_bool flip )
 {
+  const size_t mu = ( backward == GLU_TRUE ) ? FMUNU_LINK+ND : FMUNU_LINK+ND-1 ;
   size_t i ;
-#pragma omp for private(i)
+  #pragma omp for private(i)
   for( i = 0 ; i < LCU ; i++ ) {
-    zero_halfspinor( &F -> H[i] ) ;
-  
-    // atomically accumulate result into F -> H
-    term_C1_C6( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
-
-    term_C2( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
-
-    term_C3( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
-
-    term_C4( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
-
-    term_C5( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
-
-    term_C7( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
-
-    term_C9EB( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    double complex U[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
+    colormatrix_equiv( U , FMUNU( F -> Fmunu , i , mu ) ) ;
+    // passing through a boundary flips the sign of the t-links
+    size_t j , n ;
+    if( flip == GLU_TRUE ) {
+      for( j = 0 ; j < NCNC ; j++ ) {
+	U[j] = -U[j] ;
+      }
+    }
+    for( n = 0 ; n < F -> Nsrc ; n++ ) {
+      struct halfspinor res ;
+      if( backward == GLU_TRUE ) {
+	colormatrix_halfspinor( (void*)res.D , (const void*)U ,
+				(const void*)F -> S[i+n*LCU].D ) ;
+      } else {
+	colormatrixdag_halfspinor( (void*)res.D , U , F -> S[i+n*LCU] ) ;
+      }
+      F -> S[i+n*LCU] = res ;
+    }
+  }
+  return ;
+}
 
-    term_C10EB( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+// put the clovers of timeslice t into F -> Fmunu and, if we evolve
+// in single precision, its links into F -> Uf
+static void
+set_clovers( struct NRQCD_fields *F ,
+	     struct NRQCD_links *L ,
+	     const size_t t ,
+	     const struct NRQCD_params NRQCD )
+{
+  NRQCD_clovers( F -> Fmunu , L , t ) ;
+  if( NRQCD.PRECISION == SINGLE ) {
+    links_to_split( F ) ;
   }
+  return ;
+}
 
-  // these three are really tricky to loop-fuse into the above
-  term_C8( F , t , NRQCD ) ;
-  term_C11( F , t , NRQCD ) ;
+// do any of the terms in this hamiltonian have coefficient c?
+#define HAS(c) ( fabs( NRQCD.c ) > NRQCD_TOL )
 
-#pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
-    #ifdef NRQCD_NONSYM
-    halfspinor_Saxpy( &F -> S[i] , F -> H[i] , -1. ) ;
-    #else
-    halfspinor_Saxpy( &F -> S[i] , F -> H[i] , -0.5 ) ;
-    #endif
+// the derivative caches of source n in the batch
+static struct NRQCD_derivs
+derivs_src( const struct NRQCD_derivs *D ,
+	    const size_t n )
+{
+  struct NRQCD_derivs Dn = *D ;
+  size_t mu ;
+  for( mu = 0 ; mu < ND-1 ; mu++ ) {
+    Dn.grad[mu] = ( D -> grad[mu] != NULL ) ? D -> grad[mu] + n*LCU : NULL ;
   }
+  Dn.lapl     = ( D -> lapl != NULL )     ? D -> lapl + n*LCU     : NULL ;
+  Dn.lapl2    = ( D -> lapl2 != NULL )    ? D -> lapl2 + n*LCU    : NULL ;
+  Dn.lapl_imp = ( D -> lapl_imp != NULL ) ? D -> lapl_imp + n*LCU : NULL ;
+  Dn.sigmaB   = ( D -> sigmaB != NULL )   ? D -> sigmaB + n*LCU   : NULL ;
+  return Dn ;
+}
 
+// the derivatives of S at site i that the terms share, C8 also
+// wants sigma.( grad x E - E x grad ) S in S1 for its neighbours
+static void
+site_derivs( struct NRQCD_fields *F ,
+	     const size_t i ,
+	     const struct NRQCD_params NRQCD )
+{
+  size_t n , mu ;
+  for( n = 0 ; n < F -> Nsrc ; n++ ) {
+    const struct NRQCD_derivs Dn = derivs_src( &F -> D , n ) ;
+    const struct halfspinor *S = F -> S + n*LCU ;
+
+    if( HAS(C2) || HAS(C3) || HAS(C8) ) {
+      for( mu = 0 ; mu < ND-1 ; mu++ ) {
+	grad_imp( &Dn.grad[mu][i] , S , F -> Fmunu , NRQCD.U0 , i , mu ) ;
+      }
+    }
+    if( HAS(C1) || HAS(C6) || HAS(C11) ) {
+      gradsq( &Dn.lapl[i] , S , F -> Fmunu , i ) ;
+    }
+    if( HAS(C7) || HAS(C8) ) {
+      gradsq_imp( &Dn.lapl_imp[i] , S , F -> Fmunu , i ) ;
+    }
+    if( HAS(C4) || HAS(C7) ) {
+      sigmaB_halfspinor( &Dn.sigmaB[i] , F -> Fmunu , i , S[i] ) ;
+    }
+    if( HAS(C8) ) {
+      sigma_gradxE( &F -> S1[i+n*LCU] , F -> Fmunu , S , &Dn ,
+		    NRQCD.U0 , i ) ;
+    }
+  }
   return ;
 }
 
-// applies the hamiltonian s.t. S = ( 1 - dH ) S
+// the spin-dependent terms for all sources at site i, Fmunu[i] and
+// its neighbours stay in cache for the whole batch
 static void
-evolve_dH_fused( struct NRQCD_fields *F ,
-		 const size_t t ,
-		 const struct NRQCD_params NRQCD )
+site_dH( struct NRQCD_fields *F ,
+	 const size_t i ,
+	 const struct NRQCD_params NRQCD )
 {
-  size_t i ;
-#pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
-    zero_halfspinor( &F -> H[i] ) ;
-  
+  size_t n ;
+  for( n = 0 ; n < F -> Nsrc ; n++ ) {
+    struct halfspinor *H = F -> H + i + n*LCU ;
+    const struct halfspinor *S = F -> S + n*LCU ;
+    const struct NRQCD_derivs Dn = derivs_src( &F -> D , n ) ;
+
+    // grad^2 of the cached laplacian for C1, C6 and C11
+    if( HAS(C1) || HAS(C6) || HAS(C11) ) {
+      gradsq( &Dn.lapl2[i] , Dn.lapl , F -> Fmunu , i ) ;
+    }
+
+    zero_halfspinor( H ) ;
+
     // atomically accumulate result into F -> H
-    term_C1_C6( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C1_C6( H , S , &Dn , i , NRQCD ) ;
 
-    term_C2( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C2( H , S , &Dn , F -> Fmunu , i , NRQCD ) ;
 
-    term_C3( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C3( H , S , &Dn , F -> Fmunu , i , NRQCD ) ;
 
-    term_C4( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C4( H , &Dn , i , NRQCD ) ;
 
-    term_C5( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C5( H , S , F -> Fmunu , i , NRQCD ) ;
 
-    term_C7( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C7( H , &Dn , F -> Fmunu , i , NRQCD ) ;
 
-    term_C9EB( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C9EB( H , S , F -> Fmunu , i , NRQCD ) ;
 
-    term_C10EB( &F -> H[i] , F -> S , F -> Fmunu , i , t , NRQCD ) ;
+    term_C10EB( H , S , F -> Fmunu , i , NRQCD ) ;
 
-    // set S1 to S
-    F -> S1[i] = F -> S[i] ;
-    #ifdef NRQCD_NONSYM
-    halfspinor_Saxpy( &F -> S1[i] , F -> H[i] , -1. ) ;
-    #else
-    halfspinor_Saxpy( &F -> S1[i] , F -> H[i] , -0.5 ) ;
-    #endif
+    term_C8( H , F -> S1 + n*LCU , &Dn , F -> Fmunu , i , NRQCD ) ;
   }
+  return ;
+}
+
+// applies the hamiltonian s.t. S = ( 1 - dH ) S, the derivatives
+// of S are computed once and shared between the terms
+static void
+evolve_dH( struct NRQCD_fields *F ,
+	   const struct NRQCD_params NRQCD )
+{
+  #ifdef NRQCD_NONSYM
+  const double fac = -1. ;
+  #else
+  const double fac = -0.5 ;
+  #endif
   
-  // shallow pointer swap
-#pragma omp single
-  {
-    struct halfspinor *P = F -> S ;
-    F -> S = F -> S1 ;
-    F -> S1 = P ;
+  size_t k ;
+#pragma omp for private(k)
+  for( k = 0 ; k < LCU ; k++ ) {
+    const size_t i = F -> order[k] ;
+    site_derivs( F , i , NRQCD ) ;
   }
-  
+
+  // without C8 or C11 the update can go in the same loop as dH
+  if( !HAS(C8) && !HAS(C11) ) {
+    #pragma omp for private(k)
+    for( k = 0 ; k < LCU ; k++ ) {
+      const size_t i = F -> order[k] ;
+      site_dH( F , i , NRQCD ) ;
+      size_t n ;
+      for( n = 0 ; n < F -> Nsrc ; n++ ) {
+	const size_t j = i + n*LCU ;
+	// set S1 to S
+	F -> S1[j] = F -> S[j] ;
+	halfspinor_Saxpy( &F -> S1[j] , F -> H[j] , fac ) ;
+      }
+    }
+    // shallow pointer swap
+    #pragma omp single
+    {
+      struct halfspinor *P = F -> S ;
+      F -> S = F -> S1 ;
+      F -> S1 = P ;
+    }
+    return ;
+  }
+
+#pragma omp for private(k)
+  for( k = 0 ; k < LCU ; k++ ) {
+    const size_t i = F -> order[k] ;
+    site_dH( F , i , NRQCD ) ;
+  }
+
+  // C11 reaches a site further than the rest, nothing reads
+  // the neighbours of S from here so it is updated in place
+#pragma omp for private(k)
+  for( k = 0 ; k < LCU ; k++ ) {
+    const size_t i = F -> order[k] ;
+    size_t n ;
+    for( n = 0 ; n < F -> Nsrc ; n++ ) {
+      const size_t j = i + n*LCU ;
+      const struct NRQCD_derivs Dn = derivs_src( &F -> D , n ) ;
+      term_C11( &F -> H[j] , &Dn , F -> Fmunu , i , NRQCD ) ;
+      halfspinor_Saxpy( &F -> S[j] , F -> H[j] , fac ) ;
+    }
+  }
+
+  return ;
+}
+
+#undef HAS
+
+// one timestep from the clovers of this timeslice to those of tnew,
+// in single precision S and the links stay split and in float from
+// the end of the first spin-dependent half step to the start of the
+// second one
+static void
+nrqcd_step( struct NRQCD_fields *F ,
+	    struct NRQCD_links *L ,
+	    const size_t tnew ,
+	    const struct NRQCD_params NRQCD ,
+	    const GLU_bool backward ,
+	    const GLU_bool flip )
+{
+  // only evolve the spin-dependent terms a little bit
+  evolve_dH( F , NRQCD ) ;
+
+  if( NRQCD.PRECISION == SINGLE ) {
+    halfspinors_to_split( F ) ;
+    evolve_H_f( F , NRQCD ) ;
+    temporal_link_f( F , backward , flip ) ;
+    set_clovers( F , L , tnew , NRQCD ) ;
+    evolve_H_f( F , NRQCD ) ;
+    split_to_halfspinors( F ) ;
+  } else {
+    // evolve just with C0 term
+    evolve_kinetic( F , NRQCD ) ;
+    // mutliply by temporal link
+    temporal_link( F , backward , flip ) ;
+    set_clovers( F , L , tnew , NRQCD ) ;
+    evolve_kinetic( F , NRQCD ) ;
+  }
+
+#ifndef NRQCD_NONSYM
+  // finally evolve the spin-dependent terms a little bit
+  evolve_dH( F , NRQCD ) ;
+#endif
   return ;
 }
 
 // writes out the result to S which is a LCU halfspinor
 static int
 nrqcd_prop_fwd( struct NRQCD_fields *F ,
+		struct NRQCD_links *L ,
 		const size_t t ,
 		const struct NRQCD_params NRQCD ,
-		const GLU_bool fuse_dH ,
 		const boundaries boundary )
 {
   // forward time
   const size_t tfwd = (t+LT+1)%Latt.dims[ND-1] ;
-  
-  // loop power of NRQCD.N we apply the hamiltonian
-  size_t n , i ;
 
-  // only evolve the spin-dependent terms a little bit
-  if( fuse_dH == GLU_TRUE ) {
-    evolve_dH_fused( F , t , NRQCD ) ;
-  } else {
-    evolve_dH( F , t , NRQCD ) ;
-  }
-  
-  // evolve just with C0 term
-  for( n = 0 ; n < NRQCD.N ; n++ ) {
-    evolve_H( F , t , NRQCD ) ;
-  }
+  // passes through a boundary and flips sign
+  const GLU_bool flip = ( tfwd < t && boundary == ANTIPERIODIC ) ?
+    GLU_TRUE : GLU_FALSE ;
 
-  // mutliply by temporal link and put in temporary S1
-  if( tfwd < t && boundary == ANTIPERIODIC ) {
-    #pragma omp for private(i)
-    for( i = 0 ; i < LCU ; i++ ) {    
-      const size_t idx = i + t*LCU ;
-      double complex U[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
-      colormatrix_equiv( U , lat[idx].O[ ND-1 ] ) ;      
-      // passes through a boundary and flips sign
-      size_t j ;
-      for( j = 0 ; j < NCNC ; j++ ) {
-	U[j] = -U[j] ;
-      }
-      struct halfspinor res ;
-      colormatrixdag_halfspinor( (void*)res.D ,U , F -> S[i] ) ;
-      F -> S[i] = res ;
-    }
-  } else {
-    #pragma omp for private(i)
-    for( i = 0 ; i < LCU ; i++ ) {    
-      const size_t idx = i + t*LCU ;
-      struct halfspinor res ;
-      colormatrixdag_halfspinor( (void*)res.D , lat[idx].O[ND-1] ,
-				 F -> S[i] ) ;
-      F -> S[i] = res ;
-    }
-  }
-  // update the clovers
-  compute_clovers( F , lat , tfwd , NRQCD.U0 ) ;
-  
-  for( n = 0 ; n < NRQCD.N ; n++ ) {
-    evolve_H( F , tfwd , NRQCD ) ;
-  }
+  nrqcd_step( F , L , tfwd , NRQCD , GLU_FALSE , flip ) ;
 
-#ifndef NRQCD_NONSYM
-  // finally evolve the spin-dependent terms a little bit
-  if( fuse_dH == GLU_TRUE ) {
-    evolve_dH_fused( F , tfwd , NRQCD ) ;
-  } else {
-    evolve_dH( F , tfwd , NRQCD ) ;
-  }
-#endif
-  
   return SUCCESS ;
 }
 
 // writes out the result to S which is a LCU halfspinor
 static int
 nrqcd_prop_bwd( struct NRQCD_fields *F ,
+		struct NRQCD_links *L ,
 		const size_t t ,
 		const struct NRQCD_params NRQCD ,
-		const GLU_bool fuse_dH ,
 		const boundaries boundary )
 {  
-  // loop power of NRQCD.N we apply the hamiltonian
-  size_t n , i ;
-
   // when we go backwards the E-field gets flipped.
   // can change this just by the parameters C_2
   // and C_3 as they are the only ones that depend on E
@@ -347,190 +471,53 @@ nrqcd_prop_bwd( struct NRQCD_fields *F ,
   NRQCD_flipped.C2 *= -1 ;
   NRQCD_flipped.C3 *= -1 ;
 
-  // only evolve the spin-dependent terms a little bit
-  if( fuse_dH == GLU_TRUE ) {
-    evolve_dH_fused( F , t , NRQCD_flipped ) ;
-  } else {
-    evolve_dH( F , t , NRQCD_flipped ) ;
-  }
-  
-  for( n = 0 ; n < NRQCD.N ; n++ ) {
-    evolve_H( F , t , NRQCD_flipped ) ;
-  }
-
   const size_t tbck = (t+LT-1)%LT ;
 
-  // mutliply by temporal link with appropriate boundary sign
-  if( tbck > t && boundary == ANTIPERIODIC ) {    
-    #pragma omp for private(i)
-    for( i = 0 ; i < LCU ; i++ ) {
-      const size_t idx = lat[i+t*LCU].back[ ND-1 ] ;    
-      double complex U[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
-      colormatrix_equiv( U , lat[idx].O[ ND-1 ] ) ;
-      // passing through a boundary flips sign of t-links
-      size_t j ;
-      for( j = 0 ; j < NCNC ; j++ ) {
-	U[j] = -U[j] ;
-      }
-      struct halfspinor res ;
-      colormatrix_halfspinor( (void*)res.D ,
-			      (const void*)U ,
-			      (const void*)F -> S[i].D ) ;
-      F -> S[i] = res ;
-    }
-  } else {
-    #pragma omp for private(i)
-    for( i = 0 ; i < LCU ; i++ ) {
-      const size_t idx = lat[i+t*LCU].back[ ND-1 ] ;    
-      struct halfspinor res ;
-      colormatrix_halfspinor( (void*)res.D ,
-			      (const void*)lat[idx].O[ND-1] ,
-			      (const void*)F -> S[i].D ) ;
-      F -> S[i] = res ;
-    }
-  }
-  
-  // update the clovers
-  compute_clovers( F , lat , tbck , NRQCD.U0 ) ;
+  // passing through a boundary flips sign of t-links
+  const GLU_bool flip = ( tbck > t && boundary == ANTIPERIODIC ) ?
+    GLU_TRUE : GLU_FALSE ;
 
-  // evolve again
-  for( n = 0 ; n < NRQCD.N ; n++ ) {
-    evolve_H( F , tbck , NRQCD_flipped ) ;
-  }
+  nrqcd_step( F , L , tbck , NRQCD_flipped , GLU_TRUE , flip ) ;
 
-#ifndef NRQCD_NONSYM
-  // finally evolve the spin-dependent terms a little bit
-  if( fuse_dH == GLU_TRUE ) {
-    evolve_dH_fused( F , tbck , NRQCD_flipped ) ;
-  } else {
-    evolve_dH( F , tbck , NRQCD_flipped ) ;
-  }
-#endif
-  
   return SUCCESS ;
 }
 
-// tadpole improvement of the gauge field
+// copy the batch of sources in F -> S into the timeslice tidx of H
 static void
-tadpole_improve( struct site *lat ,
-		 const double tadpole )
+copy_batch( struct halfspinor_f **H ,
+	    const struct NRQCD_fields *F ,
+	    const size_t tidx )
 {
   size_t i ;
-#pragma omp for private(i)
-  for( i = 0 ; i < LVOLUME ; i++ ) {
-    #ifdef HAVE_IMMINTRIN_H
-    __m128d *pU = (__m128d*)lat[i].O ;
-    register const __m128d tad = _mm_setr_pd( tadpole , tadpole ) ;
-    size_t j ;
-    for( j = 0 ; j < ND*NCNC ; j++ ) {
-      *pU = _mm_mul_pd( *pU , tad ) ;
-      pU++ ;
-    }
-    #else
-    size_t j , mu ;
-    for( mu = 0 ; mu < ND ; mu++ ) {
-      for( j = 0 ; j < NCNC ; j++ ) {
-        lat[i].O[mu][j] *= tadpole ;
-      }
-    }
-    #endif
-  }
-  return ;
-}
-
-// accumulate twists
-static void
-apply_twist( struct site *lat ,
-	     double sum_twist[ ND ] ,
-	     const double this_twist[ ND ] ,
-	     const double mom_source[ ND ] )
-{
-  double delta[ ND ] ;
-
-  // compute the additional twist needed to apply to gauge field 
-  size_t mu , i ;
-  for( mu = 0 ; mu < ND ; mu++ ) {
-    const double new_mom = this_twist[mu] ;
-    delta[ mu ] = ( new_mom ) - sum_twist[ mu ] ;
-    // sum = sum + ( this - sum ) == this
-    sum_twist[ mu ] = new_mom ; 
-  }
-
-  // twist only in the spatial directions
-  for( mu = 0 ; mu < ND-1 ; mu++ ) {
-
-    // skip if it is zero as it just multiplies by 1
-    if( fabs( delta[ mu ] ) < NRQCD_TOL ) continue ;
-
-    // phase is exp( -I * theta_\mu * 2 * M_PI / Latt.dims[mu] )
-    // the factor of 2 is to keep it in line with momentum def
-    // this is kosher as the twist is arbitrary so it can just
-    // reabsorb this factor
-    const double dlat = TWOPI*delta[mu]/Latt.dims[mu] ;
-    double s , c ;
-    sincos( dlat , &s , &c ) ;
-    
-    // this might be a rare place where we can nowait the loop
-    #pragma omp for private(i)
-    for( i = 0 ; i < LVOLUME ; i++ ) {
-
-      #ifdef HAVE_IMMINTRIN_H
-      __m128d *pU = (__m128d*)lat[i].O[mu] ;
-      register const __m128d ph = _mm_setr_pd( c , s ) ;
-        #if NC == 3
-        *pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-	*pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-	*pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-        *pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-	*pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-	*pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-        *pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-	*pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-	*pU = SSE2_MUL( *pU , ph ) ; 
-        #else
-        size_t j ;
-        for( j = 0 ; j < NCNC ; j++ ) {
-          *pU = SSE2_MUL( *pU , ph ) ; pU++ ;
-        }
-        #endif
-      #else
-      const double complex phase = c + I*s ;
-      size_t j ;
-      for( j = 0 ; j < NCNC ; j++ ) {
-        lat[i].O[mu][j] *= phase ;
-      }
-      #endif
+  #pragma omp for nowait private(i)
+  for( i = 0 ; i < LCU ; i++ ) {
+    const size_t idx = i + LCU*tidx ;
+    size_t n ;
+    for( n = 0 ; n < F -> Nsrc ; n++ ) {
+      const struct halfspinor *S = F -> S + i + n*LCU ;
+      colormatrix_equiv_d2f( H[n][idx].D[0] , S -> D[0] ) ;
+      colormatrix_equiv_d2f( H[n][idx].D[1] , S -> D[1] ) ;
+      colormatrix_equiv_d2f( H[n][idx].D[2] , S -> D[2] ) ;
+      colormatrix_equiv_d2f( H[n][idx].D[3] , S -> D[3] ) ;
     }
   }
-  
   return ;
 }
 
 static void
-do_prop( struct halfspinor_f *H ,
+do_prop( struct halfspinor_f **H ,
 	 struct NRQCD_fields *F ,
-	 const struct site *lat ,
+	 struct NRQCD_links *L ,
 	 const struct NRQCD_params NRQCD ,
-	 const GLU_bool fuse_dH ,
 	 const GLU_bool backward ,
 	 const size_t Torigin ,
-	 const double tadref ,
 	 const boundaries boundary )
 {   
-  size_t t , tnew , tprev = ( Torigin )%LT , i ;
+  size_t t , tnew , tprev = ( Torigin )%LT ;
     
-  // do a copy in here
-  #pragma omp for nowait private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
-    const size_t idx = LCU*tprev ;
-    colormatrix_equiv_d2f( H[i+idx].D[0] , F -> S[i].D[0] ) ;
-    colormatrix_equiv_d2f( H[i+idx].D[1] , F -> S[i].D[1] ) ;
-    colormatrix_equiv_d2f( H[i+idx].D[2] , F -> S[i].D[2] ) ;
-    colormatrix_equiv_d2f( H[i+idx].D[3] , F -> S[i].D[3] ) ;
-  }
-
-  // compute the initial lattice clovers
-  compute_clovers( F , lat , tprev , tadref ) ;
+  // do a copy in here, the clovers of tprev were computed
+  // when the source was set up
+  copy_batch( H , F , tprev ) ;
   
   // evolve for all timeslices can we parallelise this? - nope
   for( t = 0 ; t < T_NRQCD-1 ; t++ ) {
@@ -543,27 +530,21 @@ do_prop( struct halfspinor_f *H ,
     if( backward == GLU_TRUE ) {
       tnew = ( tprev + LT - 1 )%LT ;
       // computes the backward propagator
-      nrqcd_prop_bwd( F , tprev%LT , NRQCD , fuse_dH , boundary ) ;
+      nrqcd_prop_bwd( F , L , tprev%LT , NRQCD , boundary ) ;
       // returns the global index shifted by the origin this is basically
       // the timeslice of tnew, but shifted for non-LT T_NRQCD
-      idx = LCU*(( T_NRQCD - t - 1 + ( Torigin )%LT )%(T_NRQCD) ) ;
+      idx = ( T_NRQCD - t - 1 + ( Torigin )%LT )%(T_NRQCD) ;
     } else {
       tnew = ( tprev + LT + 1 )%LT ;
       // computes the forward propagator
-      nrqcd_prop_fwd( F , tprev%LT , NRQCD , fuse_dH , boundary ) ;
+      nrqcd_prop_fwd( F , L , tprev%LT , NRQCD , boundary ) ;
       // this one is basically also tnew but placed appropriately for
       // non-LT T_NRQCD global define
-      idx = LCU*(( t + 1 + ( Torigin )%LT )%(T_NRQCD) ) ;
-    }
-      	    
-    #pragma omp for nowait private(i) 
-    for( i = 0 ; i < LCU ; i++ ) {
-      colormatrix_equiv_d2f( H[i+idx].D[0] , F -> S[i].D[0] ) ;
-      colormatrix_equiv_d2f( H[i+idx].D[1] , F -> S[i].D[1] ) ;
-      colormatrix_equiv_d2f( H[i+idx].D[2] , F -> S[i].D[2] ) ;
-      colormatrix_equiv_d2f( H[i+idx].D[3] , F -> S[i].D[3] ) ;
+      idx = ( t + 1 + ( Torigin )%LT )%(T_NRQCD) ;
     }
 
+    copy_batch( H , F , idx ) ;
+
     // set the time index
     tprev = tnew ;
 
@@ -575,72 +556,237 @@ do_prop( struct halfspinor_f *H ,
   return ;
 }
 
+// two props can share an evolution if they only differ in their
+// spatial origin or their source
+static GLU_bool
+same_evolution( const struct propagator p1 ,
+		const struct propagator p2 )
+{
+  const struct NRQCD_params A = p1.NRQCD , B = p2.NRQCD ;
+  if( p1.basis != NREL_CORR || p2.basis != NREL_CORR ||
+      p1.origin[ND-1] != p2.origin[ND-1] ||
+      p1.bound[ND-1] != p2.bound[ND-1] ||
+      A.U0 != B.U0 || A.C0 != B.C0 || A.C1 != B.C1 || A.C2 != B.C2 ||
+      A.C3 != B.C3 || A.C4 != B.C4 || A.C5 != B.C5 || A.C6 != B.C6 ||
+      A.C7 != B.C7 || A.C8 != B.C8 || A.C9EB != B.C9EB ||
+      A.C10EB != B.C10EB || A.C11 != B.C11 || A.M_0 != B.M_0 ||
+      A.N != B.N || A.FWD != B.FWD || A.BWD != B.BWD ||
+      A.PIPELINE != B.PIPELINE || A.PRECISION != B.PRECISION ||
+      A.ACCUM != B.ACCUM || A.LOADED != B.LOADED ||
+      p1.Source.Nhits != p2.Source.Nhits ) {
+    return GLU_FALSE ;
+  }
+  // the twist is put on the gauge field so it has to be the same
+  size_t mu ;
+  for( mu = 0 ; mu < ND ; mu++ ) {
+    if( p1.twist[mu] != p2.twist[mu] ) return GLU_FALSE ;
+  }
+  return GLU_TRUE ;
+}
+
+// do we evolve any direction of this prop up front?
+GLU_bool
+NRQCD_up_front( const struct propagator p )
+{
+  if( p.basis != NREL_CORR || p.NRQCD.LOADED == GLU_TRUE ) return GLU_FALSE ;
+  if( p.NRQCD.BWD == GLU_TRUE ) return GLU_TRUE ;
+  if( p.NRQCD.FWD == GLU_TRUE && p.NRQCD.PIPELINE == GLU_FALSE ) {
+    return GLU_TRUE ;
+  }
+  return GLU_FALSE ;
+}
+
+// how many props of a batch fit in Nsrc sources, each prop brings
+// all of its hits
+static size_t
+props_per_batch( const struct propagator p ,
+		 const size_t Nsrc )
+{
+  const size_t per = Nsrc / p.Source.Nhits ;
+  return per < 1 ? 1 : ( per > NRQCD_MAX_BATCH ? NRQCD_MAX_BATCH : per ) ;
+}
+
+// sets batch to the props evolved alongside prop n, returns 0 if
+// prop n is evolved in an earlier batch or not up front
+static size_t
+get_batch( size_t batch[ NRQCD_MAX_BATCH ] ,
+	   const struct propagator *prop ,
+	   const size_t nprops ,
+	   const size_t n ,
+	   const size_t Nsrc )
+{
+  if( NRQCD_up_front( prop[n] ) == GLU_FALSE ) return 0 ;
+  const size_t per = props_per_batch( prop[n] , Nsrc ) ;
+  size_t m , rank = 0 , nbatch = 0 ;
+  for( m = 0 ; m < n ; m++ ) {
+    rank += same_evolution( prop[m] , prop[n] ) ;
+  }
+  if( rank%per != 0 ) return 0 ;
+  for( m = n ; m < nprops && nbatch < per ; m++ ) {
+    if( same_evolution( prop[m] , prop[n] ) ) {
+      batch[ nbatch++ ] = m ;
+    }
+  }
+  return nbatch ;
+}
+
+// largest number of sources we evolve together, a prop with many
+// hits is evolved in one go even if there are more than NRQCD_MAX_BATCH
+size_t
+NRQCD_batch_size( const struct propagator *prop ,
+		  const size_t nprops )
+{
+  size_t batch[ NRQCD_MAX_BATCH ] , n , Nsrc = 0 ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    const size_t Nhits = prop[n].Source.Nhits ;
+    const size_t cap = Nhits > NRQCD_MAX_BATCH ? Nhits : NRQCD_MAX_BATCH ;
+    const size_t nsrc = Nhits * get_batch( batch , prop , nprops , n , cap ) ;
+    Nsrc = nsrc > Nsrc ? nsrc : Nsrc ;
+  }
+  return Nsrc ;
+}
+
+// number of sweeps through the timeslices that read the links L,
+// pipelined props sweep once per contraction that reads them
+size_t
+NRQCD_link_sweeps( const struct propagator *prop ,
+		   const size_t nprops ,
+		   const size_t *nreads ,
+		   const struct NRQCD_links *L )
+{
+  const size_t Nsrc = NRQCD_batch_size( prop , nprops ) ;
+  size_t batch[ NRQCD_MAX_BATCH ] , n , sweeps = 0 ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( prop[n].links != L ) continue ;
+    if( prop[n].pipe != NULL ) sweeps += nreads[n] ;
+    if( Nsrc == 0 || get_batch( batch , prop , nprops , n , Nsrc ) == 0 ) continue ;
+    sweeps += ( prop[n].NRQCD.BWD == GLU_TRUE ) ;
+    sweeps += ( prop[n].NRQCD.FWD == GLU_TRUE &&
+		prop[n].NRQCD.PIPELINE == GLU_FALSE ) ;
+  }
+  return sweeps ;
+}
 
 // this is the brains of the operation, evolves Hamiltonian from the
-// source position
+// source position, the gauge field is left untouched as each batch
+// reads the improved and twisted links of its prop
 void
 compute_props( struct propagator *prop ,
 	       struct NRQCD_fields *F ,
-	       struct site *lat ,
-	       const size_t nprops ,
-	       const double tadref )
+	       const size_t nprops )
 {
-  size_t i , n ;
+  const size_t Nsrc = F -> Nsrc ;
+  size_t n ;
 
-  // do the tadpole improvement on the gauge field
-  tadpole_improve( lat , 1./tadref ) ;
-
-  // initialise the accumulated sum of twists we have applied
-  double sum_twist[ ND ] ;
-  for( i = 0 ; i < ND ; i++ ) {
-    sum_twist[ i ] = 0.0 ;
-  }
-  
   // loop N props this far out as we might want to have different source
-  // positions
+  // positions, props with the same evolution are done in batches
   for( n = 0 ; n < nprops ; n++ ) {
 
-    if( prop[n].basis != NREL_CORR ) continue ;
+    size_t batch[ NRQCD_MAX_BATCH ] , k , hit ;
+    const size_t nbatch = get_batch( batch , prop , nprops , n , Nsrc ) ;
+    if( nbatch == 0 ) continue ;
+
+    // every hit of every prop in the batch is a source
+    const size_t Nhits = prop[n].Source.Nhits ;
 
-    // if we can we fuse the loops in dH evolution to avoid a
-    // barrier
-    GLU_bool fuse_dH = GLU_FALSE ;
-    if( fabs( prop[n].NRQCD.C8 )  < NRQCD_TOL &&
-	fabs( prop[n].NRQCD.C11 ) < NRQCD_TOL ) {
-      fuse_dH = GLU_TRUE ;
+    // F is shared so wait for everyone to finish the last batch
+    #pragma omp barrier
+    #pragma omp single
+    {
+      F -> Nsrc = nbatch*Nhits ;
     }
-    
-    // apply a twist to the gauge field
-    apply_twist( lat , sum_twist , prop[n].twist , prop[n].mom_source ) ;
 
-    // set up the source into F -> S
-    if( prop[n].NRQCD.FWD == GLU_TRUE ) {
-      initialise_source( F -> S , F -> S1 , prop[n] ) ;
+    // the batch shares U0 and twist and so shares the links
+    struct NRQCD_links *L = prop[n].links ;
+    const size_t t0 = prop[n].origin[ND-1]%LT ;
+
+    struct halfspinor_f *H[ Nsrc ] ;
+
+    // set up the sources into F -> S, pipelined props evolve
+    // forward when they are read
+    if( prop[n].NRQCD.FWD == GLU_TRUE &&
+	prop[n].NRQCD.PIPELINE == GLU_FALSE ) {
+      set_clovers( F , L , t0 , prop[n].NRQCD ) ;
+      for( k = 0 ; k < nbatch ; k++ ) {
+	for( hit = 0 ; hit < Nhits ; hit++ ) {
+	  const size_t j = hit + k*Nhits ;
+	  initialise_source( F -> S + j*LCU , F -> S1 + j*LCU , F -> Fmunu ,
+			     prop[ batch[k] ] , hit ) ;
+	  H[j] = prop[ batch[k] ].Hfwd + hit*T_NRQCD*LCU ;
+	}
+      }
       
-      do_prop( prop[n].Hfwd , F , lat , prop[n].NRQCD , fuse_dH ,
-	       GLU_FALSE , prop[n].origin[ND-1] , tadref ,
+      do_prop( H , F , L , prop[n].NRQCD ,
+	       GLU_FALSE , prop[n].origin[ND-1] ,
 	       prop[n].bound[ ND-1 ] ) ;
     }
     
-    // set up the source into F -> S    
+    // set up the sources into F -> S    
     if( prop[n].NRQCD.BWD == GLU_TRUE ) {
-      initialise_source( F -> S , F -> S1 , prop[n] ) ;
+      set_clovers( F , L , t0 , prop[n].NRQCD ) ;
+      for( k = 0 ; k < nbatch ; k++ ) {
+	for( hit = 0 ; hit < Nhits ; hit++ ) {
+	  const size_t j = hit + k*Nhits ;
+	  initialise_source( F -> S + j*LCU , F -> S1 + j*LCU , F -> Fmunu ,
+			     prop[ batch[k] ] , hit ) ;
+	  H[j] = prop[ batch[k] ].Hbwd + hit*T_NRQCD*LCU ;
+	}
+      }
       
-      do_prop( prop[n].Hbwd , F , lat , prop[n].NRQCD , fuse_dH ,
-	       GLU_TRUE , prop[n].origin[ND-1] , tadref ,
+      do_prop( H , F , L , prop[n].NRQCD ,
+	       GLU_TRUE , prop[n].origin[ND-1] ,
 	       prop[n].bound[ ND-1 ] ) ;
     }
   }
-
-  // untwist the gauge field
-  double zero_twist[ ND ] ;
-  for( i = 0 ; i < ND ; i++ ) {
-    zero_twist[ i ] = 0.0 ;
+  #pragma omp barrier
+  #pragma omp single
+  {
+    F -> Nsrc = Nsrc ;
   }
-  apply_twist( lat , sum_twist , zero_twist , zero_twist ) ;
-
-  // un-tadpole improve
-  tadpole_improve( lat , tadref ) ;
-  
   return ;
 }
+
+// evolve the hit prop.hit of a pipelined forward prop so that
+// prop.pipe -> F.S holds timeslice t, restarting from the source if
+// we are already past it or were evolving another hit. The whole team
+// calls this and shares the work
+int
+NRQCD_pipe_evolve( const struct propagator prop ,
+		   const size_t t )
+{
+  struct NRQCD_pipe *P = prop.pipe ;
+  const size_t t0 = prop.origin[ND-1]%LT ;
+  const size_t nsteps = ( t + LT - t0 )%LT ;
+
+  if( P -> started == GLU_TRUE && P -> hit == prop.hit &&
+      P -> nsteps == nsteps ) {
+    return SUCCESS ;
+  }
+  const GLU_bool restart = ( P -> started == GLU_FALSE ||
+			     P -> hit != prop.hit ||
+			     P -> nsteps > nsteps ) ;
+  const size_t nstart = ( restart == GLU_TRUE ) ? 0 : P -> nsteps ;
+
+  // whoever read the last timeslice out of F.S has to be done with it
+  #pragma omp barrier
+
+  struct NRQCD_links *L = prop.links ;
+  int flag = SUCCESS ;
+  if( restart == GLU_TRUE ) {
+    set_clovers( &P -> F , L , t0 , prop.NRQCD ) ;
+    flag = initialise_source( P -> F.S , P -> F.S1 , P -> F.Fmunu ,
+			      prop , prop.hit ) ;
+  }
+  size_t n ;
+  for( n = nstart ; n < nsteps ; n++ ) {
+    nrqcd_prop_fwd( &P -> F , L , ( t0 + n )%LT , prop.NRQCD ,
+		    prop.bound[ ND-1 ] ) ;
+  }
+  #pragma omp single
+  {
+    P -> nsteps = nsteps ;
+    P -> hit = prop.hit ;
+    P -> started = GLU_TRUE ;
+  }
+  return flag ;
+}
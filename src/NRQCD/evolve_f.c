@@ -0,0 +1,236 @@
+/**
+   @file evolve_f.c
+   @brief single precision NRQCD evolution between the spin-dependent terms
+ */
+#include "common.h"
+
+// the halfspinor is a colour matrix on its left index so U.S is a sum
+// over colour rows b of U[a][b] times a whole row of S, with the
+// rows of S split and contiguous this is a plain axpy of NS*NC floats
+#define NSNC (NS*NC)
+
+// the split copy of link mu at site i, the ND-1 spatial links are
+// followed by the temporal links U_t(x) and U_t(x-t) like in the
+// clover slab
+#define UF(Uf,i,mu) ( (Uf) + ( (i)*(ND+1) + (mu) )*2*NCNC )
+
+// one site of ( 1 - H/2n ) S with H the C0 term, the sums are done in
+// "real" which is float or double
+#define C0_SPLIT_SITE( name , real )					\
+static void								\
+name( struct halfspinor_split *S1 ,					\
+      const struct halfspinor_split *S ,				\
+      const float *Uf ,							\
+      const size_t i ,							\
+      const size_t off ,						\
+      const double fac )						\
+{									\
+  real ar[ NC ][ NSNC ] , ai[ NC ][ NSNC ] ;				\
+  size_t mu , a , b , j ;						\
+  for( a = 0 ; a < NC ; a++ ) {						\
+    for( j = 0 ; j < NSNC ; j++ ) {					\
+      ar[a][j] = ai[a][j] = 0 ;						\
+    }									\
+  }									\
+  for( mu = 0 ; mu < ND-1 ; mu++ ) {					\
+    const size_t Sfwd = lat[ i ].neighbor[mu] ;				\
+    const size_t Sbck = lat[ i ].back[mu] ;				\
+    const float *Ur = UF( Uf , i , mu ) , *Ui = Ur + NCNC ;		\
+    const float *Vr = UF( Uf , Sbck , mu ) , *Vi = Vr + NCNC ;		\
+    const struct halfspinor_split *F = S + Sfwd + off ;			\
+    const struct halfspinor_split *B = S + Sbck + off ;			\
+    for( a = 0 ; a < NC ; a++ ) {					\
+      for( b = 0 ; b < NC ; b++ ) {					\
+	/* U(x) S(x+mu) + U^dag(x-mu) S(x-mu) */			\
+	const real ur = Ur[ b + a*NC ] , ui = Ui[ b + a*NC ] ;		\
+	const real vr = Vr[ a + b*NC ] , vi = -Vi[ a + b*NC ] ;		\
+	for( j = 0 ; j < NSNC ; j++ ) {					\
+	  ar[a][j] += ur*F -> re[b][j] - ui*F -> im[b][j]		\
+	    + vr*B -> re[b][j] - vi*B -> im[b][j] ;			\
+	  ai[a][j] += ur*F -> im[b][j] + ui*F -> re[b][j]		\
+	    + vr*B -> im[b][j] + vi*B -> re[b][j] ;			\
+	}								\
+      }									\
+    }									\
+  }									\
+  const real f = (real)fac , m2 = (real)( -2*(ND-1) ) ;			\
+  const struct halfspinor_split *Si = S + i + off ;			\
+  struct halfspinor_split *S1i = S1 + i + off ;				\
+  for( a = 0 ; a < NC ; a++ ) {						\
+    for( j = 0 ; j < NSNC ; j++ ) {					\
+      S1i -> re[a][j] = (float)( Si -> re[a][j] +			\
+				 f*( ar[a][j] + m2*Si -> re[a][j] ) ) ;	\
+      S1i -> im[a][j] = (float)( Si -> im[a][j] +			\
+				 f*( ai[a][j] + m2*Si -> im[a][j] ) ) ;	\
+    }									\
+  }									\
+  return ;								\
+}
+
+C0_SPLIT_SITE( C0_site_f , float )
+C0_SPLIT_SITE( C0_site_d , double )
+
+#undef C0_SPLIT_SITE
+
+// double halfspinor to the split single precision layout
+static void
+halfspinor_to_split( struct halfspinor_split *Sf ,
+		     const struct halfspinor *S )
+{
+  size_t d , b , c ;
+  for( d = 0 ; d < NS ; d++ ) {
+    for( b = 0 ; b < NC ; b++ ) {
+      for( c = 0 ; c < NC ; c++ ) {
+	Sf -> re[b][ c + d*NC ] = (float)creal( S -> D[d][ c + b*NC ] ) ;
+	Sf -> im[b][ c + d*NC ] = (float)cimag( S -> D[d][ c + b*NC ] ) ;
+      }
+    }
+  }
+  return ;
+}
+
+// and back again
+static void
+split_to_halfspinor( struct halfspinor *S ,
+		     const struct halfspinor_split *Sf )
+{
+  size_t d , b , c ;
+  for( d = 0 ; d < NS ; d++ ) {
+    for( b = 0 ; b < NC ; b++ ) {
+      for( c = 0 ; c < NC ; c++ ) {
+	S -> D[d][ c + b*NC ] = Sf -> re[b][ c + d*NC ] +
+	  I * Sf -> im[b][ c + d*NC ] ;
+      }
+    }
+  }
+  return ;
+}
+
+// split copies of the links of the timeslice in F -> Fmunu
+void
+links_to_split( struct NRQCD_fields *F )
+{
+  size_t i ;
+#pragma omp for private(i)
+  for( i = 0 ; i < LCU ; i++ ) {
+    size_t mu , j ;
+    for( mu = 0 ; mu < ND+1 ; mu++ ) {
+      const double complex *U = FMUNU( F -> Fmunu , i , FMUNU_LINK+mu ) ;
+      float *Ur = UF( F -> Uf , i , mu ) ;
+      for( j = 0 ; j < NCNC ; j++ ) {
+	Ur[ j ] = (float)creal( U[j] ) ;
+	Ur[ j + NCNC ] = (float)cimag( U[j] ) ;
+      }
+    }
+  }
+  return ;
+}
+
+// F -> S into F -> Sf
+void
+halfspinors_to_split( struct NRQCD_fields *F )
+{
+  size_t k ;
+#pragma omp for private(k)
+  for( k = 0 ; k < LCU*F -> Nsrc ; k++ ) {
+    halfspinor_to_split( &F -> Sf[k] , &F -> S[k] ) ;
+  }
+  return ;
+}
+
+// F -> Sf back into F -> S
+void
+split_to_halfspinors( struct NRQCD_fields *F )
+{
+  size_t k ;
+#pragma omp for private(k)
+  for( k = 0 ; k < LCU*F -> Nsrc ; k++ ) {
+    split_to_halfspinor( &F -> S[k] , &F -> Sf[k] ) ;
+  }
+  return ;
+}
+
+// the NRQCD.N applications of the kinetic term on F -> Sf
+void
+evolve_H_f( struct NRQCD_fields *F ,
+	    const struct NRQCD_params NRQCD )
+{
+  if( fabs( NRQCD.C0 ) < NRQCD_TOL ) return ;
+
+  // H = C0*grad^2 S and S1 = S - H/(2n)
+  const double fac = -NRQCD.C0 / ( 2. * NRQCD.M_0 ) * ( -1./(2*NRQCD.N) ) ;
+
+  size_t step , k ;
+  for( step = 0 ; step < NRQCD.N ; step++ ) {
+    #pragma omp for private(k)
+    for( k = 0 ; k < LCU ; k++ ) {
+      const size_t i = F -> order[k] ;
+      size_t n ;
+      for( n = 0 ; n < F -> Nsrc ; n++ ) {
+	if( NRQCD.ACCUM == DOUBLE ) {
+	  C0_site_d( F -> S1f , F -> Sf , F -> Uf , i , n*LCU , fac ) ;
+	} else {
+	  C0_site_f( F -> S1f , F -> Sf , F -> Uf , i , n*LCU , fac ) ;
+	}
+      }
+    }
+    // shallow pointer swap
+    #pragma omp single
+    {
+      struct halfspinor_split *P = F -> Sf ;
+      F -> Sf = F -> S1f ;
+      F -> S1f = P ;
+    }
+  }
+  return ;
+}
+
+// multiplies F -> Sf by U_t(x)^dagger going forward or by U_t(x-t)
+// going backward, flip is set when we pass through an antiperiodic
+// boundary
+void
+temporal_link_f( struct NRQCD_fields *F ,
+		 const GLU_bool backward ,
+		 const GLU_bool flip )
+{
+  const size_t mu = ( backward == GLU_TRUE ) ? ND : ND-1 ;
+  const float sign = ( flip == GLU_TRUE ) ? -1 : 1 ;
+  size_t i ;
+#pragma omp for private(i)
+  for( i = 0 ; i < LCU ; i++ ) {
+    const float *Ur = UF( F -> Uf , i , mu ) , *Ui = Ur + NCNC ;
+    float wr[ NC ][ NC ] , wi[ NC ][ NC ] ;
+    size_t a , b , j , n ;
+    for( a = 0 ; a < NC ; a++ ) {
+      for( b = 0 ; b < NC ; b++ ) {
+	if( backward == GLU_TRUE ) {
+	  wr[a][b] = sign*Ur[ b + a*NC ] ;
+	  wi[a][b] = sign*Ui[ b + a*NC ] ;
+	} else {
+	  wr[a][b] = sign*Ur[ a + b*NC ] ;
+	  wi[a][b] = -sign*Ui[ a + b*NC ] ;
+	}
+      }
+    }
+    for( n = 0 ; n < F -> Nsrc ; n++ ) {
+      struct halfspinor_split *S = F -> Sf + i + n*LCU ;
+      float sr[ NC ][ NSNC ] , si[ NC ][ NSNC ] ;
+      for( a = 0 ; a < NC ; a++ ) {
+	for( j = 0 ; j < NSNC ; j++ ) {
+	  sr[a][j] = si[a][j] = 0 ;
+	}
+	for( b = 0 ; b < NC ; b++ ) {
+	  for( j = 0 ; j < NSNC ; j++ ) {
+	    sr[a][j] += wr[a][b]*S -> re[b][j] - wi[a][b]*S -> im[b][j] ;
+	    si[a][j] += wr[a][b]*S -> im[b][j] + wi[a][b]*S -> re[b][j] ;
+	  }
+	}
+      }
+      memcpy( S -> re , sr , sizeof( sr ) ) ;
+      memcpy( S -> im , si , sizeof( si ) ) ;
+    }
+  }
+  return ;
+}
+
+#undef UF
@@ -88,9 +88,8 @@ improved_fac( double complex *A ,
 void
 grad_imp_LCU( struct halfspinor *der ,
 	      const struct halfspinor *S ,
-	      const struct field *Fmunu ,
+	      const double complex *Fmunu ,
 	      const double U_0 ,
-	      const size_t t ,
 	      const size_t mu )
 {
   size_t i ;
@@ -101,9 +100,6 @@ grad_imp_LCU( struct halfspinor *der ,
     double complex A[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
     double complex B[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
     
-    const size_t Uidx = i + t*LCU ;    
-    const size_t Ubck = lat[ Uidx ].back[mu] ;
-    
     const size_t Sfwd = lat[ i ].neighbor[mu] ;
     const size_t Sfwd2 = lat[ Sfwd ].neighbor[mu] ;
     
@@ -114,11 +110,11 @@ grad_imp_LCU( struct halfspinor *der ,
     for( d = 0 ; d < NS ; d++ ) {
       // computes der = U(x) S(x+\mu)
       multab( (void*)der[ i ].D[d] ,
-	      (void*)lat[ Uidx ].O[mu] ,
+	      (void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 	      (void*)S[ Sfwd ].D[d] ) ;
       // computes A = U^\dagger (x-\mu ) S(x-\mu)
       multabdag( (void*)A ,
-		 (void*)lat[ Ubck ].O[mu] ,
+		 (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ,
 		 (void*)S[ Sbck ].D[d] ) ;
       // computes der = -( der - A )/2
       #ifdef LEGACY_NRQCD_COMPARE
@@ -129,11 +125,11 @@ grad_imp_LCU( struct halfspinor *der ,
       
       // compute U(x)U(x+\mu)S(x+2\mu)
       multab( (void*)A ,
-	      (void*)Fmunu[i].O[6+2*mu] ,
+	      (void*)FMUNU( Fmunu , i , 6+2*mu ) ,
 	      (void*)S[ Sfwd2 ].D[d] ) ;
       // compute U(x-mu)U(x-2mu)S(x-2\mu)
       multabdag( (void*)B ,
-		 (void*)Fmunu[i].O[7+2*mu],
+		 (void*)FMUNU( Fmunu , i , 7+2*mu ),
 		 (void*)S[ Sbck2 ].D[d] ) ;
       colormatrix_Sa_xmy( A , B , -1./12. ) ;
 
@@ -147,10 +143,9 @@ grad_imp_LCU( struct halfspinor *der ,
 void
 grad_imp_FMUNU( struct halfspinor *der ,
 		const struct halfspinor *S ,
-		const struct field *Fmunu ,
+		const double complex *Fmunu ,
 		const double U_0 ,
 		const size_t i ,
-		const size_t t ,
 		const size_t mu ,
 		const size_t Fmunu_idx )
 {
@@ -161,22 +156,20 @@ grad_imp_FMUNU( struct halfspinor *der ,
   double complex D[ NCNC ] , E[ NCNC ] , F[ NCNC ] , G[ NCNC ] ;
 #endif
   
-  const size_t Uidx  = i + t*LCU ;    
-  const size_t Ubck  = lat[ Uidx ].back[mu] ;
   const size_t Sfwd  = lat[ i ].neighbor[mu] ;
   const size_t Sfwd2 = lat[ Sfwd ].neighbor[mu] ;
   const size_t Sbck  = lat[ i ].back[mu] ;
   const size_t Sbck2 = lat[ Sbck ].back[mu] ;
 
   // precompute some common terms here -> products of links and clovers
-  multab( D , (void*)lat[ Uidx ].O[mu] ,
-	  (void*)Fmunu[ Sfwd ].O[ Fmunu_idx ] ) ;
-  multabdag( E , (void*)lat[ Ubck ].O[mu] ,
-	     (void*)Fmunu[ Sbck ].O[ Fmunu_idx ] ) ;
-  multab( F , (void*)Fmunu[i].O[6+2*mu] ,
-	  (void*)Fmunu[ Sfwd2 ].O[ Fmunu_idx ] ) ;
-  multabdag( G , (void*)Fmunu[i].O[7+2*mu] ,
-	     (void*)Fmunu[ Sbck2 ].O[ Fmunu_idx ] ) ;
+  multab( D , (void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
+	  (void*)FMUNU( Fmunu , Sfwd , Fmunu_idx ) ) ;
+  multabdag( E , (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ,
+	     (void*)FMUNU( Fmunu , Sbck , Fmunu_idx ) ) ;
+  multab( F , (void*)FMUNU( Fmunu , i , 6+2*mu ) ,
+	  (void*)FMUNU( Fmunu , Sfwd2 , Fmunu_idx ) ) ;
+  multabdag( G , (void*)FMUNU( Fmunu , i , 7+2*mu ) ,
+	     (void*)FMUNU( Fmunu , Sbck2 , Fmunu_idx ) ) ;
 
   colormatrix_halfspinor( (void*)der -> D , D , (const void*)S[ Sfwd ].D ) ;
   colormatrix_halfspinor( (void*)A.D   , E , (const void*)S[ Sbck ].D ) ;
@@ -189,27 +182,22 @@ grad_imp_FMUNU( struct halfspinor *der ,
   return ;
 }
 
-// computes the improved derivative of S and multiplies on the left by Fmunu
+// computes the improved derivative of S at site i
 void
-FMUNU_grad_imp( struct halfspinor *der ,
-		const struct halfspinor *S ,
-		const struct field *Fmunu ,
-		const double U_0 ,
-		const size_t i ,
-		const size_t t ,
-		const size_t mu ,
-		const size_t Fmunu_idx )
+grad_imp( struct halfspinor *der ,
+	  const struct halfspinor *S ,
+	  const double complex *Fmunu ,
+	  const double U_0 ,
+	  const size_t i ,
+	  const size_t mu )
 {
   // some temporaries we need
-  struct halfspinor A , B , E , res ;
+  struct halfspinor A , B , E ;
 #ifdef HAVE_IMMINTRIN_H
   __m128d C[ NCNC ] , D[ NCNC ] ; 
 #else
   double complex C[ NCNC ] , D[ NCNC ] ;
 #endif
-  const size_t Uidx = i + t*LCU ;    
-  const size_t Ubck = lat[ Uidx ].back[mu] ;
-    
   const size_t Sfwd = lat[ i ].neighbor[mu] ;
   const size_t Sfwd2 = lat[ Sfwd ].neighbor[mu] ;
     
@@ -217,24 +205,39 @@ FMUNU_grad_imp( struct halfspinor *der ,
   const size_t Sbck2 = lat[ Sbck ].back[mu] ;
 
   // it turns out a little faster to do this than call multabdag
-  dagger_gauge( C , (void*)lat[ Ubck ].O[mu] ) ;
-  dagger_gauge( D , (void*)Fmunu[i].O[7+2*mu] ) ;
+  dagger_gauge( C , (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ) ;
+  dagger_gauge( D , (void*)FMUNU( Fmunu , i , 7+2*mu ) ) ;
 
-  colormatrix_halfspinor( (void*)res.D ,
-			  (const void*)lat[ Uidx ].O[mu] ,
+  colormatrix_halfspinor( (void*)der -> D ,
+			  (const void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 			  (const void*)S[ Sfwd ].D ) ;
   colormatrix_halfspinor( (void*)A.D   , C , (const void*)S[ Sbck ].D ) ;
   colormatrix_halfspinor( (void*)B.D   ,
-			  (const void*)Fmunu[i].O[6+2*mu] ,
+			  (const void*)FMUNU( Fmunu , i , 6+2*mu ) ,
 			  (const void*)S[ Sfwd2 ].D ) ;
   colormatrix_halfspinor( (void*)E.D   , D , (const void*)S[ Sbck2 ].D ) ;
 
-  improved_fac( (void*)res.D , (const void*)A.D ,
+  improved_fac( (void*)der -> D , (const void*)A.D ,
 		(const void*)B.D , (const void*)E.D , U_0 ) ;
+  return ;
+}
+
+// computes the improved derivative of S and multiplies on the left by Fmunu
+void
+FMUNU_grad_imp( struct halfspinor *der ,
+		const struct halfspinor *S ,
+		const double complex *Fmunu ,
+		const double U_0 ,
+		const size_t i ,
+		const size_t mu ,
+		const size_t Fmunu_idx )
+{
+  struct halfspinor res ;
+  grad_imp( &res , S , Fmunu , U_0 , i , mu ) ;
 
   // res is the improved gradient and we left multiply by the gauge field
   colormatrix_halfspinor( (void*)der -> D   ,
-			  (const void*)Fmunu[i].O[ Fmunu_idx ] ,
+			  (const void*)FMUNU( Fmunu , i , Fmunu_idx ) ,
 			  (const void*)res.D ) ;
   return ;
 }
@@ -74,30 +74,26 @@ sq_inner( double complex *H ,
 void
 gradsq( struct halfspinor *der2 ,
 	const struct halfspinor *S ,
-	const size_t i ,
-	const size_t t )
+	const double complex *Fmunu ,
+	const size_t i )
 {      
   zero_halfspinor( der2 ) ;
 
   double complex A[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
   double complex B[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
 
-  const size_t Uidx = i + t*LCU ;
-
   size_t mu , d ;
   for( mu = 0 ; mu < ND-1 ; mu++ ) {
     const size_t Sfwd = lat[ i ].neighbor[mu] ;
     const size_t Sbck = lat[ i ].back[mu] ;
-    const size_t Ubck = lat[ Uidx ].back[mu] ;
-      
     for( d = 0 ; d < NS ; d++ ) {
       // computes A = U(x) S(x+\mu)
       multab( (void*)A ,
-	      (void*)lat[ Uidx ].O[mu] ,
+	      (void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 	      (void*)S[ Sfwd ].D[d] ) ;
       // computes B = U^\dag(x-\mu) S(x-\mu)
       multabdag( (void*)B ,
-		 (void*)lat[ Ubck ].O[mu] ,
+		 (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ,
 		 (void*)S[ Sbck ].D[d] ) ;
       // A = A + B 
       add_mat( (void*)A , (void*)B ) ;
@@ -114,7 +110,7 @@ gradsq( struct halfspinor *der2 ,
 void
 grad_sq_LCU( struct halfspinor *der2 ,
 	     const struct halfspinor *S ,
-	     const size_t t )
+	     const double complex *Fmunu )
 {
   size_t i ;
   #pragma omp for private(i)
@@ -125,22 +121,18 @@ grad_sq_LCU( struct halfspinor *der2 ,
     double complex A[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
     double complex B[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
 
-    const size_t Uidx = i + t*LCU ;
-
     size_t mu , d ;
     for( mu = 0 ; mu < ND-1 ; mu++ ) {
       const size_t Sfwd = lat[ i ].neighbor[mu] ;
       const size_t Sbck = lat[ i ].back[mu] ;
-      const size_t Ubck = lat[ Uidx ].back[mu] ;
-      
       for( d = 0 ; d < NS ; d++ ) {
 	// computes A = U(x) S(x+\mu)
 	multab( (void*)A ,
-		(void*)lat[ Uidx ].O[mu] ,
+		(void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 		(void*)S[ Sfwd ].D[d] ) ;
 	// computes B = U^\dag(x-\mu) S(x-\mu)
 	multabdag( (void*)B ,
-		   (void*)lat[ Ubck ].O[mu] ,
+		   (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ,
 		   (void*)S[ Sbck ].D[d] ) ;
 	// A = A + B 
 	add_mat( (void*)A , (void*)B ) ;
@@ -158,9 +150,8 @@ grad_sq_LCU( struct halfspinor *der2 ,
 void
 gradsq_imp( struct halfspinor *der ,
 	    const struct halfspinor *S ,
-	    const struct field *Fmunu ,
-	    const size_t i ,
-	    const size_t t )
+	    const double complex *Fmunu ,
+	    const size_t i )
 {
   struct halfspinor A , B , C , D ;
 #ifdef HAVE_IMMINTRIN_H
@@ -169,8 +160,6 @@ gradsq_imp( struct halfspinor *der ,
   double complex b[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
 #endif
   
-  const size_t Uidx = i + t*LCU ;
-
   zero_halfspinor( der ) ;
 
   size_t mu ;
@@ -182,16 +171,14 @@ gradsq_imp( struct halfspinor *der ,
     const size_t Sbck  = lat[ i ].back[mu] ;
     const size_t Sbck2 = lat[ Sbck ].back[mu] ;
     
-    const size_t Ubck = lat[ Uidx ].back[mu] ;
-
-    colormatrix_halfspinor( (void*)A.D ,(void*)lat[ Uidx ].O[mu] ,
+    colormatrix_halfspinor( (void*)A.D ,(void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 			    (void*)S[ Sfwd ].D ) ;
-    dagger_gauge( (void*)b , (void*)lat[ Ubck ].O[mu] ) ;
+    dagger_gauge( (void*)b , (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ) ;
     colormatrix_halfspinor( (void*)B.D , (void*)b ,(void*)S[ Sbck ].D ) ;
 
-    colormatrix_halfspinor( (void*)C.D , (void*)Fmunu[i].O[6+2*mu] ,
+    colormatrix_halfspinor( (void*)C.D , (void*)FMUNU( Fmunu , i , 6+2*mu ) ,
 			    (void*)S[ Sfwd2 ].D ) ;
-    dagger_gauge( (void*)b , (void*)Fmunu[i].O[7+2*mu] ) ;
+    dagger_gauge( (void*)b , (void*)FMUNU( Fmunu , i , 7+2*mu ) ) ;
     colormatrix_halfspinor( (void*)D.D , (void*)b , (void*)S[ Sbck2 ].D ) ;
 
     // do the sum der = -5/2 S[i] + 4/3(A+B) - 1/12(C+D) 
@@ -205,9 +192,8 @@ gradsq_imp( struct halfspinor *der ,
 void
 gradsq_imp_sigmaB( struct halfspinor *der ,
 		   const struct halfspinor *S ,
-		   const struct field *Fmunu ,
-		   const size_t i ,
-		   const size_t t )
+		   const double complex *Fmunu ,
+		   const size_t i )
 {
 #ifdef HAVE_IMMMINTRIN_H
   __mm128d b[ NCNC ] ;
@@ -215,14 +201,12 @@ gradsq_imp_sigmaB( struct halfspinor *der ,
   double complex b[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
 #endif
   
-  const size_t Uidx = i + t*LCU ;
-
   zero_halfspinor( der ) ;
 
   // eww, lots of stack allocations here
   struct halfspinor sigmaB_S , Stmp , A , B , C , D ;
 
-  sigmaB_halfspinor( &sigmaB_S , Fmunu[i] , S[i] );
+  sigmaB_halfspinor( &sigmaB_S , Fmunu , i , S[i] );
   
   size_t mu ;
   for( mu = 0 ; mu < ND-1 ; mu++ ) {
@@ -233,22 +217,20 @@ gradsq_imp_sigmaB( struct halfspinor *der ,
     const size_t Sbck  = lat[ i ].back[mu] ;
     const size_t Sbck2 = lat[ Sbck ].back[mu] ;
     
-    const size_t Ubck = lat[ Uidx ].back[mu] ;
-
-    sigmaB_halfspinor( &Stmp , Fmunu[Sfwd]  , S[Sfwd] );
-    colormatrix_halfspinor( (void*)A.D , (void*)lat[ Uidx ].O[mu] ,
+    sigmaB_halfspinor( &Stmp , Fmunu , Sfwd , S[Sfwd] );
+    colormatrix_halfspinor( (void*)A.D , (void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 			    (void*)Stmp.D ) ;
     
-    sigmaB_halfspinor( &Stmp  , Fmunu[Sbck]  , S[Sbck] );
-    dagger_gauge( (void*)b , (void*)lat[ Ubck ].O[mu] ) ;
+    sigmaB_halfspinor( &Stmp , Fmunu , Sbck , S[Sbck] );
+    dagger_gauge( (void*)b , (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ) ;
     colormatrix_halfspinor( (void*)B.D , (void*)b , (void*)Stmp.D ) ;
 
-    sigmaB_halfspinor( &Stmp , Fmunu[Sfwd2] , S[Sfwd2] );
-    colormatrix_halfspinor( (void*)C.D , (void*)Fmunu[i].O[6+2*mu] ,
+    sigmaB_halfspinor( &Stmp , Fmunu , Sfwd2 , S[Sfwd2] );
+    colormatrix_halfspinor( (void*)C.D , (void*)FMUNU( Fmunu , i , 6+2*mu ) ,
 			    (void*)Stmp.D ) ;
     
-    sigmaB_halfspinor( &Stmp , Fmunu[Sbck2] , S[Sbck2] );
-    dagger_gauge( (void*)b , (void*)Fmunu[i].O[7+2*mu] ) ;
+    sigmaB_halfspinor( &Stmp , Fmunu , Sbck2 , S[Sbck2] );
+    dagger_gauge( (void*)b , (void*)FMUNU( Fmunu , i , 7+2*mu ) ) ;
     colormatrix_halfspinor( (void*)D.D , (void*)b , (void*)Stmp.D ) ;
 
     // do the sum der = -5/2 S[i] + 4/3(A+B) - 1/12(C+D) 
@@ -262,17 +244,14 @@ gradsq_imp_sigmaB( struct halfspinor *der ,
 void
 sigmaB_gradsq_imp( struct halfspinor *der ,
 		   const struct halfspinor *S ,
-		   const struct field *Fmunu ,
-		   const size_t i ,
-		   const size_t t )
+		   const double complex *Fmunu ,
+		   const size_t i )
 {
 #ifdef HAVE_IMMINTRIN_H
   __m128d b[ NCNC ] ;
 #else
   double complex b[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
 #endif
-  const size_t Uidx = i + t*LCU ;
-
   struct halfspinor res , A , B , C , D ; 
   zero_halfspinor( &res ) ;
 
@@ -285,16 +264,14 @@ sigmaB_gradsq_imp( struct halfspinor *der ,
     const size_t Sbck  = lat[ i ].back[mu] ;
     const size_t Sbck2 = lat[ Sbck ].back[mu] ;
     
-    const size_t Ubck = lat[ Uidx ].back[mu] ;
-
-    colormatrix_halfspinor( (void*)A.D ,(void*)lat[ Uidx ].O[mu] ,
+    colormatrix_halfspinor( (void*)A.D ,(void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 			    (void*)S[ Sfwd ].D ) ;
-    dagger_gauge( (void*)b , (void*)lat[ Ubck ].O[mu] ) ;
+    dagger_gauge( (void*)b , (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ) ;
     colormatrix_halfspinor( (void*)B.D , (void*)b ,(void*)S[ Sbck ].D ) ;
 
-    colormatrix_halfspinor( (void*)C.D , (void*)Fmunu[i].O[6+2*mu] ,
+    colormatrix_halfspinor( (void*)C.D , (void*)FMUNU( Fmunu , i , 6+2*mu ) ,
 			    (void*)S[ Sfwd2 ].D ) ;
-    dagger_gauge( (void*)b , (void*)Fmunu[i].O[7+2*mu] ) ;
+    dagger_gauge( (void*)b , (void*)FMUNU( Fmunu , i , 7+2*mu ) ) ;
     colormatrix_halfspinor( (void*)D.D , (void*)b , (void*)S[ Sbck2 ].D ) ;
 
     // do the sum der = -5/2 S[i] + 4/3(A+B) - 1/12(C+D) 
@@ -302,7 +279,7 @@ sigmaB_gradsq_imp( struct halfspinor *der ,
 	      (void*)C.D , (void*)D.D , (void*)S[i].D ) ;
   }
 
-  sigmaB_halfspinor( der , Fmunu[i] , res ) ;
+  sigmaB_halfspinor( der , Fmunu , i , res ) ;
   
   return ;
 }
@@ -201,9 +201,8 @@ grad4_inner( double complex *H ,
 void
 grad4( struct halfspinor *der ,
        const struct halfspinor *S ,
-       const struct field *Fmunu ,
+       const double complex *Fmunu ,
        const size_t i ,
-       const size_t t ,
        const size_t mu )
 {
 #ifdef HAVE_IMMINTRIN_H
@@ -212,25 +211,21 @@ grad4( struct halfspinor *der ,
   double complex C[ NCNC ] , D[ NCNC ] ;
 #endif
   
-  const size_t Uidx = i + t*LCU ;
-  
   const size_t Sfwd  = lat[ i ].neighbor[mu] ;
   const size_t Sfwd2 = lat[ Sfwd ].neighbor[mu] ;
   
   const size_t Sbck  = lat[ i ].back[mu] ;
   const size_t Sbck2 = lat[ Sbck ].back[mu] ;
   
-  const size_t Ubck = lat[ Uidx ].back[mu] ;
-
   zero_halfspinor( der ) ;
-  dagger_gauge( C , (const void*)lat[ Ubck ].O[mu] ) ;
-  dagger_gauge( D , (const void*)Fmunu[i].O[7+2*mu] ) ;
+  dagger_gauge( C , (const void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ) ;
+  dagger_gauge( D , (const void*)FMUNU( Fmunu , i , 7+2*mu ) ) ;
 
   struct halfspinor a , b , c , d ;
-  colormatrix_halfspinor( (void*)a.D , (const void*)lat[ Uidx ].O[mu] ,
+  colormatrix_halfspinor( (void*)a.D , (const void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
 			  (const void*)S[Sfwd].D ) ;
   colormatrix_halfspinor( (void*)b.D , C , (const void*)S[Sbck].D ) ;
-  colormatrix_halfspinor( (void*)c.D , (const void*)Fmunu[i].O[6+2*mu] ,
+  colormatrix_halfspinor( (void*)c.D , (const void*)FMUNU( Fmunu , i , 6+2*mu ) ,
 			  (const void*)S[Sfwd2].D ) ;
   colormatrix_halfspinor( (void*)d.D , D , (const void*)S[Sbck2].D ) ;
 
@@ -249,9 +244,8 @@ grad4( struct halfspinor *der ,
 void
 grad_sqsq( struct halfspinor *der2 ,
 	   const struct halfspinor *S ,
-	   const struct field *Fmunu ,
-	   const size_t i ,
-	   const size_t t )
+	   const double complex *Fmunu ,
+	   const size_t i )
 {
   struct halfspinor a , b , c , d ;
 #ifdef HAVE_IMMINTRIN_H
@@ -261,7 +255,6 @@ grad_sqsq( struct halfspinor *der2 ,
 #endif
   zero_halfspinor( der2 ) ;
   
-  const size_t Uidx = i + t*LCU ;
   size_t mu , nu ;
   
   // beginning of the mu-nu loop
@@ -269,17 +262,16 @@ grad_sqsq( struct halfspinor *der2 ,
 
     const size_t Sfwd = lat[ i ].neighbor[mu] ;
     const size_t Sbck = lat[ i ].back[mu] ;
-    const size_t Ubck = lat[ Uidx ].back[mu] ;
 
     const size_t S_PmPm = lat[ lat[i].neighbor[mu] ].neighbor[mu] ;
     const size_t S_MmMm = lat[ lat[i].back[mu] ].back[mu] ;
 
-    dagger_gauge( (void*)C , (const void*)lat[ Ubck ].O[mu] ) ;
-    dagger_gauge( (void*)D , (const void*)Fmunu[i].O[7+2*mu]  ) ;
+    dagger_gauge( (void*)C , (const void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ) ;
+    dagger_gauge( (void*)D , (const void*)FMUNU( Fmunu , i , 7+2*mu )  ) ;
 
-    colormatrix_halfspinor( (void*)a.D , (const void*)lat[ Uidx ].O[mu] , (const void*)S[ Sfwd ].D ) ;
+    colormatrix_halfspinor( (void*)a.D , (const void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) , (const void*)S[ Sfwd ].D ) ;
     colormatrix_halfspinor( (void*)b.D , C , (const void*)S[ Sbck ].D ) ;
-    colormatrix_halfspinor( (void*)c.D , (const void*)Fmunu[i].O[6+2*mu] , (const void*)S[ S_PmPm ].D ) ;
+    colormatrix_halfspinor( (void*)c.D , (const void*)FMUNU( Fmunu , i , 6+2*mu ) , (const void*)S[ S_PmPm ].D ) ;
     colormatrix_halfspinor( (void*)d.D , D , (const void*)S[ S_MmMm ].D ) ;
 
     sqsq_inner( (void*)der2 -> D ,
@@ -296,16 +288,15 @@ grad_sqsq( struct halfspinor *der2 ,
       const size_t S_MmPn = lat[ lat[i].back[mu] ].neighbor[nu] ;
       const size_t S_MmMn = lat[ lat[i].back[mu] ].back[nu] ;
 
-      const size_t U_Pm   = lat[ Uidx ].neighbor[mu] ;
-      const size_t U_Mm   = lat[ Uidx ].back[mu] ;
-      const size_t U_PmMn = lat[ lat[ Uidx ].neighbor[mu] ].back[nu] ;
-      const size_t U_MmMn = lat[ lat[ Uidx ].back[mu] ].back[nu] ;
-      
       // precompute these things
-      multab( A , (void*)lat[ Uidx ].O[mu] , (void*)lat[ U_Pm ].O[nu] ) ;
-      multabdag( B , (void*)lat[ U_Mm ].O[mu] , (void*)lat[ U_Mm ].O[nu] ) ;
-      multab_dag( C , (void*)lat[ Uidx ].O[mu] , (void*)lat[ U_PmMn ].O[nu]  ) ;
-      multab_dagdag( D , (void*)lat[ U_Mm ].O[mu] , (void*)lat[ U_MmMn ].O[nu] ) ;
+      multab( A , (void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
+	      (void*)FMUNU( Fmunu , Sfwd , FMUNU_LINK+nu ) ) ;
+      multabdag( B , (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ,
+		 (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+nu ) ) ;
+      multab_dag( C , (void*)FMUNU( Fmunu , i , FMUNU_LINK+mu ) ,
+		  (void*)FMUNU( Fmunu , S_PmMn , FMUNU_LINK+nu ) ) ;
+      multab_dagdag( D , (void*)FMUNU( Fmunu , Sbck , FMUNU_LINK+mu ) ,
+		     (void*)FMUNU( Fmunu , S_MmMn , FMUNU_LINK+nu ) ) ;
 
       colormatrix_halfspinor( (void*)a.D , A , (const void*)S[ S_PmPn ].D ) ;
       colormatrix_halfspinor( (void*)b.D , B , (const void*)S[ S_MmPn ].D ) ;
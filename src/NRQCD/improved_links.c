@@ -0,0 +1,325 @@
+/**
+   @file improved_links.c
+   @brief lazily built tadpole improved and twisted gauge field copies
+ */
+#define _GNU_SOURCE // sincos
+
+#include "common.h"
+
+#include "clover.h"           // compute_clovers()
+#include "evolve.h"           // NRQCD_up_front()
+#include <unistd.h>           // sysconf()
+
+// tadpole improve and twist the links of timeslice t of lat into L,
+// which holds consecutive timeslices from L -> first
+static void
+build_slice( struct NRQCD_links *L ,
+	     const struct site *lat ,
+	     const size_t t )
+{
+  const double tadpole = 1./( L -> U0 ) ;
+
+  // phase is exp( -I * theta_\mu * 2 * M_PI / Latt.dims[mu] )
+  // the factor of 2 is to keep it in line with momentum def
+  double s[ ND ] , c[ ND ] ;
+  size_t mu , i ;
+  for( mu = 0 ; mu < ND-1 ; mu++ ) {
+    sincos( TWOPI*L -> twist[mu]/Latt.dims[mu] , &s[mu] , &c[mu] ) ;
+  }
+
+  // where timeslice t sits in L
+  const size_t slot = ( t + LT - L -> first )%LT ;
+
+  #pragma omp for private(i)
+  for( i = LCU*t ; i < LCU*(t+1) ; i++ ) {
+    double complex *U = L -> U + ( i - LCU*t + LCU*slot )*ND*NCNC ;
+    #ifdef HAVE_IMMINTRIN_H
+    const __m128d *pO = (const __m128d*)lat[i].O ;
+    __m128d *pU = (__m128d*)U ;
+    register const __m128d tad = _mm_setr_pd( tadpole , tadpole ) ;
+    size_t j ;
+    for( j = 0 ; j < ND*NCNC ; j++ ) {
+      *pU = _mm_mul_pd( *pO , tad ) ;
+      pU++ ; pO++ ;
+    }
+    #else
+    size_t j ;
+    for( mu = 0 ; mu < ND ; mu++ ) {
+      for( j = 0 ; j < NCNC ; j++ ) {
+        U[ j + mu*NCNC ] = lat[i].O[mu][j] * tadpole ;
+      }
+    }
+    #endif
+    // twist only in the spatial directions
+    size_t nu ;
+    for( nu = 0 ; nu < ND-1 ; nu++ ) {
+      // skip if it is zero as it just multiplies by 1
+      if( fabs( L -> twist[ nu ] ) < NRQCD_TOL ) continue ;
+      #ifdef HAVE_IMMINTRIN_H
+      register const __m128d ph = _mm_setr_pd( c[nu] , s[nu] ) ;
+      pU = (__m128d*)( U + nu*NCNC ) ;
+      for( j = 0 ; j < NCNC ; j++ ) {
+	*pU = SSE2_MUL( *pU , ph ) ; pU++ ;
+      }
+      #else
+      const double complex phase = c[nu] + I*s[nu] ;
+      for( j = 0 ; j < NCNC ; j++ ) {
+        U[ j + nu*NCNC ] *= phase ;
+      }
+      #endif
+    }
+  }
+  return ;
+}
+
+// are these twists the same?
+static GLU_bool
+same_twist( const double t1[ ND ] ,
+	    const double t2[ ND ] )
+{
+  size_t mu ;
+  for( mu = 0 ; mu < ND ; mu++ ) {
+    if( t1[mu] != t2[mu] ) return GLU_FALSE ;
+  }
+  return GLU_TRUE ;
+}
+
+// make sure the timeslices the clovers of t need are built
+static void
+NRQCD_links_slices( struct NRQCD_links *L ,
+		    const size_t t )
+{
+  // the improved clovers reach two timeslices either side
+  size_t dt ;
+  for( dt = 0 ; dt < NRQCD_WINDOW ; dt++ ) {
+    const size_t ts = ( t + LT + dt - NRQCD_WINDOW/2 )%LT ;
+    if( L -> built[ ts ] == GLU_TRUE ) continue ;
+    build_slice( L , lat , ts ) ;
+    #pragma omp single
+    {
+      L -> built[ ts ] = GLU_TRUE ;
+    }
+  }
+  return ;
+}
+
+// rebuild the window around t, which is then its middle timeslice.
+// A copy is much cheaper than the clovers computed from it
+static void
+NRQCD_window_slices( struct NRQCD_links *L ,
+		     const size_t t )
+{
+  const size_t first = ( t + LT - NRQCD_WINDOW/2 )%LT ;
+  if( L -> first == first ) return ;
+  // everyone has to have seen the old first before it changes
+  #pragma omp barrier
+  #pragma omp single
+  {
+    L -> first = first ;
+  }
+  size_t dt ;
+  for( dt = 0 ; dt < NRQCD_WINDOW ; dt++ ) {
+    build_slice( L , lat , ( first + dt )%LT ) ;
+  }
+  return ;
+}
+
+// compute the clovers of timeslice t into the cache if they are not there
+static double complex *
+cached_clovers( struct NRQCD_links *L ,
+		const size_t t )
+{
+  double complex *Ft = L -> Fmunu + t*NFMUNU*LCU*NCNC ;
+  if( L -> have_clovers[ t ] == GLU_FALSE ) {
+    NRQCD_links_slices( L , t ) ;
+    compute_clovers( Ft , L , t ) ;
+    #pragma omp single
+    {
+      L -> have_clovers[ t ] = GLU_TRUE ;
+    }
+  }
+  return Ft ;
+}
+
+// put the clovers of timeslice t into the slab Fmunu, from the cache
+// if we keep one
+void
+NRQCD_clovers( double complex *Fmunu ,
+	       struct NRQCD_links *L ,
+	       const size_t t )
+{
+  if( L -> window == GLU_TRUE ) {
+    NRQCD_window_slices( L , t ) ;
+    compute_clovers( Fmunu , L , t ) ;
+    return ;
+  }
+  if( L -> Fmunu == NULL ) {
+    NRQCD_links_slices( L , t ) ;
+    compute_clovers( Fmunu , L , t ) ;
+    return ;
+  }
+  // the slabs share a layout so we can copy them in flat chunks
+  const double complex *Ft = cached_clovers( L , t ) ;
+  const size_t chunk = NFMUNU*NCNC ;
+  size_t i ;
+  #pragma omp for private(i)
+  for( i = 0 ; i < LCU ; i++ ) {
+    memcpy( Fmunu + i*chunk , Ft + i*chunk , chunk*sizeof( double complex ) ) ;
+  }
+  return ;
+}
+
+// keep the clovers of all timeslices of L if there is the memory for it
+int
+cache_NRQCD_clovers( struct NRQCD_links *L )
+{
+  // a window does not have the links to fill a cache
+  if( L -> window == GLU_TRUE ) {
+    return FAILURE ;
+  }
+  const size_t bytes = LT*NFMUNU*LCU*NCNC*sizeof( double complex ) ;
+#ifdef _SC_AVPHYS_PAGES
+  // leave at least as much again for everything else
+  const size_t avail = (size_t)sysconf( _SC_AVPHYS_PAGES ) *
+    (size_t)sysconf( _SC_PAGESIZE ) ;
+  if( 2*bytes > avail ) {
+    fprintf( stdout , "[NRQCD] not enough free memory to cache the clovers\n" ) ;
+    return FAILURE ;
+  }
+#endif
+  if( corr_malloc( (void**)&L -> Fmunu , ALIGNMENT , bytes ) != 0 ||
+      corr_malloc( (void**)&L -> have_clovers , ALIGNMENT ,
+		   LT*sizeof( GLU_bool ) ) != 0 ) {
+    fprintf( stdout , "[NRQCD] clover cache allocation failure\n" ) ;
+    if( L -> Fmunu != NULL ) {
+      free( L -> Fmunu ) ;
+      L -> Fmunu = NULL ;
+    }
+    return FAILURE ;
+  }
+  size_t t ;
+  for( t = 0 ; t < LT ; t++ ) {
+    L -> have_clovers[ t ] = GLU_FALSE ;
+  }
+  fprintf( stdout , "[NRQCD] caching %zu timeslices of clovers (%zu MB)\n" ,
+	   LT , bytes >> 20 ) ;
+  return SUCCESS ;
+}
+
+// free the link copies, props sharing one are all set to NULL
+int
+free_NRQCD_links( struct propagator *prop ,
+		  const size_t nprops ,
+		  const GLU_bool keep_pipes )
+{
+  size_t n , m ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    struct NRQCD_links *L = prop[n].links ;
+    if( L == NULL ) continue ;
+    // pipelined props still need theirs
+    GLU_bool keep = GLU_FALSE ;
+    for( m = 0 ; m < nprops && keep_pipes == GLU_TRUE ; m++ ) {
+      if( prop[m].links == L && prop[m].pipe != NULL ) keep = GLU_TRUE ;
+    }
+    if( keep == GLU_TRUE ) continue ;
+    for( m = 0 ; m < nprops ; m++ ) {
+      if( prop[m].links == L ) prop[m].links = NULL ;
+    }
+    if( L -> U != NULL ) {
+      free( L -> U ) ;
+    }
+    if( L -> built != NULL ) {
+      free( L -> built ) ;
+    }
+    if( L -> Fmunu != NULL ) {
+      free( L -> Fmunu ) ;
+    }
+    if( L -> have_clovers != NULL ) {
+      free( L -> have_clovers ) ;
+    }
+    free( L ) ;
+  }
+  return SUCCESS ;
+}
+
+// is p evolved forward as it is read?
+static GLU_bool
+is_pipelined( const struct propagator p )
+{
+  return ( p.basis == NREL_CORR && p.NRQCD.FWD == GLU_TRUE &&
+	   p.NRQCD.PIPELINE == GLU_TRUE ) ? GLU_TRUE : GLU_FALSE ;
+}
+
+// one link copy per ( U0 , twist ) for the props evolved up front,
+// nothing is built until it is asked for. A pipelined prop that
+// cannot share one of those gets a window of its own
+int
+init_NRQCD_links( struct propagator *prop ,
+		  const size_t nprops )
+{
+  size_t n , m , t ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( NRQCD_up_front( prop[n] ) == GLU_FALSE &&
+	is_pipelined( prop[n] ) == GLU_FALSE ) continue ;
+
+    // share with a prop that is evolved up front if we can
+    for( m = 0 ; m < nprops ; m++ ) {
+      if( prop[m].links != NULL &&
+	  prop[m].links -> window == GLU_FALSE &&
+	  prop[m].links -> U0 == prop[n].NRQCD.U0 &&
+	  same_twist( prop[m].links -> twist , prop[n].twist ) ) {
+	prop[n].links = prop[m].links ;
+	break ;
+      }
+    }
+    if( prop[n].links != NULL ) continue ;
+
+    // otherwise a pipelined prop only needs the timeslices around
+    // the one it is evolving, and another pipe may be at a different t
+    GLU_bool window = GLU_FALSE ;
+    if( NRQCD_up_front( prop[n] ) == GLU_FALSE ) {
+      window = GLU_TRUE ;
+      for( m = 0 ; m < nprops ; m++ ) {
+	if( NRQCD_up_front( prop[m] ) == GLU_TRUE &&
+	    prop[m].NRQCD.U0 == prop[n].NRQCD.U0 &&
+	    same_twist( prop[m].twist , prop[n].twist ) ) {
+	  window = GLU_FALSE ;
+	}
+      }
+    }
+    const size_t nslices = ( window == GLU_TRUE ) ? NRQCD_WINDOW : LT ;
+
+    struct NRQCD_links *L = NULL ;
+    if( corr_malloc( (void**)&L , ALIGNMENT ,
+		     sizeof( struct NRQCD_links ) ) != 0 ) {
+      fprintf( stderr , "[NRQCD] link cache allocation failure\n" ) ;
+      return FAILURE ;
+    }
+    L -> U = NULL ; L -> built = NULL ;
+    L -> Fmunu = NULL ; L -> have_clovers = NULL ;
+    L -> window = window ;
+    // a window is not anywhere until it is first built
+    L -> first = ( window == GLU_TRUE ) ? LT : 0 ;
+    prop[n].links = L ;
+    if( corr_malloc( (void**)&L -> U , ALIGNMENT ,
+		     nslices*LCU*ND*NCNC*sizeof( double complex ) ) != 0 ) {
+      fprintf( stderr , "[NRQCD] improved gauge field allocation failure\n" ) ;
+      return FAILURE ;
+    }
+    if( window == GLU_FALSE ) {
+      if( corr_malloc( (void**)&L -> built , ALIGNMENT ,
+		       LT*sizeof( GLU_bool ) ) != 0 ) {
+	fprintf( stderr , "[NRQCD] improved gauge field allocation failure\n" ) ;
+	return FAILURE ;
+      }
+      for( t = 0 ; t < LT ; t++ ) {
+	L -> built[ t ] = GLU_FALSE ;
+      }
+    }
+    L -> U0 = prop[n].NRQCD.U0 ;
+    for( m = 0 ; m < ND ; m++ ) {
+      L -> twist[ m ] = prop[n].twist[ m ] ;
+    }
+  }
+  return SUCCESS ;
+}
@@ -6,7 +6,10 @@
 
 #include "GLU_timer.h"
 #include "evolve.h"
+#include "geometry.h"         // tiled_sites()
+#include "improved_links.h"   // init_NRQCD_links()
 #include "plaqs_links.h"      // average_plaquette()
+#include "stored_props.h"     // load_NRQCD_props()
 
 // free the allocated NRQCD fields
 static int
@@ -19,36 +22,196 @@ free_NRQCD_fields( struct NRQCD_fields *F )
   if( F -> S1 != NULL ) {
     free( F -> S1 ) ;
   }
-  if( F -> S2 != NULL ) {
-    free( F -> S2 ) ;
-  }
   if( F -> H != NULL ) {
     free( F -> H ) ;
   }
 
-  // free the field strength tensor
-  size_t i ;
-  for( i = 0 ; i < LCU ; i++ ) {
-    size_t j ;
-    for( j = 0 ; j < (NS-1)*(NS-2)+2*(ND-1) ; j++ ) {
-      if( F -> Fmunu[i].O[j] != NULL ) {
-	free( F -> Fmunu[i].O[j] ) ;
-      }
-    }
-    if( F -> Fmunu[i].O != NULL ) {
-      free( F -> Fmunu[i].O ) ;
+  // and the cached derivatives
+  size_t mu ;
+  for( mu = 0 ; mu < ND-1 ; mu++ ) {
+    if( F -> D.grad[mu] != NULL ) {
+      free( F -> D.grad[mu] ) ;
     }
   }
+  if( F -> D.lapl != NULL ) {
+    free( F -> D.lapl ) ;
+  }
+  if( F -> D.lapl2 != NULL ) {
+    free( F -> D.lapl2 ) ;
+  }
+  if( F -> D.lapl_imp != NULL ) {
+    free( F -> D.lapl_imp ) ;
+  }
+  if( F -> D.sigmaB != NULL ) {
+    free( F -> D.sigmaB ) ;
+  }
+
+  // free the field strength tensor
   if( F -> Fmunu != NULL ) {
     free( F -> Fmunu ) ;
   }
+  if( F -> order != NULL ) {
+    free( F -> order ) ;
+  }
+
+  // and the single precision copies
+  if( F -> Sf != NULL ) {
+    free( F -> Sf ) ;
+  }
+  if( F -> S1f != NULL ) {
+    free( F -> S1f ) ;
+  }
+  if( F -> Uf != NULL ) {
+    free( F -> Uf ) ;
+  }
+  return SUCCESS ;
+}
+
+// allocate one halfspinor field if we need it
+static int
+allocate_deriv( struct halfspinor **D ,
+		const GLU_bool need ,
+		const size_t Nhalf )
+{
+  if( need == GLU_FALSE ) return SUCCESS ;
+  if( corr_malloc( (void**)D , ALIGNMENT , Nhalf*sizeof( struct halfspinor ) ) != 0 ) {
+    fprintf( stderr , "[NRQCD] derivative cache allocation failure\n" ) ;
+    return FAILURE ;
+  }
+  return SUCCESS ;
+}
+
+// allocate Nsrc sources worth of NRQCD temporaries, the derivative
+// caches are only allocated if one of the NRQCD props uses them
+static int
+allocate_NRQCD_fields( struct NRQCD_fields *F ,
+		       const size_t Nsrc ,
+		       const struct propagator *prop ,
+		       const size_t nprops )
+{
+  // initialise all temporary fields to null
+  F -> S = F -> H = F -> S1 = NULL ; F -> Fmunu = NULL ; F -> order = NULL ;
+  F -> Sf = F -> S1f = NULL ; F -> Uf = NULL ;
+  size_t mu ;
+  for( mu = 0 ; mu < ND-1 ; mu++ ) {
+    F -> D.grad[mu] = NULL ;
+  }
+  F -> D.lapl = F -> D.lapl2 = F -> D.lapl_imp = F -> D.sigmaB = NULL ;
+  F -> Nsrc = Nsrc ;
+  const size_t Nhalf = Nsrc*LCU ;
+
+  // usual allocations F.S is the prop, F.H the summed hamiltonian
+  if( corr_malloc( (void**)&F -> S  , ALIGNMENT , Nhalf*sizeof( struct halfspinor ) ) != 0 ||
+      corr_malloc( (void**)&F -> S1 , ALIGNMENT , Nhalf*sizeof( struct halfspinor ) ) != 0 ||
+      corr_malloc( (void**)&F -> H  , ALIGNMENT , Nhalf*sizeof( struct halfspinor ) ) != 0 ) {
+    fprintf( stderr , "[NRQCD] temporary halfspinor allocation failure\n" ) ;
+    return FAILURE ;
+  }
+
+  // which derivatives of S do the terms share?
+  GLU_bool grad = GLU_FALSE , lapl = GLU_FALSE ;
+  GLU_bool lapl_imp = GLU_FALSE , sigmaB = GLU_FALSE ;
+  GLU_bool single = GLU_FALSE ;
+  size_t n ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( prop[n].basis != NREL_CORR ) continue ;
+    const struct NRQCD_params P = prop[n].NRQCD ;
+    if( P.PRECISION == SINGLE ) {
+      single = GLU_TRUE ;
+    }
+    if( fabs( P.C2 ) > NRQCD_TOL || fabs( P.C3 ) > NRQCD_TOL ||
+	fabs( P.C8 ) > NRQCD_TOL ) {
+      grad = GLU_TRUE ;
+    }
+    if( fabs( P.C1 ) > NRQCD_TOL || fabs( P.C6 ) > NRQCD_TOL ||
+	fabs( P.C11 ) > NRQCD_TOL ) {
+      lapl = GLU_TRUE ;
+    }
+    if( fabs( P.C7 ) > NRQCD_TOL || fabs( P.C8 ) > NRQCD_TOL ) {
+      lapl_imp = GLU_TRUE ;
+    }
+    if( fabs( P.C4 ) > NRQCD_TOL || fabs( P.C7 ) > NRQCD_TOL ) {
+      sigmaB = GLU_TRUE ;
+    }
+  }
+  for( mu = 0 ; mu < ND-1 ; mu++ ) {
+    if( allocate_deriv( &F -> D.grad[mu] , grad , Nhalf ) == FAILURE ) {
+      return FAILURE ;
+    }
+  }
+  if( allocate_deriv( &F -> D.lapl , lapl , Nhalf ) == FAILURE ||
+      allocate_deriv( &F -> D.lapl2 , lapl , Nhalf ) == FAILURE ||
+      allocate_deriv( &F -> D.lapl_imp , lapl_imp , Nhalf ) == FAILURE ||
+      allocate_deriv( &F -> D.sigmaB , sigmaB , Nhalf ) == FAILURE ) {
+    return FAILURE ;
+  }
+
+  // allocate the clovers as one slab
+  if( corr_malloc( (void**)&F -> Fmunu , ALIGNMENT ,
+		   NFMUNU*LCU*NCNC*sizeof( double complex ) ) != 0 ) {
+    fprintf( stderr , "[NRQCD] clover allocation failure\n" ) ;
+    return FAILURE ;
+  }
+
+  // sweep the timeslice in tiles so neighbours are reused from cache
+  if( corr_malloc( (void**)&F -> order , ALIGNMENT , LCU*sizeof( size_t ) ) != 0 ) {
+    fprintf( stderr , "[NRQCD] site order allocation failure\n" ) ;
+    return FAILURE ;
+  }
+  tiled_sites( F -> order , NRQCD_TILE ) ;
+
+  // single precision evolution temporaries
+  if( single == GLU_TRUE ) {
+    if( corr_malloc( (void**)&F -> Sf , ALIGNMENT ,
+		     Nhalf*sizeof( struct halfspinor_split ) ) != 0 ||
+	corr_malloc( (void**)&F -> S1f , ALIGNMENT ,
+		     Nhalf*sizeof( struct halfspinor_split ) ) != 0 ||
+	corr_malloc( (void**)&F -> Uf , ALIGNMENT ,
+		     LCU*(ND+1)*2*NCNC*sizeof( float ) ) != 0 ) {
+      fprintf( stderr , "[NRQCD] single precision temporary allocation failure\n" ) ;
+      return FAILURE ;
+    }
+  }
+  return SUCCESS ;
+}
+
+// pipelined props keep their own evolution state
+static int
+init_NRQCD_pipes( struct propagator *prop ,
+		  const size_t nprops )
+{
+  size_t n ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( prop[n].basis != NREL_CORR ||
+	prop[n].NRQCD.FWD == GLU_FALSE ||
+	prop[n].NRQCD.PIPELINE == GLU_FALSE ) continue ;
+
+    // contractions ask for the global timeslice so we need all of it
+    if( (const size_t)T_NRQCD != LT ) {
+      fprintf( stderr , "[NRQCD] pipelined props need T_NRQCD == LT\n" ) ;
+      return FAILURE ;
+    }
+
+    if( corr_malloc( (void**)&prop[n].pipe , ALIGNMENT ,
+		     sizeof( struct NRQCD_pipe ) ) != 0 ) {
+      fprintf( stderr , "[NRQCD] pipeline allocation failure\n" ) ;
+      return FAILURE ;
+    }
+    prop[n].pipe -> nsteps = 0 ;
+    prop[n].pipe -> hit = 0 ;
+    prop[n].pipe -> started = GLU_FALSE ;
+    // only the hit being contracted is evolved
+    if( allocate_NRQCD_fields( &prop[n].pipe -> F , 1 ,
+			       &prop[n] , 1 ) == FAILURE ) {
+      return FAILURE ;
+    }
+  }
   return SUCCESS ;
 }
 
 static GLU_bool
 is_fly_NRQCD( struct propagator *prop ,
 	      double *tadref ,
-	      GLU_bool *HAVE_C11 ,
 	      const size_t nprops )
 {
   GLU_bool FLY_NREL = GLU_FALSE ;
@@ -60,27 +223,24 @@ is_fly_NRQCD( struct propagator *prop ,
     if( prop[n].basis == NREL_CORR ) {
       FLY_NREL = GLU_TRUE ;
       // allocate the heavy propagator
-      if( prop[n].NRQCD.FWD == GLU_TRUE ) {
-	if( corr_malloc( (void**)&prop[n].Hfwd ,
-			 ALIGNMENT ,
-			 T_NRQCD*LCU*sizeof( struct halfspinor_f ) ) != 0 ) {
+      if( prop[n].NRQCD.FWD == GLU_TRUE &&
+	  prop[n].NRQCD.PIPELINE == GLU_FALSE ) {
+	if( corr_malloc( (void**)&prop[n].Hfwd , ALIGNMENT ,
+			 prop[n].Source.Nhits*T_NRQCD*LCU*
+			 sizeof( struct halfspinor_f ) ) != 0 ) {
 	  fprintf( stderr , "[NRQCD] heavy bwd prop allocation failure\n" ) ;
 	  return GLU_FALSE ;
 	}
       }
       if( prop[n].NRQCD.BWD == GLU_TRUE ) {
 	// allocate the heavy propagator
-	if( corr_malloc( (void**)&prop[n].Hbwd ,
-			 ALIGNMENT ,
-			 T_NRQCD*LCU*sizeof( struct halfspinor_f ) ) != 0 ) {
+	if( corr_malloc( (void**)&prop[n].Hbwd , ALIGNMENT ,
+			 prop[n].Source.Nhits*T_NRQCD*LCU*
+			 sizeof( struct halfspinor_f ) ) != 0 ) {
 	  fprintf( stderr , "[NRQCD] heavy fwd prop allocation failure\n" ) ;
 	  return GLU_FALSE ;
 	}
       }
-      // this one needs another temporary
-      if( fabs( prop[n].NRQCD.C11 ) > NRQCD_TOL ) {
-	*HAVE_C11 = GLU_TRUE ;
-      }
       // compare tadpole factors
       if( fabs( *tadref ) < NRQCD_TOL ) {
 	*tadref = prop[n].NRQCD.U0 ;
@@ -100,11 +260,90 @@ is_fly_NRQCD( struct propagator *prop ,
   return FLY_NREL ;
 }
 
+// each of the npass passes of a contraction reads each of the
+// distinct props in its map once
+static void
+add_reads( size_t *nreads ,
+	   const size_t *map ,
+	   const size_t nmap ,
+	   const size_t npass )
+{
+  size_t i , j ;
+  for( i = 0 ; i < nmap ; i++ ) {
+    for( j = 0 ; j < i ; j++ ) {
+      if( map[j] == map[i] ) break ;
+    }
+    if( j == i ) nreads[ map[i] ] += npass ;
+  }
+  return ;
+}
+
+// how many sweeps of the contractions read each of the props, the
+// mesons make a pass per noise hit
+static void
+count_prop_reads( size_t *nreads ,
+		  const struct propagator *prop ,
+		  const struct input_info inputs )
+{
+  size_t n ;
+  for( n = 0 ; n < inputs.nprops ; n++ ) {
+    nreads[n] = 0 ;
+  }
+  for( n = 0 ; n < inputs.nbaryons ; n++ ) {
+    add_reads( nreads , inputs.baryons[n].map , 3 , 1 ) ;
+  }
+  for( n = 0 ; n < inputs.ndiquarks ; n++ ) {
+    add_reads( nreads , inputs.diquarks[n].map , 2 , 1 ) ;
+  }
+  for( n = 0 ; n < inputs.nmesons ; n++ ) {
+    const size_t *map = inputs.mesons[n].map ;
+    const size_t Nhits = prop[ map[0] ].Source.Nhits > prop[ map[1] ].Source.Nhits ?
+      prop[ map[0] ].Source.Nhits : prop[ map[1] ].Source.Nhits ;
+    add_reads( nreads , map , 2 , Nhits ) ;
+  }
+  for( n = 0 ; n < inputs.npentas ; n++ ) {
+    add_reads( nreads , inputs.pentas[n].map , 5 , 1 ) ;
+  }
+  for( n = 0 ; n < inputs.ntetras ; n++ ) {
+    add_reads( nreads , inputs.tetras[n].map , 4 , 1 ) ;
+  }
+  for( n = 0 ; n < inputs.nVPF ; n++ ) {
+    add_reads( nreads , inputs.VPF[n].map , 2 , 1 ) ;
+  }
+  for( n = 0 ; n < inputs.nWME ; n++ ) {
+    add_reads( nreads , inputs.wme[n].map , 4 , 1 ) ;
+  }
+  return ;
+}
+
+// keep the clovers of links read by more than one evolution, called
+// once everything else the evolution needs is allocated
+static void
+cache_shared_clovers( struct propagator *prop ,
+		      const size_t nprops ,
+		      const size_t *nreads )
+{
+  size_t n , m ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( prop[n].links == NULL ) continue ;
+    for( m = 0 ; m < n ; m++ ) {
+      if( prop[m].links == prop[n].links ) break ;
+    }
+    if( m == n &&
+	NRQCD_link_sweeps( prop , nprops , nreads , prop[n].links ) > 1 ) {
+      cache_NRQCD_clovers( prop[n].links ) ;
+    }
+  }
+  return ;
+}
+
 // compute our various NRQCD propagators
 int
 compute_nrqcd_props( struct propagator *prop ,
-		     const size_t nprops )
+		     const struct input_info inputs )
 {
+  const size_t nprops = inputs.nprops ;
+
   // check for an empty gauge field
   if( lat == NULL ) {
     fprintf( stderr , "[NRQCD] Empty gauge field, add with -c on command line\n" ) ;
@@ -114,9 +353,7 @@ compute_nrqcd_props( struct propagator *prop ,
   // loop propagators checking to see if any are non-rel
   // check tadpole factors are the same
   double tadref = 0.0 ;
-  GLU_bool HAVE_C11 = GLU_FALSE ;
-  GLU_bool FLY_NREL = is_fly_NRQCD( prop , &tadref , &HAVE_C11 , nprops  ) ;
-  size_t i ;
+  GLU_bool FLY_NREL = is_fly_NRQCD( prop , &tadref , nprops  ) ;
 
   // if we aren't doing any NRQCD props then we successfully do nothing
   if( FLY_NREL == GLU_FALSE ) {
@@ -132,42 +369,43 @@ compute_nrqcd_props( struct propagator *prop ,
 	     (size_t)T_NRQCD , LT ) ;
   }
   
+  // props stored by an earlier run are read instead of evolved
+  load_NRQCD_props( prop , nprops ) ;
+
+  // the improved links are built as they are needed and pipelined
+  // props keep their own state for evolving later
+  if( init_NRQCD_links( prop , nprops ) == FAILURE ||
+      init_NRQCD_pipes( prop , nprops ) == FAILURE ) {
+    return FAILURE ;
+  }
+
+  // pipelined props are evolved again by every sweep that reads them
+  size_t nreads[ nprops ] ;
+  count_prop_reads( nreads , prop , inputs ) ;
+
   // otherwise we initialise all this gubbins
   struct NRQCD_fields F ;
 
-  // initialise all temporary fields to null
-  F.S = F.H = F.S1 = F.S2 = NULL ; F.Fmunu = NULL ;
-
-  // usual allocations F.S is the prop, F.H the summed hamiltonian
-  if( corr_malloc( (void**)&F.S  , ALIGNMENT , LCU*sizeof( struct halfspinor ) ) != 0 ||
-      corr_malloc( (void**)&F.S1 , ALIGNMENT , LCU*sizeof( struct halfspinor ) ) != 0 ||
-      corr_malloc( (void**)&F.H  , ALIGNMENT , LCU*sizeof( struct halfspinor ) ) != 0 ) {
-    fprintf( stderr , "[NRQCD] temporary halfspinor allocation failure\n" ) ;
-    goto memfree ;
-  }
+  // props sharing an evolution are done together
+  const size_t Nsrc = NRQCD_batch_size( prop , nprops ) ;
 
-  // C11 needs another temporary
-  if( HAVE_C11 == GLU_TRUE ) {
-    if( corr_malloc( (void**)&F.S2 , ALIGNMENT , LCU*sizeof( struct halfspinor ) ) != 0 ) {
-      fprintf( stderr , "[NRQCD] temporary halfspinor for C11 allocation failure\n" ) ;
-      goto memfree ;
-    }
+  // everything might be pipelined or read back
+  if( Nsrc == 0 ) {
+    fprintf( stdout , "[NRQCD] no props left to evolve up front\n" ) ;
+    cache_shared_clovers( prop , nprops , nreads ) ;
+    free_NRQCD_links( prop , nprops , GLU_TRUE ) ;
+    Latt.dims[ ND-1 ] = (const size_t)T_NRQCD ;
+    return SUCCESS ;
   }
+  fprintf( stdout , "[NRQCD] evolving up to %zu source(s) together\n" , Nsrc ) ;
 
-  // allocate the gauge field
-  if( corr_malloc( (void**)&F.Fmunu , ALIGNMENT , LCU*sizeof( struct field ) ) != 0 ) {
-    fprintf( stderr , "[NRQCD] clover allocation failure\n" ) ;
+  int flag = FAILURE ;
+  if( allocate_NRQCD_fields( &F , Nsrc , prop , nprops ) == FAILURE ) {
     goto memfree ;
   }
-  for( i = 0 ; i < LCU ; i++ ) {
-    corr_malloc( (void**)&F.Fmunu[i].O , ALIGNMENT ,
-		 ((NS-1)*(NS-2)+2*(ND-1))*sizeof( double complex* ) ) ;
-    size_t j ;
-    for( j = 0 ; j < (NS-1)*(NS-2)+2*(ND-1) ; j++ ) {
-      corr_malloc( (void**)&F.Fmunu[i].O[j] , ALIGNMENT ,
-		   NCNC*sizeof( double complex ) ) ;
-    }
-  }
+
+  // the cache only gets what is left over after the fields
+  cache_shared_clovers( prop , nprops , nreads ) ;
 
   // initialise the timer
   start_timer() ;
@@ -175,20 +413,28 @@ compute_nrqcd_props( struct propagator *prop ,
 #pragma omp parallel
   {
     // compute the propagators
-    compute_props( prop , &F , lat , nprops , tadref ) ;
+    compute_props( prop , &F , nprops ) ;
   }
 
   // tell us the time it took
   print_time() ;
 
+  // keep the ones we were asked to for the next run
+  store_NRQCD_props( prop , nprops ) ;
+
   // change the global temporal length to match the NRQCD one we set
   Latt.dims[ND-1] = (const size_t)T_NRQCD ;
 
+  flag = SUCCESS ;
+
  memfree :
 
   free_NRQCD_fields( &F ) ;
+
+  // only the pipelined props need their links from now on
+  free_NRQCD_links( prop , nprops , GLU_TRUE ) ;
     
-  return SUCCESS ;
+  return flag ;
 }
 
 int
@@ -204,5 +450,13 @@ free_nrqcd_props( struct propagator *prop ,
       free( prop[n].Hbwd ) ;
     }
   }
+  free_NRQCD_links( prop , nprops , GLU_FALSE ) ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( prop[n].pipe != NULL ) {
+      free_NRQCD_fields( &prop[n].pipe -> F ) ;
+      free( prop[n].pipe ) ;
+      prop[n].pipe = NULL ;
+    }
+  }
   return SUCCESS ;
 }
@@ -6,7 +6,7 @@
 
 #include "geometry.h"       // get_eipx()
 #include "halfspinor_ops.h" // zero_halfspinor
-#include "par_rng.h"        //
+#include "par_rng.h"        // cb_rng()
 #include "quark_smear.h"    // quark_source_smear()
 
 // set propagator to IdentityxConstant
@@ -37,11 +37,15 @@ set_prop_to_constant( struct halfspinor *S ,
   return ;
 }
 
-// for the moment point is at (0,0,0,t)
+// for the moment point is at (0,0,0,t), noise is keyed on the global
+// site of the source timeslice and the hit so it is the same for any
+// number of threads
 int
 initialise_source( struct halfspinor *S ,
 		   struct halfspinor *S1 ,
-		   const struct propagator prop ) 
+		   const double complex *Fmunu ,
+		   const struct propagator prop ,
+		   const size_t hit ) 
 {
   size_t i ;
   int or[ NS ] , flag = SUCCESS ;
@@ -51,8 +55,8 @@ initialise_source( struct halfspinor *S ,
   or[ ND-1 ] = 0 ;
 
   // function pointer for stochastic sources
-  double complex (*noise)( const uint32_t thread ) ;
-  noise = Z2xZ2 ;
+  double complex (*noise)( const uint64_t r ) ;
+  noise = cb_Z2xZ2 ;
 
   switch( prop.Source.type ) {
   case POINT : break ;
@@ -60,27 +64,28 @@ initialise_source( struct halfspinor *S ,
   case Z2_WALL :
     #pragma omp single
     {
-      flag = initialise_par_rng( NULL ) ;
+      flag = cb_rng_seed( ) ;
     }
     break ;
   case Z3_WALL :
-    noise = Z3 ;
+    noise = cb_Z3 ;
     #pragma omp single
     {
-      flag = initialise_par_rng( NULL ) ;
+      flag = cb_rng_seed( ) ;
     }
     break ;
   case U1_WALL :
-    noise = U1 ;
+    noise = cb_U1 ;
     #pragma omp single
     {
-      flag = initialise_par_rng( NULL ) ;
+      flag = cb_rng_seed( ) ;
     }
     break ;
   }
 
   // point source position
   const size_t idx = gen_site( or ) ;
+  const size_t tsrc = LCU*( prop.origin[ND-1]%LT ) ;
   const size_t Z2_sub = ( prop.Source.Z2_spacing > 1 ?\
 			  prop.Source.Z2_spacing/2 : 1 ) ;
     
@@ -129,9 +134,10 @@ initialise_source( struct halfspinor *S ,
     case Z3_WALL :
     case U1_WALL :
       if( sparse == GLU_TRUE ) {
-	set_prop_to_constant( &S[ i ] , 
-			      get_eipx( prop.mom_source , i , ND-1 )
-			      * noise( get_CORR_thread() ) ) ;
+	// one noise value per site on the whole diagonal, diluting in
+	// spin would kill the spin off-diagonal source gammas
+	set_prop_to_constant( &S[ i ] , get_eipx( prop.mom_source , i , ND-1 ) *
+			      noise( cb_rng( Latt.Seed , i + tsrc , hit , 0 , 0 ) ) ) ;
       }
       break ;
     }
@@ -143,21 +149,7 @@ initialise_source( struct halfspinor *S ,
   // momentum source too and get more or less the same result
   // Also, doesn't need to be a point source or anything
   if( prop.Source.smear == QUARK ) {
-    source_smear( S , S1 , prop.origin[ND-1] , prop.Source ) ;
-  }
-  
-  // clean up the RNG
-  switch( prop.Source.type ) {
-  case POINT : break ;
-  case WALL : break ;
-  case Z2_WALL :
-  case Z3_WALL :
-  case U1_WALL :
-    #pragma omp single
-    {
-      free_par_rng( ) ;
-    }
-    break ;
+    source_smear( S , S1 , Fmunu , prop.Source ) ;
   }
     
   return flag ;
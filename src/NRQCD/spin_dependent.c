@@ -44,11 +44,11 @@
 // I then dot in whichever sigma matrix we are using in this round
 static void
 sigma_dot_grad_x_E( struct halfspinor *H ,
-		    const struct field *Fmunu ,
+		    const double complex *Fmunu ,
 		    const struct halfspinor *S ,
+		    const struct NRQCD_derivs *D ,
 		    const double U_0 ,
 		    const size_t i ,
-		    const size_t t ,
 		    const size_t mu1 ,
 		    const size_t mu2 ,
 		    const uint8_t sigma_map[ NS ] ,
@@ -59,14 +59,25 @@ sigma_dot_grad_x_E( struct halfspinor *H ,
 				(imap[2]+2)%4 , (imap[3]+2)%4 } ;
 
   struct halfspinor res ;
-  grad_imp_FMUNU( &res , S , Fmunu , U_0 , i , t , mu1 , 3+mu2 ) ;
+  grad_imp_FMUNU( &res , S , Fmunu , U_0 , i , mu1 , 3+mu2 ) ;
   halfspinor_sigma_Saxpy( H , res , sigma_map , imap ) ;
-  grad_imp_FMUNU( &res , S , Fmunu , U_0 , i , t , mu2 , 3+mu1 ) ;
+  grad_imp_FMUNU( &res , S , Fmunu , U_0 , i , mu2 , 3+mu1 ) ;
   halfspinor_sigma_Saxpy( H , res , sigma_map , mimap ) ;
 
-  FMUNU_grad_imp( &res , S , Fmunu , U_0 , i , t , mu1 , 3+mu2 ) ;
+  // the gradients of S are cached in D if we have it
+  if( D != NULL ) {
+    colormatrix_halfspinor( (void*)res.D , (const void*)FMUNU( Fmunu , i , 3+mu2 ) ,
+			    (const void*)D -> grad[mu1][i].D ) ;
+  } else {
+    FMUNU_grad_imp( &res , S , Fmunu , U_0 , i , mu1 , 3+mu2 ) ;
+  }
   halfspinor_sigma_Saxpy( H , res , sigma_map , imap ) ;
-  FMUNU_grad_imp( &res , S , Fmunu , U_0 , i , t , mu2 , 3+mu1 ) ;
+  if( D != NULL ) {
+    colormatrix_halfspinor( (void*)res.D , (const void*)FMUNU( Fmunu , i , 3+mu1 ) ,
+			    (const void*)D -> grad[mu2][i].D ) ;
+  } else {
+    FMUNU_grad_imp( &res , S , Fmunu , U_0 , i , mu2 , 3+mu1 ) ;
+  }
   halfspinor_sigma_Saxpy( H , res , sigma_map , mimap ) ;
   
   return ;
@@ -74,28 +85,28 @@ sigma_dot_grad_x_E( struct halfspinor *H ,
 
 
 // does \sigma.( \grad x E - E x \grad ) S
-static void
+void
 sigma_gradxE( struct halfspinor *H , 
-	      const struct field *Fmunu ,
+	      const double complex *Fmunu ,
 	      const struct halfspinor *S ,
+	      const struct NRQCD_derivs *D ,
 	      const double U_0 ,
-	      const size_t i ,
-	      const size_t t )
+	      const size_t i )
 {
   zero_halfspinor( H ) ;
   
   // First is the x - direction
   const uint8_t sigma_x[ NS ] = { 2 , 3 , 0 , 1 } ;
   const uint8_t imapx[NS] = { 0 , 0 , 0 , 0 } ;
-  sigma_dot_grad_x_E( H , Fmunu , S , U_0 , i , t , 1 , 2 , sigma_x , imapx ) ;
+  sigma_dot_grad_x_E( H , Fmunu , S , D , U_0 , i , 1 , 2 , sigma_x , imapx ) ;
   // Second is the y - direction
   const uint8_t sigma_y[NS] = { 2 , 3 , 0 , 1 } ;
   const uint8_t imapy[NS] = { 3 , 3 , 1 , 1 } ;
-  sigma_dot_grad_x_E( H , Fmunu , S , U_0 , i , t , 2 , 0 , sigma_y , imapy ) ;
+  sigma_dot_grad_x_E( H , Fmunu , S , D , U_0 , i , 2 , 0 , sigma_y , imapy ) ;
   // third is the z-direction
   const uint8_t sigma_z[NS] = { 0 , 1 , 2 , 3} ;
   const uint8_t imapz[NS] = { 0 , 0 , 2 , 2 } ;
-  sigma_dot_grad_x_E( H , Fmunu , S , U_0 , i , t , 0 , 1 , sigma_z , imapz ) ;
+  sigma_dot_grad_x_E( H , Fmunu , S , D , U_0 , i , 0 , 1 , sigma_z , imapz ) ;
   
   return ;
 }
@@ -104,9 +115,9 @@ sigma_gradxE( struct halfspinor *H ,
 void
 term_C3( struct halfspinor *H ,
 	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const struct NRQCD_derivs *D ,
+	 const double complex *Fmunu ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C3 ) < NRQCD_TOL ) return ;
@@ -114,7 +125,7 @@ term_C3( struct halfspinor *H ,
   const double fac = -NRQCD.C3 / ( 2. * pow( 2*NRQCD.M_0 , 2 ) ) ;
 
   struct halfspinor res ;
-  sigma_gradxE( &res , Fmunu , S , NRQCD.U0 , i , t ) ;
+  sigma_gradxE( &res , Fmunu , S , D , NRQCD.U0 , i ) ;
 
   halfspinor_Saxpy( H , res , fac ) ;
   
@@ -124,20 +135,15 @@ term_C3( struct halfspinor *H ,
 // sigma.B*G
 void
 term_C4( struct halfspinor *H ,
-	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const struct NRQCD_derivs *D ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C4 ) < NRQCD_TOL ) return ;
   
   const double fac = -NRQCD.C4 / ( 2. * NRQCD.M_0 ) ;
 
-  struct halfspinor res ;
-  sigmaB_halfspinor( &res , Fmunu[i] , S[i] ) ;
-
-  halfspinor_Saxpy( H , res , fac ) ;
+  halfspinor_Saxpy( H , D -> sigmaB[i] , fac ) ;
 
   return ;
 }
@@ -145,68 +151,57 @@ term_C4( struct halfspinor *H ,
 // this term is { grad^2 , \sigma.B } G
 void
 term_C7( struct halfspinor *H ,
-	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const struct NRQCD_derivs *D ,
+	 const double complex *Fmunu ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C7 ) < NRQCD_TOL ) return ;
   
   const double fac = -NRQCD.C7 / ( pow( 2*NRQCD.M_0 , 3 ) ) ;
 
+  // sigma.B grad^2 S
   struct halfspinor res ;
-  sigmaB_gradsq_imp( &res , S , Fmunu , i , t ) ;
+  sigmaB_halfspinor( &res , Fmunu , i , D -> lapl_imp[i] ) ;
   halfspinor_Saxpy( H , res , fac ) ;
-  
-  gradsq_imp_sigmaB( &res , S , Fmunu , i , t ) ;
+
+  // grad^2 sigma.B S
+  gradsq_imp( &res , D -> sigmaB , Fmunu , i ) ;
   halfspinor_Saxpy( H , res , fac ) ;
   
   return ;
 }
 
-// this term is even worse than c3 -> use yet another temporary
+// this term is even worse than c3, X is the field
+// \sigma.( \grad x E - E x \grad ) S computed beforehand
 void
-term_C8( struct NRQCD_fields *F ,
-	 const size_t t ,
+term_C8( struct halfspinor *H ,
+	 const struct halfspinor *X ,
+	 const struct NRQCD_derivs *D ,
+	 const double complex *Fmunu ,
+	 const size_t i ,
 	 const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C8 ) < NRQCD_TOL ) return ;
   
   const double fac = -3.0 * NRQCD.C8 / ( 4. * pow( 2*NRQCD.M_0 , 4 ) ) ;
 
-  size_t i ;
   // does \grad^2 \sigma.\grad.E.G
-#pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {  
-    sigma_gradxE( &F -> S1[i] , F -> Fmunu , F -> S , NRQCD.U0 , i , t ) ;
-  }
-#pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
-    struct halfspinor res ;
-    gradsq_imp( &res , F -> S1 , F -> Fmunu , i , t ) ;
-    #ifdef LEGACY_NRQCD_COMPARE
-    // (in)correction factor for our derivative
-    halfspinor_Saxpy( &res , F -> S1[i] , ( 1. - 1/(NRQCD.U0*NRQCD.U0) )/2. ) ;
-    #endif
-    halfspinor_Saxpy( &F -> H[i] , res , fac ) ;
-  }
+  struct halfspinor res ;
+  gradsq_imp( &res , X , Fmunu , i ) ;
+  #ifdef LEGACY_NRQCD_COMPARE
+  // (in)correction factor for our derivative
+  halfspinor_Saxpy( &res , X[i] , ( 1. - 1/(NRQCD.U0*NRQCD.U0) )/2. ) ;
+  #endif
+  halfspinor_Saxpy( H , res , fac ) ;
+
   // does \sigma.\grad.E \grad^2 G
-#pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
-    gradsq_imp( &F -> S1[i] , F -> S , F -> Fmunu , i ,  t ) ;
-    #ifdef LEGACY_NRQCD_COMPARE
-    // (in)correction factor for our derivative
-    halfspinor_Saxpy( &F -> S1[i] , F -> S[i] ,
-		      ( 1. - 1/(NRQCD.U0*NRQCD.U0) )/2. ) ;
-    #endif
-  }
-#pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
-    struct halfspinor res ;
-    sigma_gradxE( &res , F -> Fmunu , F -> S1 , NRQCD.U0 , i , t ) ;
-    halfspinor_Saxpy( &F -> H[i] , res , fac ) ; 
-  }
+  sigma_gradxE( &res , Fmunu , D -> lapl_imp , NULL , NRQCD.U0 , i ) ;
+  #ifdef LEGACY_NRQCD_COMPARE
+  // (in)correction factor for our derivative, sigma_gradxE is linear
+  halfspinor_Saxpy( &res , X[i] , ( 1. - 1/(NRQCD.U0*NRQCD.U0) )/2. ) ;
+  #endif
+  halfspinor_Saxpy( H , res , fac ) ; 
 
   return ;
 }
@@ -217,9 +212,8 @@ term_C8( struct NRQCD_fields *F ,
 void
 term_C9EB( struct halfspinor *H ,
 	   const struct halfspinor *S ,
-	   const struct field *Fmunu ,
+	   const double complex *Fmunu ,
 	   const size_t i ,
-	   const size_t t ,
 	   const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C9EB ) < NRQCD_TOL ) return ;
@@ -234,30 +228,30 @@ term_C9EB( struct halfspinor *H ,
   size_t j ;
   // x direction is F_13 F_23 - F_23 F_13
   zero_halfspinor( &t1 ) ;
-  multab( (void*)A , (void*)Fmunu[i].O[4] , (void*)Fmunu[i].O[5] ) ;
-  multab( (void*)B , (void*)Fmunu[i].O[5] , (void*)Fmunu[i].O[4] ) ;
-  multab( (void*)C , (void*)Fmunu[i].O[1] , (void*)Fmunu[i].O[2] ) ;
-  multab( (void*)D , (void*)Fmunu[i].O[2] , (void*)Fmunu[i].O[1] ) ;
+  multab( (void*)A , (void*)FMUNU( Fmunu , i , 4 ) , (void*)FMUNU( Fmunu , i , 5 ) ) ;
+  multab( (void*)B , (void*)FMUNU( Fmunu , i , 5 ) , (void*)FMUNU( Fmunu , i , 4 ) ) ;
+  multab( (void*)C , (void*)FMUNU( Fmunu , i , 1 ) , (void*)FMUNU( Fmunu , i , 2 ) ) ;
+  multab( (void*)D , (void*)FMUNU( Fmunu , i , 2 ) , (void*)FMUNU( Fmunu , i , 1 ) ) ;
   for( j = 0 ; j < NCNC ; j++ ) {
     t1.D[1][j] += ( ( A[j] + C[j] ) - ( B[j] + D[j] ) ) ;
     t1.D[2][j] += ( ( A[j] + C[j] ) - ( B[j] + D[j] ) ) ;
   }
 
   // y direction is F_23 F_03 - F_03 F_23
-  multab( (void*)A , (void*)Fmunu[i].O[5] , (void*)Fmunu[i].O[3] ) ;
-  multab( (void*)B , (void*)Fmunu[i].O[3] , (void*)Fmunu[i].O[5] ) ;
-  multab( (void*)C , (void*)Fmunu[i].O[2] , (void*)Fmunu[i].O[0] ) ;
-  multab( (void*)D , (void*)Fmunu[i].O[0] , (void*)Fmunu[i].O[2] ) ;
+  multab( (void*)A , (void*)FMUNU( Fmunu , i , 5 ) , (void*)FMUNU( Fmunu , i , 3 ) ) ;
+  multab( (void*)B , (void*)FMUNU( Fmunu , i , 3 ) , (void*)FMUNU( Fmunu , i , 5 ) ) ;
+  multab( (void*)C , (void*)FMUNU( Fmunu , i , 2 ) , (void*)FMUNU( Fmunu , i , 0 ) ) ;
+  multab( (void*)D , (void*)FMUNU( Fmunu , i , 0 ) , (void*)FMUNU( Fmunu , i , 2 ) ) ;
   for( j = 0 ; j < NCNC ; j++ ) {
     t1.D[1][j] += -I * ( ( A[j] + C[j] ) - ( B[j] + D[j] ) ) ;
     t1.D[2][j] += +I * ( ( A[j] + C[j] ) - ( B[j] + D[j] ) ) ;
   }
     
   // z direction is F_03 F_13 - F_13 F_03
-  multab( (void*)A , (void*)Fmunu[i].O[3] , (void*)Fmunu[i].O[4] ) ;
-  multab( (void*)B , (void*)Fmunu[i].O[4] , (void*)Fmunu[i].O[3] ) ;
-  multab( (void*)C , (void*)Fmunu[i].O[0] , (void*)Fmunu[i].O[1] ) ;
-  multab( (void*)D , (void*)Fmunu[i].O[1] , (void*)Fmunu[i].O[0] ) ;
+  multab( (void*)A , (void*)FMUNU( Fmunu , i , 3 ) , (void*)FMUNU( Fmunu , i , 4 ) ) ;
+  multab( (void*)B , (void*)FMUNU( Fmunu , i , 4 ) , (void*)FMUNU( Fmunu , i , 3 ) ) ;
+  multab( (void*)C , (void*)FMUNU( Fmunu , i , 0 ) , (void*)FMUNU( Fmunu , i , 1 ) ) ;
+  multab( (void*)D , (void*)FMUNU( Fmunu , i , 1 ) , (void*)FMUNU( Fmunu , i , 0 ) ) ;
   for( j = 0 ; j < NCNC ; j++ ) {
     t1.D[0][j] +=  ( ( A[j] + C[j] ) - ( B[j] + D[j] ) ) ;
     t1.D[3][j] += -( ( A[j] + C[j] ) - ( B[j] + D[j] ) ) ;
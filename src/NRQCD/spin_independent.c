@@ -15,8 +15,8 @@
 void
 term_C0( struct halfspinor *H ,
 	 const struct halfspinor *S ,
+	 const double complex *Fmunu ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C0 ) < NRQCD_TOL ) return ;
@@ -24,7 +24,7 @@ term_C0( struct halfspinor *H ,
   const double fac = -NRQCD.C0 / ( 2. * NRQCD.M_0 ) ;
 
   struct halfspinor res ;
-  gradsq( &res , S , i , t ) ;
+  gradsq( &res , S , Fmunu , i ) ;
   halfspinor_Saxpy( H , res , fac ) ;
   
   return ;
@@ -34,9 +34,8 @@ term_C0( struct halfspinor *H ,
 void
 term_C1_C6( struct halfspinor *H ,
 	    const struct halfspinor *S ,
-	    const struct field *Fmunu ,
+	    const struct NRQCD_derivs *D ,
 	    const size_t i ,
-	    const size_t t ,
 	    const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C1 ) < NRQCD_TOL &&
@@ -46,8 +45,10 @@ term_C1_C6( struct halfspinor *H ,
   const double fac = -NRQCD.C1 / pow( 2*NRQCD.M_0 , 3 ) 
     -NRQCD.C6 / ( 4. * NRQCD.N * pow( 2*NRQCD.M_0 , 2 ) ) ;
 
-  struct halfspinor res ;
-  grad_sqsq( &res , S , Fmunu , i , t ) ;
+  // grad^2 ( grad^2 S ) has been computed beforehand, its paths that
+  // go out and back pick up a 1/U0^2 that grad_sqsq() takes to be 1
+  struct halfspinor res = D -> lapl2[i] ;
+  halfspinor_Saxpy( &res , S[i] , -2*(ND-1)*( 1./( NRQCD.U0*NRQCD.U0 ) - 1. ) ) ;
   halfspinor_Saxpy( H , res , fac ) ;
   
   return ;
@@ -57,9 +58,9 @@ term_C1_C6( struct halfspinor *H ,
 void
 term_C2( struct halfspinor *H ,
 	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const struct NRQCD_derivs *D ,
+	 const double complex *Fmunu ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C2 ) < NRQCD_TOL ) return ;
@@ -72,10 +73,11 @@ term_C2( struct halfspinor *H ,
   size_t mu ;
   for( mu = 0 ; mu < ND-1 ; mu++ ) {
     // does i \grad FMUNU G
-    grad_imp_FMUNU( &res , S , Fmunu , NRQCD.U0 , i , t , mu , ND-1+mu ) ;
+    grad_imp_FMUNU( &res , S , Fmunu , NRQCD.U0 , i , mu , ND-1+mu ) ;
     halfspinor_iSaxpy( H , res , +fac ) ;
     // does -i FMUNU \grad G
-    FMUNU_grad_imp( &res , S , Fmunu , NRQCD.U0 , i , t , mu , ND-1+mu ) ;
+    colormatrix_halfspinor( (void*)res.D , (const void*)FMUNU( Fmunu , i , ND-1+mu ) ,
+			    (const void*)D -> grad[mu][i].D ) ;
     halfspinor_iSaxpy( H , res , -fac ) ; 
   }
 
@@ -85,9 +87,8 @@ term_C2( struct halfspinor *H ,
 void
 term_C5( struct halfspinor *H ,
 	 const struct halfspinor *S ,
-	 const struct field *Fmunu ,
+	 const double complex *Fmunu ,
 	 const size_t i ,
-	 const size_t t ,
 	 const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C5 ) < NRQCD_TOL ) return ;
@@ -99,7 +100,7 @@ term_C5( struct halfspinor *H ,
   size_t mu ;
   for( mu = 0 ; mu < ND-1 ; mu++ ) {
 
-    grad4( &res , S , Fmunu , i , t , mu ) ;
+    grad4( &res , S , Fmunu , i , mu ) ;
 
     halfspinor_Saxpy( H , res , fac ) ;
   }
@@ -111,9 +112,8 @@ term_C5( struct halfspinor *H ,
 void
 term_C10EB( struct halfspinor *H ,
 	    const struct halfspinor *S ,
-	    const struct field *Fmunu ,
+	    const double complex *Fmunu ,
 	    const size_t i ,
-	    const size_t t ,
 	    const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C10EB ) < NRQCD_TOL ) return ;
@@ -123,9 +123,9 @@ term_C10EB( struct halfspinor *H ,
   double complex A[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
   double complex B[ NCNC ] __attribute__((aligned(ALIGNMENT))) ;
   size_t d ;
-  multab( (void*)A , (void*)Fmunu[i].O[0] , (void*)Fmunu[i].O[0] ) ;
+  multab( (void*)A , (void*)FMUNU( Fmunu , i , 0 ) , (void*)FMUNU( Fmunu , i , 0 ) ) ;
   for( d = 1 ; d < (ND-1)*(ND-2) ; d++ ) {
-    multab( (void*)B , (void*)Fmunu[i].O[d] , (void*)Fmunu[i].O[d] ) ;
+    multab( (void*)B , (void*)FMUNU( Fmunu , i , d ) , (void*)FMUNU( Fmunu , i , d ) ) ;
     add_mat( (void*)A , (void*)B ) ;
   }
   struct halfspinor res ;
@@ -136,24 +136,22 @@ term_C10EB( struct halfspinor *H ,
   return ;
 }
 
+// this is grad^2 of the cached grad^2( grad^2 S ), which reaches
+// further than the other terms so it needs its own sweep
 void
-term_C11( struct NRQCD_fields *F ,
-	  const size_t t ,
+term_C11( struct halfspinor *H ,
+	  const struct NRQCD_derivs *D ,
+	  const double complex *Fmunu ,
+	  const size_t i ,
 	  const struct NRQCD_params NRQCD )
 {
   if( fabs( NRQCD.C11 ) < NRQCD_TOL ) return ;
   
   const double fac = -NRQCD.C11 / ( 24. * pow( NRQCD.N , 2 ) * pow( 2*NRQCD.M_0 , 3 ) ) ;
 
-  grad_sq_LCU( F -> S1 , F -> S , t ) ;
-  grad_sq_LCU( F -> S2 , F -> S1 , t ) ;
-  grad_sq_LCU( F -> S1 , F -> S2 , t ) ;
-
-  size_t i ;
-#pragma omp for private(i)
-  for( i = 0 ; i < LCU ; i++ ) {
-    halfspinor_Saxpy( &F -> H[i] , F -> S1[i] , fac ) ;
-  }
+  struct halfspinor res ;
+  gradsq( &res , D -> lapl2 , Fmunu , i ) ;
+  halfspinor_Saxpy( H , res , fac ) ;
   
   return ;
 }
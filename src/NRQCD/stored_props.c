@@ -0,0 +1,334 @@
+/**
+   @file stored_props.c
+   @brief writes evolved NRQCD props to disk and reads them back
+
+   Props with NRQCD_STORE set are written as Nrel_fwd and Nrel_bwd files
+   called nrqcd_<hash>.fwd and nrqcd_<hash>.bwd in the working directory.
+   The hash is the DML checksum pair of the gauge field and of everything
+   that goes into the evolution, so a later run finding the file can read
+   it instead of evolving again
+ */
+#include "common.h"
+
+#include "crc32.h"            // DML_checksum_accum()
+#include "GLU_bswap.h"        // bswap_32()
+#include "read_propheader.h"  // read_propheader()
+
+// the hash is printed as two 32 bit hex numbers
+#define HASH_LENGTH (17)
+
+// gauge field part of the hash, the same for every prop
+static void
+gauge_hash( uint32_t hash[ 2 ] )
+{
+  hash[0] = hash[1] = 0 ;
+  size_t i ;
+  for( i = 0 ; i < LVOLUME ; i++ ) {
+    DML_checksum_accum( &hash[0] , &hash[1] , (uint32_t)i ,
+			(char*)lat[i].O , ND*NCNC*sizeof( double complex ) ) ;
+  }
+  return ;
+}
+
+// add everything the evolution of prop p depends on to the gauge hash
+static void
+prop_hash( char str[ HASH_LENGTH ] ,
+	   const uint32_t gauge[ 2 ] ,
+	   const struct propagator p )
+{
+  const struct NRQCD_params P = p.NRQCD ;
+  double dpar[ 15 + 2*ND ] = {
+    P.U0 , P.C0 , P.C1 , P.C2 , P.C3 , P.C4 , P.C5 , P.C6 , P.C7 ,
+    P.C8 , P.C9EB , P.C10EB , P.C11 , P.M_0 , p.Source.smalpha } ;
+  size_t ipar[ 12 + 3*ND ] = {
+    P.N , P.PRECISION , P.ACCUM , p.bound[ND-1] , p.Source.type ,
+    p.Source.boxsize , p.Source.Nsmear , p.Source.smear ,
+    p.Source.Z2_spacing , (size_t)T_NRQCD ,
+#ifdef NRQCD_NONSYM
+    1 ,
+#else
+    0 ,
+#endif
+#ifdef LEGACY_NRQCD_COMPARE
+    1 ,
+#else
+    0 ,
+#endif
+  } ;
+  // everything that goes into the header has to be in the hash too
+  size_t mu ;
+  for( mu = 0 ; mu < ND ; mu++ ) {
+    dpar[ 15 + mu ] = p.twist[ mu ] ;
+    dpar[ 15 + ND + mu ] = p.mom_source[ mu ] ;
+    ipar[ 12 + mu ] = p.origin[ mu ] ;
+    ipar[ 12 + ND + mu ] = Latt.dims[ mu ] ;
+    ipar[ 12 + 2*ND + mu ] = p.bound[ mu ] ;
+  }
+  uint32_t hash[ 2 ] = { gauge[0] , gauge[1] } ;
+  DML_checksum_accum( &hash[0] , &hash[1] , (uint32_t)LVOLUME ,
+		      (char*)dpar , sizeof( dpar ) ) ;
+  DML_checksum_accum( &hash[0] , &hash[1] , (uint32_t)LVOLUME+1 ,
+		      (char*)ipar , sizeof( ipar ) ) ;
+  sprintf( str , "%08x%08x" , hash[0] , hash[1] ) ;
+  return ;
+}
+
+// noise sources are different every time so there is nothing to reuse
+static GLU_bool
+is_storable( const struct propagator p )
+{
+  if( p.basis != NREL_CORR || p.NRQCD.STORE == GLU_FALSE ) {
+    return GLU_FALSE ;
+  }
+  switch( p.Source.type ) {
+  case POINT :
+  case WALL :
+    return GLU_TRUE ;
+  case Z2_WALL :
+  case Z3_WALL :
+  case U1_WALL :
+    break ;
+  }
+  return GLU_FALSE ;
+}
+
+static const char *
+bound_str( const boundaries bound )
+{
+  switch( bound ) {
+  case PERIODIC : return "Periodic" ;
+  case ANTIPERIODIC : return "Anti-periodic" ;
+  case PPLUSA : return "PplusA" ;
+  case PMINUSA : return "PminusA" ;
+  case PMULA : return "PmulA" ;
+  }
+  return "Periodic" ;
+}
+
+static const char *
+smear_str( const smearing smear )
+{
+  switch( smear ) {
+  case GAUGE : return "Gauge" ;
+  case QUARK : return "Quark" ;
+  case NOSMEAR : break ;
+  }
+  return "None" ;
+}
+
+// header in the format read_propheader() understands
+static void
+write_header( FILE *file ,
+	      const struct propagator p ,
+	      const GLU_bool backward ,
+	      const char *hash )
+{
+  const struct NRQCD_params P = p.NRQCD ;
+  size_t mu ;
+  fprintf( file , "Lattice:" ) ;
+  for( mu = 0 ; mu < ND ; mu++ ) fprintf( file , " %zu" , Latt.dims[mu] ) ;
+  fprintf( file , "\nPlaq: %1.15f\n" , p.plaq ) ;
+  // Nrel files count the origin from 1
+  fprintf( file , "SrcPos:" ) ;
+  for( mu = 0 ; mu < ND ; mu++ ) fprintf( file , " %zu" , p.origin[mu]+1 ) ;
+  fprintf( file , "\nTwists:" ) ;
+  for( mu = 0 ; mu < ND ; mu++ ) fprintf( file , " %g" , p.twist[mu] ) ;
+  fprintf( file , "\nMom_Source:" ) ;
+  for( mu = 0 ; mu < ND ; mu++ ) fprintf( file , " %g" , p.mom_source[mu] ) ;
+  fprintf( file , "\nBoundaries:" ) ;
+  for( mu = 0 ; mu < ND ; mu++ ) fprintf( file , " %s" , bound_str( p.bound[mu] ) ) ;
+  fprintf( file , "\nEndian: %s\n" , WORDS_BIGENDIAN ? "Big" : "Little" ) ;
+  fprintf( file , "Precision: Single\n" ) ;
+  fprintf( file , "Source: %s\n" , p.Source.type == POINT ? "Point" : "Wall" ) ;
+  fprintf( file , "Smearing: %s\n" , smear_str( p.Source.smear ) ) ;
+  fprintf( file , "Boxsize: %zu\n" , p.Source.boxsize ) ;
+  fprintf( file , "Nsmear: %zu\n" , p.Source.Nsmear ) ;
+  fprintf( file , "Smalpha: %1.15e\n" , p.Source.smalpha ) ;
+  fprintf( file , "Basis: %s\n" , backward == GLU_TRUE ? "Nrel_bwd" : "Nrel_fwd" ) ;
+  fprintf( file , "NRQCD_C0 %1.15e\nNRQCD_C1 %1.15e\nNRQCD_C2 %1.15e\n" ,
+	   P.C0 , P.C1 , P.C2 ) ;
+  fprintf( file , "NRQCD_C3 %1.15e\nNRQCD_C4 %1.15e\nNRQCD_C5 %1.15e\n" ,
+	   P.C3 , P.C4 , P.C5 ) ;
+  fprintf( file , "NRQCD_C6 %1.15e\nNRQCD_C7 %1.15e\nNRQCD_C8 %1.15e\n" ,
+	   P.C6 , P.C7 , P.C8 ) ;
+  fprintf( file , "NRQCD_C9EB %1.15e\nNRQCD_C10EB %1.15e\nNRQCD_C11 %1.15e\n" ,
+	   P.C9EB , P.C10EB , P.C11 ) ;
+  fprintf( file , "NRQCD_U0 %1.15e\nNRQCD_M_0 %1.15e\nNRQCD_N %zu\n" ,
+	   P.U0 , P.M_0 , P.N ) ;
+  fprintf( file , "NRQCD_PRECISION %s\nNRQCD_ACCUM %s\n" ,
+	   P.PRECISION == SINGLE ? "Single" : "Double" ,
+	   P.ACCUM == SINGLE ? "Single" : "Double" ) ;
+  fprintf( file , "NRQCD_HASH %s\n" , hash ) ;
+  fprintf( file , "<end_header>\n" ) ;
+  return ;
+}
+
+// write T_NRQCD timeslices of H to the file called name
+static int
+write_H( const char *name ,
+	 const struct halfspinor_f *H ,
+	 const struct propagator p ,
+	 const GLU_bool backward ,
+	 const char *hash )
+{
+  FILE *file = fopen( name , "wb" ) ;
+  if( file == NULL ) {
+    fprintf( stderr , "[NRQCD] cannot open %s for writing\n" , name ) ;
+    return FAILURE ;
+  }
+  write_header( file , p , backward , hash ) ;
+  size_t i ;
+  for( i = 0 ; i < T_NRQCD*LCU ; i++ ) {
+    if( fwrite( H[i].D , sizeof( float complex ) , NS*NCNC , file ) !=
+	NS*NCNC ) {
+      fprintf( stderr , "[NRQCD] write failure for %s\n" , name ) ;
+      fclose( file ) ;
+      remove( name ) ;
+      return FAILURE ;
+    }
+  }
+  fclose( file ) ;
+  fprintf( stdout , "[NRQCD] written %s\n" , name ) ;
+  return SUCCESS ;
+}
+
+// read_propheader() skips the NRQCD_HASH tag so look for it here,
+// the file is left at its start
+static int
+get_header_hash( char hash[ HASH_LENGTH ] ,
+		 FILE *file )
+{
+  char line[ MAX_LINE_LENGTH ] ;
+  int flag = FAILURE ;
+  while( fgets( line , MAX_LINE_LENGTH , file ) != NULL ) {
+    if( sscanf( line , "NRQCD_HASH %16s" , hash ) == 1 ) {
+      flag = SUCCESS ;
+      break ;
+    }
+    if( strcmp( line , "<end_header>\n" ) == 0 ) break ;
+  }
+  rewind( file ) ;
+  return flag ;
+}
+
+// read T_NRQCD timeslices of H from the file called name if it exists
+// and was written for the same hash
+static int
+read_H( struct halfspinor_f *H ,
+	const char *name ,
+	const char *hash ,
+	const GLU_bool backward )
+{
+  struct propagator tmp ;
+  tmp.file = fopen( name , "rb" ) ;
+  if( tmp.file == NULL ) {
+    return FAILURE ;
+  }
+  int flag = FAILURE ;
+  char file_hash[ HASH_LENGTH ] ;
+  if( get_header_hash( file_hash , tmp.file ) == FAILURE ||
+      strcmp( file_hash , hash ) != 0 ) {
+    fprintf( stderr , "[NRQCD] stored prop %s does not match its hash\n" ,
+	     name ) ;
+    goto end ;
+  }
+  if( read_propheader( &tmp , GLU_TRUE ) == FAILURE ||
+      tmp.precision != SINGLE ||
+      tmp.basis != ( backward == GLU_TRUE ? NREL_BWD : NREL_FWD ) ) {
+    fprintf( stderr , "[NRQCD] stored prop %s has a bad header\n" , name ) ;
+    goto end ;
+  }
+  const GLU_bool must_swap = tmp.endian != WORDS_BIGENDIAN ? \
+    GLU_TRUE : GLU_FALSE ;
+  size_t i ;
+  for( i = 0 ; i < T_NRQCD*LCU ; i++ ) {
+    if( fread( H[i].D , sizeof( float complex ) , NS*NCNC , tmp.file ) !=
+	NS*NCNC ) {
+      fprintf( stderr , "[NRQCD] stored prop %s is truncated\n" , name ) ;
+      goto end ;
+    }
+    if( must_swap ) bswap_32( 2*NS*NCNC , H[i].D ) ;
+  }
+  flag = SUCCESS ;
+ end :
+  fclose( tmp.file ) ;
+  return flag ;
+}
+
+// read back the props that have been stored by an earlier run
+int
+load_NRQCD_props( struct propagator *prop ,
+		  const size_t nprops )
+{
+  uint32_t gauge[ 2 ] ;
+  GLU_bool have_gauge = GLU_FALSE ;
+  size_t n ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( is_storable( prop[n] ) == GLU_FALSE ) continue ;
+    if( have_gauge == GLU_FALSE ) {
+      gauge_hash( gauge ) ;
+      have_gauge = GLU_TRUE ;
+    }
+    char hash[ HASH_LENGTH ] , name[ HASH_LENGTH + 16 ] ;
+    prop_hash( hash , gauge , prop[n] ) ;
+
+    // we need every direction that would be evolved up front, a
+    // pipelined forward-only prop has none so it is never loaded
+    GLU_bool found = GLU_TRUE ;
+    size_t nread = 0 ;
+    if( prop[n].Hfwd != NULL ) {
+      sprintf( name , "nrqcd_%s.fwd" , hash ) ;
+      found = read_H( prop[n].Hfwd , name , hash , GLU_FALSE ) == SUCCESS ?	\
+	found : GLU_FALSE ;
+      nread++ ;
+    }
+    if( prop[n].Hbwd != NULL ) {
+      sprintf( name , "nrqcd_%s.bwd" , hash ) ;
+      found = read_H( prop[n].Hbwd , name , hash , GLU_TRUE ) == SUCCESS ?	\
+	found : GLU_FALSE ;
+      nread++ ;
+    }
+    if( found == GLU_TRUE && nread > 0 ) {
+      fprintf( stdout , "[NRQCD] prop %zu read from stored nrqcd_%s\n" ,
+	       n , hash ) ;
+      prop[n].NRQCD.LOADED = GLU_TRUE ;
+    }
+  }
+  return SUCCESS ;
+}
+
+// write the evolved props we have been asked to keep
+int
+store_NRQCD_props( const struct propagator *prop ,
+		   const size_t nprops )
+{
+  uint32_t gauge[ 2 ] ;
+  GLU_bool have_gauge = GLU_FALSE ;
+  size_t n ;
+  for( n = 0 ; n < nprops ; n++ ) {
+    if( prop[n].NRQCD.STORE == GLU_TRUE &&
+	is_storable( prop[n] ) == GLU_FALSE ) {
+      fprintf( stdout , "[NRQCD] not storing prop %zu with a noise source\n" ,
+	       n ) ;
+    }
+    if( is_storable( prop[n] ) == GLU_FALSE ||
+	prop[n].NRQCD.LOADED == GLU_TRUE ) continue ;
+    if( have_gauge == GLU_FALSE ) {
+      gauge_hash( gauge ) ;
+      have_gauge = GLU_TRUE ;
+    }
+    char hash[ HASH_LENGTH ] , name[ HASH_LENGTH + 16 ] ;
+    prop_hash( hash , gauge , prop[n] ) ;
+
+    // failing to store is not fatal, we just evolve again next time
+    if( prop[n].Hfwd != NULL ) {
+      sprintf( name , "nrqcd_%s.fwd" , hash ) ;
+      write_H( name , prop[n].Hfwd , prop[n] , GLU_FALSE , hash ) ;
+    }
+    if( prop[n].Hbwd != NULL ) {
+      sprintf( name , "nrqcd_%s.bwd" , hash ) ;
+      write_H( name , prop[n].Hbwd , prop[n] , GLU_TRUE , hash ) ;
+    }
+  }
+  return SUCCESS ;
+}
@@ -5,34 +5,20 @@
 #include "common.h"
 
 #include "bar_contractions.h" // bar_contract_site()
-#include "contractions.h"     // gamma_mul_r()
-#include "gammas.h"           // CGmu()
+#include "contractions.h"     // simple_meson_contract()
 
 // baryon-meson contraction
 void
 contract_O2O2( struct spinmatrix *P ,
-	       double complex **F ,
-	       const struct spinor U ,
+	       const struct penta_site *PS ,
 	       const struct spinor D ,
 	       const struct spinor S ,
-	       const struct spinor B ,
-	       const struct gamma OP1 ,
-	       const struct gamma OP2 ,
-	       const struct gamma *GAMMAS ,
-	       const uint8_t **loc )
+	       const size_t b1 ,
+	       const size_t b2 )
 {
-  // usual gamma stuff
-  const struct gamma G5    = OP1 ;
-  const struct gamma C1    = CGmu( OP1 , GAMMAS ) ;
-  
-  const struct gamma t2t   = gt_Gdag_gt( OP2 , GAMMAS[ GAMMA_T ] ) ;
-  const struct gamma tC2t  = gt_Gdag_gt( CGmu( OP2 , GAMMAS ) ,
-					 GAMMAS[ GAMMA_T ] ) ;
-
-  // allocate the term matrix
-  double complex **term = malloc( 2 * sizeof( double complex* ) ) ;
-  term[0] = malloc( NSNS * sizeof( double complex ) ) ;
-  term[1] = malloc( NSNS * sizeof( double complex ) ) ;
+  // the term matrix is small enough for the stack
+  double complex term0[ NSNS ] , term1[ NSNS ] ;
+  double complex *term[ 2 ] = { term0 , term1 } ;
 
   // zero the term
   size_t d1 , d2 ;
@@ -40,10 +26,11 @@ contract_O2O2( struct spinmatrix *P ,
     term[0][d1] = term[1][d1] = 0.0 ;
   }
 
-  baryon_contract_site( term , U , U , D , C1 , tC2t ) ;
+  baryon_contract_site( term , PS -> U , PS -> U , D ,
+			PS -> CG[ b1 ] , PS -> tCGt[ b2 ] ) ;
   
   const double complex T =
-    -simple_meson_contract( t2t , B , G5 , S ) ;
+    -simple_meson_contract( PS -> tGt[ b2 ] , PS -> B , PS -> G[ b1 ] , S ) ;
 
   // this explicitly does the uud contraction
   for( d1 = 0 ; d1 < NS ; d1++ ) {
@@ -52,11 +39,6 @@ contract_O2O2( struct spinmatrix *P ,
 	( term[0][ d2 + NS * d1 ] + term[1][ d2 + NS * d1 ] ) * T ;
     }
   }
-  
-  // free the term temporary
-  free( term[0] ) ;
-  free( term[1] ) ;
-  free( term ) ;
 
   return ;
 }
@@ -8,16 +8,12 @@
 
 void
 contract_O3O1( struct spinmatrix *P ,
-	       double complex **F ,
-	       const struct spinor U ,
+	       const struct penta_site *PS ,
 	       const struct spinor D ,
 	       const struct spinor S ,
-	       const struct spinor B ,
-	       const struct gamma OP1 ,
-	       const struct gamma OP2 ,
-	       const struct gamma *GAMMAS ,
-	       const uint8_t **loc )
+	       const size_t b1 ,
+	       const size_t b2 )
 {
-  contract_O2O1( P , F , U , S , D , B , OP1 , OP2 , GAMMAS , loc ) ;
+  contract_O2O1( P , PS , S , D , b1 , b2 ) ;
   return ;
 }
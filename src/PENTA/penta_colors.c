@@ -0,0 +1,340 @@
+/**
+   @file penta_colors.c
+   @brief colour structure of the pentaquark contractions
+
+   The epsilon identities only touch a few hundred of the NC^8 colour
+   combinations of the F-tensor and each of those is a product of a
+   left and a right block of spinmatrices. So once a run we collapse
+   the colour sums into weighted ( left , right ) lists sorted by the
+   left block, the contractions then sum the right blocks of a run of
+   terms and do a single multiply per left block.
+ */
+#include "common.h"
+
+#include "penta_colors.h"       // alphabetising
+#include "penta_contractions.h" // idx() and idx2()
+
+// number of flattened ( c1 , c2 , c3 , c4 ) blocks
+#define NBLK (NCNC*NCNC)
+
+// flattened index of the block O1.C[ a ][ b ] * O2.C[ c ][ d ]
+static inline size_t
+blk( const size_t a , const size_t b ,
+     const size_t c , const size_t d )
+{
+  return ( b + NC*a )*NCNC + ( d + NC*c ) ;
+}
+
+// colour digits of a flattened index, least significant first
+static void
+colour_digits( size_t l[ 8 ] ,
+	       size_t i )
+{
+  size_t k ;
+  for( k = 0 ; k < 8 ; k++ ) {
+    l[ k ] = i%NC ; i /= NC ;
+  }
+  return ;
+}
+
+// add a weight to the ( K , A , B ) term of a dense table
+static inline void
+add_term( int *W ,
+	  const size_t K ,
+	  const size_t A ,
+	  const size_t B ,
+	  const int w )
+{
+  W[ B + NBLK*( A + NBLK*K ) ] += w ;
+  return ;
+}
+
+// F = tr( L ) tr( R ) - tr( L' R' ) of the diquark-diquark
+static void
+O1O1_add( int **W ,
+	  const size_t i ,
+	  const size_t K ,
+	  const int w )
+{
+  size_t l[ 8 ] ;
+  colour_digits( l , i ) ;
+  add_term( W[0] , K , blk( l[0] , l[1] , l[2] , l[3] ) ,
+	    blk( l[4] , l[5] , l[6] , l[7] ) , w ) ;
+  add_term( W[1] , K , blk( l[0] , l[5] , l[2] , l[3] ) ,
+	    blk( l[4] , l[1] , l[6] , l[7] ) , w ) ;
+  return ;
+}
+
+// F = L R - L' R' of the diquark - baryon-meson
+static void
+O1O2_add( int **W ,
+	  const size_t i ,
+	  const int w )
+{
+  size_t l[ 8 ] ;
+  colour_digits( l , i ) ;
+  add_term( W[0] , 0 , blk( l[0] , l[1] , l[2] , l[3] ) ,
+	    blk( l[4] , l[5] , l[6] , l[7] ) , w ) ;
+  add_term( W[0] , 0 , blk( l[0] , l[5] , l[2] , l[3] ) ,
+	    blk( l[4] , l[1] , l[6] , l[7] ) , -w ) ;
+  return ;
+}
+
+// F = L R - L' R' of the baryon-meson - diquark
+static void
+O2O1_add( int **W ,
+	  const size_t i ,
+	  const int w )
+{
+  size_t l[ 8 ] ;
+  colour_digits( l , i ) ;
+  add_term( W[0] , 0 , blk( l[0] , l[1] , l[2] , l[3] ) ,
+	    blk( l[4] , l[5] , l[6] , l[7] ) , w ) ;
+  add_term( W[0] , 0 , blk( l[0] , l[1] , l[2] , l[7] ) ,
+	    blk( l[4] , l[5] , l[6] , l[3] ) , -w ) ;
+  return ;
+}
+
+// F = tr( T ) U - ( T' U^T )^T of the two baryon-mesons, only the left
+// block is a product and the key is the colour of the U block
+static void
+O2O3_add( int **W ,
+	  const size_t i ,
+	  const int w )
+{
+  size_t l[ 8 ] ;
+  colour_digits( l , i ) ;
+  add_term( W[0] , l[5] + NC*l[4] , blk( l[1] , l[0] , l[3] , l[2] ) , 0 , w ) ;
+  add_term( W[1] , l[4] + NC*l[0] , blk( l[1] , l[5] , l[3] , l[2] ) , 0 , w ) ;
+  return ;
+}
+
+// diquark - diquark
+static void
+O1O1_terms( int **W )
+{
+  // there is always a primed index hitting the b and the key says
+  // which element of b that is
+  size_t b , c , g , h , prime ;
+  for( h = 0 ; h < NC ; h++ ) {
+    for( g = 0 ; g < NC ; g++ ) {
+      for( c = 0 ; c < NC ; c++ ) {
+	for( prime = 0 ; prime < NC ; prime++ ) {
+	  for( b = 0 ; b < NC ; b++ ) {
+	    // op1
+	    O1O1_add( W , idx( b , prime , c , c , g , g , h , h ) , prime*NC + b , +1 ) ;
+	    O1O1_add( W , idx( b , prime , c , c , g , h , h , g ) , prime*NC + b , -1 ) ;
+	    O1O1_add( W , idx( b , prime , c , g , g , c , h , h ) , prime*NC + b , -1 ) ;
+	    O1O1_add( W , idx( b , prime , c , h , g , c , h , g ) , prime*NC + b , +1 ) ;
+	    O1O1_add( W , idx( b , prime , c , g , g , h , h , c ) , prime*NC + b , +1 ) ;
+	    O1O1_add( W , idx( b , prime , c , h , g , g , h , c ) , prime*NC + b , -1 ) ;
+	    // op2
+	    O1O1_add( W , idx( b , c , c , prime , g , g , h , h ) , prime*NC + b , -1 ) ;
+	    O1O1_add( W , idx( b , c , c , prime , g , h , h , g ) , prime*NC + b , +1 ) ;
+	    O1O1_add( W , idx( b , g , c , prime , g , c , h , h ) , prime*NC + b , +1 ) ;
+	    O1O1_add( W , idx( b , h , c , prime , g , c , h , g ) , prime*NC + b , -1 ) ;
+	    O1O1_add( W , idx( b , g , c , prime , g , h , h , c ) , prime*NC + b , -1 ) ;
+	    O1O1_add( W , idx( b , h , c , prime , g , g , h , c ) , prime*NC + b , +1 ) ;
+	    // op3
+	    O1O1_add( W , idx( b , prime , c , b , g , g , h , h ) , prime*NC + c , -1 ) ;
+	    O1O1_add( W , idx( b , prime , c , b , g , h , h , g ) , prime*NC + c , +1 ) ;
+	    O1O1_add( W , idx( b , prime , c , g , g , b , h , h ) , prime*NC + c , +1 ) ;
+	    O1O1_add( W , idx( b , prime , c , h , g , b , h , g ) , prime*NC + c , -1 ) ;
+	    O1O1_add( W , idx( b , prime , c , g , g , h , h , b ) , prime*NC + c , -1 ) ;
+	    O1O1_add( W , idx( b , prime , c , h , g , g , h , b ) , prime*NC + c , +1 ) ;
+	    // op4
+	    O1O1_add( W , idx( b , b , c , prime , g , g , h , h ) , prime*NC + c , +1 ) ;
+	    O1O1_add( W , idx( b , b , c , prime , g , h , h , g ) , prime*NC + c , -1 ) ;
+	    O1O1_add( W , idx( b , g , c , prime , g , b , h , h ) , prime*NC + c , -1 ) ;
+	    O1O1_add( W , idx( b , h , c , prime , g , b , h , g ) , prime*NC + c , +1 ) ;
+	    O1O1_add( W , idx( b , g , c , prime , g , h , h , b ) , prime*NC + c , +1 ) ;
+	    O1O1_add( W , idx( b , h , c , prime , g , g , h , b ) , prime*NC + c , -1 ) ;
+	  }
+	}
+      }
+    }
+  }
+  return ;
+}
+
+// diquark - baryon-meson
+static void
+O1O2_terms( int **W )
+{
+  size_t b , c , g , h ; 
+  for( b = 0 ; b < NC ; b++ ) {
+    for( c = 0 ; c < NC ; c++ ) {
+      for( g = 0 ; g < NC ; g++ ) {
+	for( h = 0 ; h < NC ; h++ ) {
+	  // first set of epsilon identities
+	  O1O2_add( W , idx( c , b , c , h , g , g , h , b ) , +1 ) ;
+	  O1O2_add( W , idx( c , b , c , g , h , g , h , b ) , -1 ) ;
+	  O1O2_add( W , idx( g , b , c , h , c , g , h , b ) , -1 ) ;
+	  O1O2_add( W , idx( h , b , c , g , c , g , h , b ) , +1 ) ;
+	  O1O2_add( W , idx( g , b , c , c , h , g , h , b ) , +1 ) ;
+	  O1O2_add( W , idx( h , b , c , c , g , g , h , b ) , -1 ) ;
+	  // second set of epsilon identities
+	  O1O2_add( W , idx( b , b , c , h , g , g , h , c ) , -1 ) ;
+	  O1O2_add( W , idx( b , b , c , g , h , g , h , c ) , +1 ) ;
+	  O1O2_add( W , idx( g , b , c , h , b , g , h , c ) , +1 ) ;
+	  O1O2_add( W , idx( h , b , c , g , b , g , h , c ) , -1 ) ;
+	  O1O2_add( W , idx( g , b , c , b , h , g , h , c ) , -1 ) ;
+	  O1O2_add( W , idx( h , b , c , b , g , g , h , c ) , +1 ) ;
+	}
+      }
+    }
+  }
+  return ;
+}
+
+// baryon-meson - diquark
+static void
+O2O1_terms( int **W )
+{
+  size_t a , b , c , prime ;
+  for( a = 0 ; a < NC ; a++ ) {
+    for( c = 0 ; c < NC ; c++ ) {
+      for( b = 0 ; b < NC ; b++ ) {
+	for( prime = 0 ; prime < NC ; prime++ ) {
+	  // first set of epsilon identities
+	  O2O1_add( W , idx( prime , c , b , b , c , a , prime , a ) , +1 ) ;
+	  O2O1_add( W , idx( prime , b , c , b , c , a , prime , a ) , -1 ) ;
+	  O2O1_add( W , idx( prime , c , a , b , c , b , prime , a ) , -1 ) ;
+	  O2O1_add( W , idx( prime , b , a , b , c , c , prime , a ) , +1 ) ;
+	  O2O1_add( W , idx( prime , a , c , b , c , b , prime , a ) , +1 ) ;
+	  O2O1_add( W , idx( prime , a , b , b , c , c , prime , a ) , -1 ) ;
+	  // second set of epsilon identities
+	  O2O1_add( W , idx( prime , c , b , b , c , prime , a , a ) , -1 ) ;
+	  O2O1_add( W , idx( prime , b , c , b , c , prime , a , a ) , +1 ) ;
+	  O2O1_add( W , idx( prime , c , a , b , c , prime , b , a ) , +1 ) ;
+	  O2O1_add( W , idx( prime , b , a , b , c , prime , c , a ) , -1 ) ;
+	  O2O1_add( W , idx( prime , a , c , b , c , prime , b , a ) , -1 ) ;
+	  O2O1_add( W , idx( prime , a , b , b , c , prime , c , a ) , +1 ) ;
+	}
+      }
+    }
+  }
+  return ;
+}
+
+// baryon-meson - baryon-meson
+static void
+O2O3_terms( int **W )
+{
+  size_t a , b , c ;
+  for( a = 0 ; a < NC ; a++ ) {
+    for( c = 0 ; c < NC ; c++ ) {
+      for( b = 0 ; b < NC ; b++ ) {
+	// epsilon identities
+	O2O3_add( W , idx2( b , b , c , c , a , a ) , +1 ) ;
+	O2O3_add( W , idx2( c , b , c , b , a , a ) , -1 ) ;
+	O2O3_add( W , idx2( a , b , c , c , a , b ) , -1 ) ;
+	O2O3_add( W , idx2( a , b , c , b , a , c ) , +1 ) ;
+	O2O3_add( W , idx2( c , b , c , a , a , b ) , +1 ) ;
+	O2O3_add( W , idx2( b , b , c , a , a , c ) , -1 ) ;
+      }
+    }
+  }
+  return ;
+}
+
+// pack the nonzero entries of a dense table into a list
+static int
+pack_terms( struct penta_colors *PC ,
+	    const penta_terms list ,
+	    const int *W )
+{
+  const size_t N = NCNC*NBLK*NBLK ;
+  size_t i , n = 0 ;
+  for( i = 0 ; i < N ; i++ ) {
+    if( W[i] != 0 ) n++ ;
+  }
+  if( corr_malloc( (void**)&PC -> T[ list ] , ALIGNMENT ,
+		   ( n > 0 ? n : 1 )*sizeof( struct penta_term ) ) != 0 ) {
+    fprintf( stderr , "[PENTA] colour term allocation failure\n" ) ;
+    return FAILURE ;
+  }
+  PC -> n[ list ] = n ;
+  n = 0 ;
+  for( i = 0 ; i < N ; i++ ) {
+    if( W[i] == 0 ) continue ;
+    PC -> T[ list ][ n ].K = (uint8_t)( i/( NBLK*NBLK ) ) ;
+    PC -> T[ list ][ n ].A = (uint8_t)( ( i/NBLK )%NBLK ) ;
+    PC -> T[ list ][ n ].B = (uint8_t)( i%NBLK ) ;
+    PC -> T[ list ][ n ].w = W[i] ;
+    n++ ;
+  }
+  return SUCCESS ;
+}
+
+// free the term lists
+void
+free_penta_colors( struct penta_colors *PC )
+{
+  size_t list ;
+  for( list = 0 ; list < PENTA_NTERMS ; list++ ) {
+    if( PC -> T[ list ] != NULL ) {
+      free( PC -> T[ list ] ) ;
+    }
+    PC -> T[ list ] = NULL ;
+    PC -> n[ list ] = 0 ;
+  }
+  return ;
+}
+
+// build the term lists from the epsilon identities
+int
+init_penta_colors( struct penta_colors *PC )
+{
+  size_t list ;
+  for( list = 0 ; list < PENTA_NTERMS ; list++ ) {
+    PC -> T[ list ] = NULL ;
+    PC -> n[ list ] = 0 ;
+  }
+
+  const size_t N = NCNC*NBLK*NBLK ;
+  int *W[ 2 ] = { calloc( N , sizeof( int ) ) , calloc( N , sizeof( int ) ) } ;
+  int error_code = SUCCESS ;
+  if( W[0] == NULL || W[1] == NULL ) {
+    fprintf( stderr , "[PENTA] colour table allocation failure\n" ) ;
+    error_code = FAILURE ; goto memfree ;
+  }
+
+  // the two parts of the diquark - diquark
+  O1O1_terms( W ) ;
+  if( pack_terms( PC , O1O1_TRTR , W[0] ) == FAILURE ||
+      pack_terms( PC , O1O1_TRPROD , W[1] ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
+  // the diquark / baryon-meson crosses
+  memset( W[0] , 0 , N*sizeof( int ) ) ;
+  O1O2_terms( W ) ;
+  if( pack_terms( PC , O1O2_PROD , W[0] ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+  memset( W[0] , 0 , N*sizeof( int ) ) ;
+  O2O1_terms( W ) ;
+  if( pack_terms( PC , O2O1_PROD , W[0] ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
+  // and the baryon-meson - baryon-meson
+  memset( W[0] , 0 , N*sizeof( int ) ) ;
+  memset( W[1] , 0 , N*sizeof( int ) ) ;
+  O2O3_terms( W ) ;
+  if( pack_terms( PC , O2O3_TR , W[0] ) == FAILURE ||
+      pack_terms( PC , O2O3_CROSS , W[1] ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
+ memfree :
+  if( W[0] != NULL ) free( W[0] ) ;
+  if( W[1] != NULL ) free( W[1] ) ;
+  if( error_code == FAILURE ) {
+    free_penta_colors( PC ) ;
+  }
+  return error_code ;
+}
+
+#undef NBLK
@@ -17,25 +17,68 @@
 #include "contract_O3O2.h"  
 #include "contract_O3O3.h"  
 
-#include "spinmatrix_ops.h" // spinmatrix_trace()
+#include "gammas.h"          // CGmu() and gt_Gdag_gt()
+#include "Ospinor.h"         // spinor_to_Ospinor()
+#include "penta_contractions.h" // penta_axpy()
+#include "spinmatrix_ops.h"  // spinmatrix_trace()
+#include "spinor_ops.h"      // transpose_spinor()
 
 // contraction function calls
-// assumes OP1 is the gamma matrix for the forward propagating state
-// and OP2 is the gamma for the backward propagating state
+// b1 is the block of the gamma matrix for the forward propagating state
+// and b2 is the block for the backward propagating state
 void (*contract[9])( struct spinmatrix *P ,
-		     double complex **F ,
-		     const struct spinor U ,
+		     const struct penta_site *PS ,
 		     const struct spinor D ,
 		     const struct spinor S ,
-		     const struct spinor B ,
-		     const struct gamma OP1 ,
-		     const struct gamma OP2 ,
-		     const struct gamma *GAMMAS ,
-		     const uint8_t **loc ) = {
+		     const size_t b1 ,
+		     const size_t b2 ) = {
   contract_O1O1 , contract_O1O2 , contract_O1O3 ,
   contract_O2O1 , contract_O2O2 , contract_O2O3 ,
   contract_O3O1 , contract_O3O2 , contract_O3O3 } ;
 
+// all products of the colour blocks of L and R
+void
+penta_blocks( struct spinmatrix *T ,
+	      const struct Ospinor *L ,
+	      const struct Ospinor *R )
+{
+  size_t c1 , c2 , c3 , c4 ;
+  for( c1 = 0 ; c1 < NC ; c1++ ) {
+    for( c2 = 0 ; c2 < NC ; c2++ ) {
+      for( c3 = 0 ; c3 < NC ; c3++ ) {
+	for( c4 = 0 ; c4 < NC ; c4++ ) {
+	  spinmatrix_multiply( T[ ( c2 + NC*c1 )*NCNC + c4 + NC*c3 ].D ,
+			       L -> C[ c1 ][ c2 ].D , R -> C[ c3 ][ c4 ].D ) ;
+	}
+      }
+    }
+  }
+  return ;
+}
+
+// the terms come sorted by left block so we sum up the right blocks of
+// each run and then do a single multiply
+void
+penta_prod_terms( struct spinmatrix *P ,
+		  const struct spinmatrix *L ,
+		  const struct spinmatrix *R ,
+		  const struct penta_term *T ,
+		  const size_t n )
+{
+  size_t k = 0 ;
+  while( k < n ) {
+    const uint8_t A = T[k].A ;
+    struct spinmatrix X , LX ;
+    memset( &X , 0 , sizeof( struct spinmatrix ) ) ;
+    for( ; k < n && T[k].A == A ; k++ ) {
+      penta_axpy( &X , T[k].w , R + T[k].B ) ;
+    }
+    spinmatrix_multiply( LX.D , L[ A ].D , X.D ) ;
+    penta_axpy( P , 1.0 , &LX ) ;
+  }
+  return ;
+}
+
 // project to a particular parity
 static void
 project_parity( double complex *pos ,
@@ -80,24 +123,39 @@ project_parity( double complex *pos ,
 // so it has similar block matrix structure as the TETRA contractions
 int
 pentas( double complex *result ,
-	double complex **F ,
 	const struct spinor U ,
 	const struct spinor D , 
 	const struct spinor S ,
 	const struct spinor bwdH ,
 	const struct gamma *GAMMAS ,
-	const uint8_t **loc )
+	const struct penta_colors *PC )
 {
 #if PENTA_NBLOCK > 4
   fprintf( stderr , "[PENTA] compiled PENTA_NBLOCK greater than we allow\n" ) ;
   return FAILURE ;
 #endif
 
-  struct gamma GBLOCK[ 4 ] = { GAMMAS[ GAMMA_5 ] ,
-			       GAMMAS[ IDENTITY ] ,
-			       GAMMAS[ AT ] ,
-			       GAMMAS[ GAMMA_T ] } ;
+  const struct gamma GBLOCK[ 4 ] = { GAMMAS[ GAMMA_5 ] ,
+				     GAMMAS[ IDENTITY ] ,
+				     GAMMAS[ AT ] ,
+				     GAMMAS[ GAMMA_T ] } ;
 
+  // everything the operators share is built once for the site
+  struct penta_site PS ;
+  PS.U = U ;
+  PS.UT = transpose_spinor( U ) ;
+  PS.B = bwdH ;
+  PS.OU = spinor_to_Ospinor( U ) ;
+  PS.OUT = spinor_to_Ospinor( PS.UT ) ;
+  PS.GAMMAS = GAMMAS ;
+  PS.PC = PC ;
+  size_t b ;
+  for( b = 0 ; b < PENTA_NBLOCK ; b++ ) {
+    PS.G[ b ] = GBLOCK[ b ] ;
+    PS.CG[ b ] = CGmu( GBLOCK[ b ] , GAMMAS ) ;
+    PS.tGt[ b ] = gt_Gdag_gt( GBLOCK[ b ] , GAMMAS[ GAMMA_T ] ) ;
+    PS.tCGt[ b ] = gt_Gdag_gt( PS.CG[ b ] , GAMMAS[ GAMMA_T ] ) ;
+  }
   
   size_t idx ;
   for( idx = 0 ; idx < (PENTA_NBLOCK*PENTA_NBLOCK*PENTA_NOPS) ; idx++ ) {
@@ -107,21 +165,9 @@ pentas( double complex *result ,
     const size_t b2 = (idx/PENTA_NOPS)%PENTA_NBLOCK ;
     const size_t i  = (idx)%PENTA_NOPS ;
 
-    // turn off the diquarky ones until I fix them if I ever do
-    switch( i ) {
-    case 0 : case 1 : case 2 : case 3 : case 6 :
-      continue ;
-    default :
-      break ;
-    }
-    
     // do the contractions
     struct spinmatrix P ;
-    contract[i]( &P , F , U , D , S , bwdH ,
-		 GBLOCK[ b1 ] ,
-		 GBLOCK[ b2 ] ,
-		 GAMMAS ,
-		 loc ) ;
+    contract[i]( &P , &PS , D , S , b1 , b2 ) ;
 
     // get the map correct
     const size_t icol = i%3 , irow = i/3 ;
@@ -12,11 +12,14 @@
 #include "cut_routines.h"       // veclist
 #include "gammas.h"             // make_gammas() && gamma_mmul*
 #include "io.h"                 // for read_prop()
+#include "penta_colors.h"       // init_penta_colors()
 #include "progress_bar.h"       // progress_bar()
 #include "quark_smear.h"        // sink_smear()
+#include "scratch.h"            // scratch_get()
 #include "setup.h"              // init_measurements() ..
 #include "spinor_ops.h"         // sumprop()
 #include "penta_contractions.h" // pentas()
+#include "wrap_pentas.h"       // penta_scratch_bytes()
 
 // number of propagators
 #define Nprops (3)
@@ -40,17 +43,10 @@ pentaquark_udusb( struct propagator prop1 , // L
   // error flag
   int error_code = SUCCESS ;
 
-  // each thread gets a copy
-  uint8_t **loc = malloc( PENTA_NCOLORS * sizeof( uint8_t* ) ) ;
-  size_t j , k ;
-  for( j = 0 ; j < PENTA_NCOLORS ; j++ ) {
-    loc[ j ] = malloc( 8 * sizeof( uint8_t ) ) ;
-    size_t sub = NC , div = 1 ; 
-    for( k = 8 ; k > 0 ; k-- ) {
-      loc[ j ][ 8 - k ] = (uint8_t)( ( j % sub ) / div ) ;
-      sub *= NC ;
-      div *= NC ;
-    }
+  // colour term lists shared by all threads
+  struct penta_colors PC ;
+  if( init_penta_colors( &PC ) == FAILURE ) {
+    return FAILURE ;
   }
   
   // initialise our measurement struct
@@ -64,34 +60,42 @@ pentaquark_udusb( struct propagator prop1 , // L
     error_code = FAILURE ; goto memfree ;
   }
 
+  // make sure each thread's arena can hold its results
+  if( scratch_reserve( penta_scratch_bytes( ) ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
   // init the parallel region
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
 #pragma omp parallel
   {
-    // F-tensor
-    double complex **F = malloc( NSNS * sizeof( double complex* ) ) ;
-    size_t i ;
-    for( i = 0 ; i < NSNS ; i++ ) {
-      F[i] = malloc( PENTA_NCOLORS * sizeof( double complex ) ) ;
+    // result storage comes from this thread's arena
+    const size_t mark = scratch_mark( ) ;
+    double complex *result = scratch_get( 2 * stride2 *
+					  sizeof( double complex ) ) ;
+    if( result == NULL ) {
+      error_code = FAILURE ;
     }
 
-    // result storage
-    double complex *result = malloc( 2 * stride2 * sizeof( double complex ) ) ;
-
     // loop counters
-    size_t t = 0 ;
+    size_t tt = 0 ;
     
     // read in the first timeslice
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
     // smear it if we wish
-    sink_smear( M.S , M.S1 , t , CUTINFO , Nprops ) ;
+    sink_smear( M.S , M.S1 , tstart , CUTINFO , Nprops ) ;
 
     {
        #pragma omp barrier
     }
     
     // Time slice loop 
-    for( t = 0 ; t < LT ; t++ ) {
+    for( tt = 0 ; tt < LT ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
       
       // if we are doing nonrel-chiral hadrons we switch chiral to nrel
       rotate_offdiag( M.S , prop , Nprops ) ;
@@ -107,13 +111,19 @@ pentaquark_udusb( struct propagator prop1 , // L
       
       size_t site ;
       // read on the master and slaves
-      if( t < LT-1 ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
 
+      // spatial sums by FFT convolution if that is cheaper
+      sum_spatial_conv( &M ) ;
+
       // Loop over spatial volume threads better
       #pragma omp for private(site) schedule(dynamic)
       for( site = 0 ; site < LCU ; site++ ) {
+
+	// no storage for this thread, error_code is already set
+	if( result == NULL ) continue ;
 		
 	// pentaquark contractions stored in result
 	size_t op ;
@@ -130,8 +140,8 @@ pentaquark_udusb( struct propagator prop1 , // L
 	full_adj( &bwdH , SUM_r2[2] , M.GAMMAS[ GAMMA_5 ] ) ;
 	
 	// perform contraction, result in result
-	pentas( result , F , SUM_r2[0] , SUM_r2[0] , SUM_r2[1] , bwdH ,
-		M.GAMMAS , (const uint8_t**)loc ) ;
+	pentas( result , SUM_r2[0] , SUM_r2[0] , SUM_r2[1] , bwdH ,
+		M.GAMMAS , &PC ) ;
 	
 	// put contractions into flattend array for FFT
 	for( op = 0 ; op < stride2 ; op++ ) {
@@ -142,7 +152,7 @@ pentaquark_udusb( struct propagator prop1 , // L
 
       // wall-wall contractions
       #pragma omp single nowait
-      {
+      if( result != NULL ) {
 	struct spinor SUMbwdH ;
 	full_adj( &SUMbwdH , M.SUM[2] , M.GAMMAS[ GAMMA_5 ] ) ;
 	  
@@ -151,8 +161,8 @@ pentaquark_udusb( struct propagator prop1 , // L
 	  result[ k ] = 0.0 ;
 	}
 	// perform contraction, result in result
-	pentas( result , F , M.SUM[0] , M.SUM[0] , M.SUM[1] , SUMbwdH ,
-		M.GAMMAS , (const uint8_t**)loc ) ;
+	pentas( result , M.SUM[0] , M.SUM[0] , M.SUM[1] , SUMbwdH ,
+		M.GAMMAS , &PC ) ;
 	// put contractions into final correlator object
 	size_t op ;
 	for( op = 0 ; op < stride2 ; op++ ) {
@@ -165,8 +175,8 @@ pentaquark_udusb( struct propagator prop1 , // L
       compute_correlator( &M , stride1 , stride2 , tshifted ) ;
 
       // smear the forward prop
-      if( t < (LT-1) ) {
-	sink_smear( M.Sf , M.S1 , t+1 , CUTINFO , Nprops ) ;
+      if( tt < LT-1 ) {
+	sink_smear( M.Sf , M.S1 , (t+1)%LT , CUTINFO , Nprops ) ;
       }
       
       #pragma omp single
@@ -175,18 +185,12 @@ pentaquark_udusb( struct propagator prop1 , // L
 	copy_props( &M , Nprops ) ;
 	
 	// status of the computation
-	progress_bar( t , LT ) ;
+	progress_bar( tt , LT ) ;
       }
     }
 
-    // frees from within the parallel region
-    free( result ) ;
-
-    // free the f-tensor
-    for( i = 0 ; i < NSNS ; i++ ) {
-      free( F[ i ] ) ;
-    }
-    free( F ) ;
+    // hand the results back to the arena
+    scratch_release( mark ) ;
   }
 
   // skip writing the files out if we fucked up
@@ -198,14 +202,9 @@ pentaquark_udusb( struct propagator prop1 , // L
   // memfree sink
  memfree :
 
-  // free the lookup table
-  if( loc != NULL ) {
-    for( j = 0 ; j < PENTA_NCOLORS ; j++ ) {
-      free( loc[j] ) ;
-    }
-    free( loc ) ;
-  }
-  
+  // free the colour terms
+  free_penta_colors( &PC ) ;
+
   // free our measurement struct
   free_measurements( &M , Nprops , stride1 , stride2 , flat_dirac ) ;
 
@@ -8,6 +8,14 @@
 #include "penta_udusb.h"      // light flavour degenerate
 #include "penta_bubds.h"      // new pentaquark guy
 #include "read_propheader.h"  // for read_propheader()
+#include "scratch.h"          // scratch_size()
+
+// the two parities of results for each thread
+size_t
+penta_scratch_bytes( void )
+{
+  return scratch_size( 2*PENTA_NOPS*PENTA_NBLOCK*PENTA_NBLOCK*sizeof( double complex ) ) ;
+}
 
 // pentaaquark calculator, prop3 should be the heavy one, prop2 the strange
 // and prop1 the light ones
@@ -30,7 +38,7 @@ contract_pentas( struct propagator *prop ,
 
     // check origins are the same and plaquettes are the same
     if( sanity_check_props( prop , pentas[ measurements ].map ,
-			    5 , "[PENTAS]" ) == FAILURE ) {
+			    5 , "[PENTAS]" , GLU_FALSE ) == FAILURE ) {
       return FAILURE ;
     }
 
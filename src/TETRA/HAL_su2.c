@@ -7,6 +7,7 @@
 #include "corr_malloc.h"
 #include "contractions.h"    // full_adj()
 #include "correlators.h"     // allocate_corrs() && free_corrs()
+#include "dibaryon_contractions.h" // dibaryon_gammas()
 #include "HAL_rhorho.h"
 #include "io.h"              // for read_prop()
 #include "plan_ffts.h"
@@ -18,6 +19,9 @@
 // number of props
 #define Nprops (1)
 
+// number of left gammas we keep half blocks for
+#define NGAM (1)
+
 // su2 rhoeta is only the connected diagrams for the
 // rho-eta looking fella di-meson:
 // ( \bar\psi_a \gamma_5 \psi_a )( \bar\psi_b \gamma_i \psi_b )
@@ -36,6 +40,22 @@ HAL_su2( struct propagator prop1 ,
   // error flag
   int error_code = SUCCESS ;
 
+  // forward and backward transformed half block slabs and the
+  // pointers into them
+  struct spinmatrix *slab[ 2 ] = { NULL , NULL } ;
+  struct spinmatrix **L[ 2 ] = { NULL , NULL } ;
+
+#ifdef HAVE_FFTW3_H
+  fftw_plan forward = NULL , backward = NULL ;
+#endif
+
+  // without FFTW the momentum list is walked as separations in
+  // HALrhorho_contract() so it has to be one orbit per entry
+  if( CUTINFO.momavg == GLU_TRUE ) {
+    fprintf( stdout , "[TETRA] HAL correlators are not orbit averaged\n" ) ;
+    CUTINFO.momavg = GLU_FALSE ;
+  }
+
   // initialise our measurement struct
   struct propagator prop[ Nprops ] = { prop1 } ;
   const int sign[ Nprops ] = { +4 } ;
@@ -48,42 +68,49 @@ HAL_su2( struct propagator prop1 ,
 
   // FFT all that jazz
 #ifdef HAVE_FFTW3_H
-  fftw_plan forward , backward ;
   small_create_plans_DFT( &forward , &backward , M.in[0] , M.in[1] , ND-1 ) ;
 #endif
   
-  // precompute the diquark blocks, called blk. Very big mallocs in here
-  struct spinmatrix **blk11 ;
-  struct spinmatrix **blk12 ;
-  struct spinmatrix **blk21 ;
-  struct spinmatrix **blk22 ;
-  size_t i ;
-  blk11 = malloc( LCU*sizeof(struct spinmatrix*) ) ;
-  blk12 = malloc( LCU*sizeof(struct spinmatrix*) ) ;
-  blk21 = malloc( LCU*sizeof(struct spinmatrix*) ) ;
-  blk22 = malloc( LCU*sizeof(struct spinmatrix*) ) ;
-  for( i = 0 ; i < LCU ; i++ ) {
-    blk11[i] = malloc( NCNC*NCNC*sizeof(struct spinmatrix) ) ;
-    blk12[i] = malloc( NCNC*NCNC*sizeof(struct spinmatrix) ) ;
-    blk21[i] = malloc( NCNC*NCNC*sizeof(struct spinmatrix) ) ;
-    blk22[i] = malloc( NCNC*NCNC*sizeof(struct spinmatrix) ) ;
+  // the gammas are the same for every timeslice
+  struct gamma CG[ NGAM ] , tCGt[ NGAM ] ;
+  dibaryon_gammas( CG , tCGt , M.GAMMAS , NGAM ) ;
+
+  // precompute the half diquark blocks, called L. Very big so each of
+  // the two is a single aligned slab with LCU pointers into it
+  size_t i , n ;
+  for( n = 0 ; n < 2 ; n++ ) {
+    if( corr_malloc( (void**)&slab[n] , ALIGNMENT , LCU*NGAM*NCNC*NCNC*
+		     sizeof( struct spinmatrix ) ) != 0 ||
+	corr_malloc( (void**)&L[n] , ALIGNMENT ,
+		     LCU*sizeof( struct spinmatrix* ) ) != 0 ) {
+      fprintf( stderr , "[TETRA] HAL block allocation failure\n" ) ;
+      error_code = FAILURE ; goto memfree ;
+    }
+    for( i = 0 ; i < LCU ; i++ ) {
+      L[n][i] = slab[n] + i*NGAM*NCNC*NCNC ;
+    }
   }
   
   // init the parallel region
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
   #pragma omp parallel
   {
     // loop counters
-    size_t t = 0 ;
+    size_t tt = 0 ;
     
     // read in the first timeslice
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
     {
        #pragma omp barrier
     }
     
     // Time slice loop 
-    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
 
       // compute wall sum
       #pragma omp single nowait
@@ -95,14 +122,18 @@ HAL_su2( struct propagator prop1 ,
       const size_t tshifted = ( t - prop1.origin[ND-1] + LT ) % LT ; 
       
       // read on the master and one slave
-      if( t < LT-1 ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
 
-      HALrhorho_contract( M.in[0] , M.in[1] , forward , backward ,
-			  blk11 , blk12 , blk21 , blk22 ,
-			  M.S[0] , M.GAMMAS , 0 , 0 ,
-			  M.nmom , M.list ) ;
+      // the sink gamma independent work happens once per timeslice
+      HALrhorho_halfblocks( M.in[0] , M.in[1] , forward , backward ,
+			    L[0] , L[1] , M.S[0] , CG , NGAM ) ;
+
+      HALrhorho_contract( M.in[0] , M.in[1] , backward ,
+			  (const struct spinmatrix**)L[0] ,
+			  (const struct spinmatrix**)L[1] ,
+			  tCGt , 0 , 0 , M.nolist , M.olist ) ;
       
       
       // compute the contracted correlator
@@ -114,7 +145,7 @@ HAL_su2( struct propagator prop1 ,
 	copy_props( &M , Nprops ) ;
 	
 	// status of the computation
-	progress_bar( t , LT ) ;
+	progress_bar( tt , LT ) ;
       }
     }
   }
@@ -129,20 +160,24 @@ HAL_su2( struct propagator prop1 ,
  memfree :
 
   // fftw free some stuff
-  fftw_destroy_plan( forward ) ;
-  fftw_destroy_plan( backward ) ;
+#ifdef HAVE_FFTW3_H
+  if( forward != NULL ) {
+    fftw_destroy_plan( forward ) ;
+  }
+  if( backward != NULL ) {
+    fftw_destroy_plan( backward ) ;
+  }
+#endif
 
   // free the blocks
-  for( i = 0 ; i < LCU ; i++ ) {
-    free( blk11[i] ) ;
-    free( blk12[i] ) ;
-    free( blk21[i] ) ;
-    free( blk22[i] ) ;
+  for( n = 0 ; n < 2 ; n++ ) {
+    if( slab[n] != NULL ) {
+      free( slab[n] ) ;
+    }
+    if( L[n] != NULL ) {
+      free( L[n] ) ;
+    }
   }
-  free( blk11 ) ;
-  free( blk12 ) ;
-  free( blk21 ) ;
-  free( blk22 ) ;
 
   // free our measurement struct
   free_measurements( &M , Nprops , stride1 , stride2 , flat_dirac ) ;
@@ -150,5 +185,6 @@ HAL_su2( struct propagator prop1 ,
   return error_code ;
 }
 
-// clean up the number of props
+// clean up the number of props and gammas
 #undef Nprops
+#undef NGAM
@@ -4,10 +4,11 @@
  */
 #include "common.h"
 
-#include "gammas.h"             
-#include "Ospinor.h"
-#include "spinmatrix_ops.h" 
-#include "spinor_ops.h"     // transpose_spinor()
+#include "gammas.h"          // CGmu()
+#include "Ospinor.h"         // spinor_to_Ospinor()
+#include "scratch.h"         // scratch_get()
+#include "spinmatrix_ops.h"  // spinmatrix_multiply()
+#include "spinor_ops.h"      // transpose_spinor()
 
 // does Tr[ S1T G1 S2 G2 S3T G3 S4 G4 ]
 static inline double complex
@@ -46,61 +47,73 @@ get_idx( const size_t a , const size_t b , const size_t ap , const size_t bp )
   return bp + NC*( ap + NC*( b + NC*a ) ) ;
 }
 
-double complex
-dibaryon_contract( struct spinor S1 ,
-		   struct spinor S2 ,
-		   const struct gamma *GAMMAS ,
-		   const size_t GSRC ,
-		   const size_t GSNK )
+// gammas C\gamma_g and \gamma_t ( C\gamma_g )^\dagger \gamma_t
+void
+dibaryon_gammas( struct gamma *CG ,
+		 struct gamma *tCGt ,
+		 const struct gamma *GAMMAS ,
+		 const size_t nG )
 {
-  // precomputations -> swap color and dirac indices to expose spinmatrices
-  struct Ospinor OS1T = spinor_to_Ospinor( transpose_spinor( S1 ) ) ;
-  struct Ospinor OS1  = spinor_to_Ospinor( S1 ) ;
-  struct Ospinor OS2T = spinor_to_Ospinor( transpose_spinor( S2 ) ) ;
-  struct Ospinor OS2  = spinor_to_Ospinor( S2 ) ;
-  
-  // gamma precomputations
-  const struct gamma G1   = CGmu( GAMMAS[ GSRC ] , GAMMAS ) ;
-  const struct gamma tG1t = gt_Gdag_gt( G1 , GAMMAS[ GAMMA_T ] ) ;
+  size_t g ;
+  for( g = 0 ; g < nG ; g++ ) {
+    CG[ g ]   = CGmu( GAMMAS[ g ] , GAMMAS ) ;
+    tCGt[ g ] = gt_Gdag_gt( CG[ g ] , GAMMAS[ GAMMA_T ] ) ;
+  }
+  return ;
+}
 
-  // gamma precomputations
-  const struct gamma G2   = CGmu( GAMMAS[ GSNK ] , GAMMAS ) ;
-  const struct gamma tG2t = gt_Gdag_gt( G2 , GAMMAS[ GAMMA_T ] ) ;
-  
-  // precompute the diquark blocks, called blk
-  struct spinmatrix blk11[ NCNC*NCNC ] , blk12[ NCNC*NCNC ] ,
-    blk21[ NCNC*NCNC ] , blk22[ NCNC*NCNC ] ;
+// the halves of the blocks that do not see the right gamma,
+// L[g][abcd] = OST.C[ap][bp] CG[g] OS.C[a][b]
+void
+dibaryon_halfblocks( struct spinmatrix *L ,
+		     const struct spinor S ,
+		     const struct gamma *CG ,
+		     const size_t nG )
+{
+  // precomputations -> swap color and dirac indices to expose spinmatrices
+  const struct Ospinor OST = spinor_to_Ospinor( transpose_spinor( S ) ) ;
+  const struct Ospinor OS  = spinor_to_Ospinor( S ) ;
 
-  // multiply left and right by gammas into tmp with color indices ab
-  // and multiply on the left by the transposed prop and save result
+  // left multiply by the gamma into tmp with color indices ab
+  // and multiply on the left by the transposed prop
   struct spinmatrix tmp ;
-  size_t a , b , ap , bp , abcd ;
+  size_t g , a , b , ap , bp , abcd ;
+  for( g = 0 ; g < nG ; g++ ) {
+    for( abcd = 0 ; abcd < NCNC*NCNC ; abcd++ ) {
+      get_abcd( &a , &b , &ap , &bp , abcd ) ;
+      tmp = OS.C[a][b] ;
+      gamma_spinmatrix( (void*)tmp.D , CG[ g ] ) ;
+      spinmatrix_multiply( (void*)L[ abcd ].D ,
+			   (void*)OST.C[ap][bp].D , (void*)tmp.D ) ;
+    }
+    L += NCNC*NCNC ;
+  }
+  return ;
+}
+
+// finish the blocks off with the right gamma, blk = L tGt
+void
+dibaryon_blocks( struct spinmatrix *blk ,
+		 const struct spinmatrix *L ,
+		 const struct gamma tGt )
+{
+  size_t abcd ;
   for( abcd = 0 ; abcd < NCNC*NCNC ; abcd++ ) {
-    get_abcd( &a , &b , &ap , &bp , abcd ) ;
-    // g1g1 case
-    tmp = OS2.C[a][b] ;
-    gamma_spinmatrix_lr( &tmp , G1 , tG1t ) ;
-    spinmatrix_multiply( (void*)blk11[abcd].D ,
-			 (void*)OS2T.C[ap][bp].D , (void*)tmp.D ) ;
-    // g1g2 case
-    tmp = OS2.C[a][b] ;
-    gamma_spinmatrix_lr( &tmp , G1 , tG2t ) ;
-    spinmatrix_multiply( (void*)blk12[abcd].D ,
-			 (void*)OS2T.C[ap][bp].D , (void*)tmp.D ) ;
-    // g2g1 case
-    tmp = OS1.C[a][b] ;
-    gamma_spinmatrix_lr( &tmp , G2 , tG1t ) ;
-    spinmatrix_multiply( (void*)blk21[abcd].D ,
-			 (void*)OS1T.C[ap][bp].D , (void*)tmp.D ) ;
-    // g2g2 case
-    tmp = OS1.C[a][b] ;
-    gamma_spinmatrix_lr( &tmp , G2 , tG2t ) ;
-    spinmatrix_multiply( (void*)blk22[abcd].D ,
-			 (void*)OS1T.C[ap][bp].D , (void*)tmp.D ) ;
+    blk[ abcd ] = L[ abcd ] ;
+    spinmatrix_gamma( (void*)blk[ abcd ].D , tGt ) ;
   }
+  return ;
+}
 
-  // do all of the 4! contractions summing over the 16 color combinations
-  // note that I use the identity that G^T for gamma_i is G
+// do all of the 4! contractions summing over the 16 color combinations
+// note that I use the identity that G^T for gamma_i is G
+double complex
+dibaryon_diagrams( const struct spinmatrix *blk11 ,
+		   const struct spinmatrix *blk12 ,
+		   const struct spinmatrix *blk21 ,
+		   const struct spinmatrix *blk22 )
+{
+  size_t a , b , ap , bp , abcd ;
   register double complex sum = 0.0 ;
   for( abcd = 0 ; abcd < NCNC*NCNC ; abcd++ ) {
     get_abcd( &a , &b , &ap , &bp , abcd ) ;
@@ -153,10 +166,88 @@ dibaryon_contract( struct spinor S1 ,
     // diagram 24/24
     sum += double_tr( blk12[get_idx(b,ap,a,bp)] , blk21[get_idx(b,ap,a,bp)] ) ;
   }
-  
   return sum ;
 }
 
+// the single contraction, S2 gets the source gamma on the left and S1 the sink
+double complex
+dibaryon_contract( struct spinor S1 ,
+		   struct spinor S2 ,
+		   const struct gamma *GAMMAS ,
+		   const size_t GSRC ,
+		   const size_t GSNK )
+{
+  // gamma precomputations
+  struct gamma CG[ 2 ] , tCGt[ 2 ] ;
+  CG[ 0 ]   = CGmu( GAMMAS[ GSRC ] , GAMMAS ) ;
+  tCGt[ 0 ] = gt_Gdag_gt( CG[ 0 ] , GAMMAS[ GAMMA_T ] ) ;
+  CG[ 1 ]   = CGmu( GAMMAS[ GSNK ] , GAMMAS ) ;
+  tCGt[ 1 ] = gt_Gdag_gt( CG[ 1 ] , GAMMAS[ GAMMA_T ] ) ;
+
+  // precompute the diquark blocks, called blk
+  struct spinmatrix L1[ NCNC*NCNC ] , L2[ NCNC*NCNC ] ;
+  struct spinmatrix blk11[ NCNC*NCNC ] , blk12[ NCNC*NCNC ] ,
+    blk21[ NCNC*NCNC ] , blk22[ NCNC*NCNC ] ;
+  dibaryon_halfblocks( L2 , S2 , CG , 1 ) ;
+  dibaryon_halfblocks( L1 , S1 , CG + 1 , 1 ) ;
+  dibaryon_blocks( blk11 , L2 , tCGt[0] ) ;
+  dibaryon_blocks( blk12 , L2 , tCGt[1] ) ;
+  dibaryon_blocks( blk21 , L1 , tCGt[0] ) ;
+  dibaryon_blocks( blk22 , L1 , tCGt[1] ) ;
+
+  return dibaryon_diagrams( blk11 , blk12 , blk21 , blk22 ) ;
+}
+
+// what dibaryon_contract_batch() draws from the scratch arena
+size_t
+dibaryon_scratch_bytes( const size_t nG )
+{
+  return scratch_size( nG*NCNC*NCNC*sizeof( struct spinmatrix ) ) +
+    scratch_size( nG*nG*NCNC*NCNC*sizeof( struct spinmatrix ) ) ;
+}
+
+// every source and sink gamma pair for a single propagator
+int
+dibaryon_contract_batch( double complex *res ,
+			 const struct spinor S ,
+			 const struct gamma *CG ,
+			 const struct gamma *tCGt ,
+			 const size_t nG )
+{
+  const size_t nb = NCNC*NCNC ;
+  const size_t mark = scratch_mark( ) ;
+  struct spinmatrix *L = scratch_get( nG*nb*sizeof( struct spinmatrix ) ) ;
+  struct spinmatrix *B = scratch_get( nG*nG*nb*sizeof( struct spinmatrix ) ) ;
+  if( L == NULL || B == NULL ) {
+    scratch_release( mark ) ;
+    return FAILURE ;
+  }
+
+  // the spinmatrix products only ever see the left gamma
+  dibaryon_halfblocks( L , S , CG , nG ) ;
+
+  // and every pair is made from B(x,y) = L_x tCGt_y
+  size_t x , y ;
+  for( x = 0 ; x < nG ; x++ ) {
+    for( y = 0 ; y < nG ; y++ ) {
+      dibaryon_blocks( B + nb*( y + nG*x ) , L + nb*x , tCGt[ y ] ) ;
+    }
+  }
+
+  // for a single propagator swapping source and sink gamma is the same
+  for( x = 0 ; x < nG ; x++ ) {
+    for( y = x ; y < nG ; y++ ) {
+      res[ y + nG*x ] = dibaryon_diagrams( B + nb*( x + nG*x ) ,
+					   B + nb*( y + nG*x ) ,
+					   B + nb*( x + nG*y ) ,
+					   B + nb*( y + nG*y ) ) ;
+      res[ x + nG*y ] = res[ y + nG*x ] ;
+    }
+  }
+  scratch_release( mark ) ;
+  return SUCCESS ;
+}
+
 // slower version down here with explicit gamma stuff -- used for checking
 #if 0
 
@@ -5,16 +5,44 @@
 #include "common.h"
 
 #include "correlators.h"           // allocate_corrs() && free_corrs()
-#include "dibaryon_contractions.h" // dibaryon_contract()
+#include "dibaryon_contractions.h" // dibaryon_contract_batch()
 #include "geometry.h"              // compute_spacing()
 #include "io.h"                    // for read_prop()
 #include "progress_bar.h"          // progress_bar()
+#include "scratch.h"               // scratch_reserve()
 #include "setup.h"                 // compute_correlator() ..
 #include "spinor_ops.h"            // sumprop()
+#include "su2_dibaryon.h"          // alphabetising
 
 // number of props
 #define Nprops (1)
 
+// the gamma_i are the first three
+#define NGAM (3)
+
+// sum of the contractions over gamma_i in both source and sink
+static double complex
+sum_gammas( const double complex res[ NGAM*NGAM ] )
+{
+  // the trick here is that 0,1 == 1,0 so there is just a factor of 2
+  register double complex sum = 0.0 ;
+  size_t i , j ;
+  for( i = 0 ; i < NGAM ; i++ ) {
+    sum += res[ i + NGAM*i ] ;
+    for( j = i+1 ; j < NGAM ; j++ ) {
+      sum += 2*res[ j + NGAM*i ] ;
+    }
+  }
+  return sum ;
+}
+
+// each thread's blocks for every gamma pair
+size_t
+su2_dibaryon_scratch_bytes( void )
+{
+  return dibaryon_scratch_bytes( NGAM ) ;
+}
+
 // su2 dibaryon is ( \psi_a C\gamma_i \psi_b )( \psi_a C\gamma_i \psi_b )
 // with a sum over gamma index "i"
 int
@@ -41,22 +69,36 @@ su2_dibaryon( struct propagator prop1 ,
     fprintf( stderr , "[TETRA] failure to initialise measurements\n" ) ;
     error_code = FAILURE ; goto memfree ;
   }
+
+  // the gammas are the same at every site so do them once
+  struct gamma CG[ NGAM ] , tCGt[ NGAM ] ;
+  dibaryon_gammas( CG , tCGt , M.GAMMAS , NGAM ) ;
+
+  // each thread's blocks for every gamma pair come from its arena
+  if( scratch_reserve( su2_dibaryon_scratch_bytes( ) ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
   
   // init the parallel region
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
   #pragma omp parallel
   {
     // loop counters
-    size_t t = 0 ;
+    size_t tt = 0 ;
     
     // read in the first timeslice
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
     {
        #pragma omp barrier
     }
     
     // Time slice loop 
-    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
 
       // compute wall sum
       #pragma omp single nowait
@@ -70,10 +112,13 @@ su2_dibaryon( struct propagator prop1 ,
       // strange memory access pattern threads better than what was here before
       size_t site ;
       // read on the master and one slave
-      if( t < LT-1 ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
 
+      // spatial sums by FFT convolution if that is cheaper
+      sum_spatial_conv( &M ) ;
+
       // Loop over spatial volume threads better
       #pragma omp for private(site) schedule(dynamic)
       for( site = 0 ; site < LCU ; site++ ) {
@@ -82,27 +127,24 @@ su2_dibaryon( struct propagator prop1 ,
 	struct spinor SUM_r2[ Nprops ] ;
 	sum_spatial_sep( SUM_r2 , M , site ) ;
 	  
-	// the trick here is that 0,1 == 1,0 so there is just a factor of 2
-	register double complex sum = 0.0 ; 
-	sum +=   dibaryon_contract( SUM_r2[0] , SUM_r2[0] , M.GAMMAS , 0 , 0 ) ;
-	sum += 2*dibaryon_contract( SUM_r2[0] , SUM_r2[0] , M.GAMMAS , 0 , 1 ) ;
-	sum += 2*dibaryon_contract( SUM_r2[0] , SUM_r2[0] , M.GAMMAS , 0 , 2 ) ;
-	sum +=   dibaryon_contract( SUM_r2[0] , SUM_r2[0] , M.GAMMAS , 1 , 1 ) ;
-	sum += 2*dibaryon_contract( SUM_r2[0] , SUM_r2[0] , M.GAMMAS , 1 , 2 ) ;
-	sum +=   dibaryon_contract( SUM_r2[0] , SUM_r2[0] , M.GAMMAS , 2 , 2 ) ;
+	double complex res[ NGAM*NGAM ] ;
+	if( dibaryon_contract_batch( res , SUM_r2[0] , CG , tCGt ,
+				     NGAM ) == FAILURE ) {
+	  error_code = FAILURE ;
+	}
+	const double complex sum = sum_gammas( res ) ;
 	M.in[0][ site ] = sum ;
       }
       
       // have to do wall-wall contraction on a single thread
       #pragma omp single
       {
-	register double complex sum = 0.0 ; 
-        sum +=   dibaryon_contract( M.SUM[0] , M.SUM[0] , M.GAMMAS , 0 , 0 ) ;
-	sum += 2*dibaryon_contract( M.SUM[0] , M.SUM[0] , M.GAMMAS , 0 , 1 ) ;
-        sum += 2*dibaryon_contract( M.SUM[0] , M.SUM[0] , M.GAMMAS , 0 , 2 ) ;
-	sum +=   dibaryon_contract( M.SUM[0] , M.SUM[0] , M.GAMMAS , 1 , 1 ) ;
-	sum += 2*dibaryon_contract( M.SUM[0] , M.SUM[0] , M.GAMMAS , 1 , 2 ) ;
-	sum +=   dibaryon_contract( M.SUM[0] , M.SUM[0] , M.GAMMAS , 2 , 2 ) ;
+	double complex res[ NGAM*NGAM ] ;
+	if( dibaryon_contract_batch( res , M.SUM[0] , CG , tCGt ,
+				     NGAM ) == FAILURE ) {
+	  error_code = FAILURE ;
+	}
+	const double complex sum = sum_gammas( res ) ;
 	M.wwcorr[0][0].mom[0].C[ tshifted ] = sum ;
       }
       
@@ -115,7 +157,7 @@ su2_dibaryon( struct propagator prop1 ,
 	copy_props( &M , Nprops ) ;
 	
 	// status of the computation
-	progress_bar( t , LT ) ;
+	progress_bar( tt , LT ) ;
       }
     }
   }
@@ -135,5 +177,6 @@ su2_dibaryon( struct propagator prop1 ,
   return error_code ;
 }
 
-// clean up the number of props
+// clean up the number of props and gammas
 #undef Nprops
+#undef NGAM
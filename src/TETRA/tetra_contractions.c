@@ -11,6 +11,7 @@
 #include "tetra_contractions.h" // alphabetising
 #include "penta_contractions.h" // idx()
 #include "Ospinor.h"            // spinor_to_Ospinor()
+#include "scratch.h"            // scratch_get()
 
 // block of possible gammas in the contraction
 struct tblock { 
@@ -300,6 +301,13 @@ precompute_block2( struct block *C1 ,
   return ;
 }
 
+// the two colour blocks tetras() draws from the scratch arena
+size_t
+tetras_scratch_bytes( void )
+{
+  return 2*scratch_size( NCNC*NCNC*sizeof( struct block ) ) ;
+}
+
 // perform the contraction of the tetraquark with appropriate mixing
 // has a block-symmetric structure of TETRA_NBLOCKxTETRA_NBLOCK matrices
 // Top Left is the Diquark - Diquark correlator 
@@ -366,16 +374,14 @@ tetras( double complex *result ,
   struct Ospinor ObwdH2 = spinor_to_Ospinor( bwdH2 ) ;
   struct Ospinor ObwdH2T = spinor_to_Ospinor( transpose_spinor( bwdH2 ) ) ;
 
-  // temporaries are 
+  // temporaries come from this thread's arena
   const size_t Nco = NCNC*NCNC ;
-  struct block *C1 = NULL , *C2 = NULL ;
-
-  // make everything a NaN if we fail to allocate memory
-  if( corr_malloc( (void**)&C1 , ALIGNMENT , Nco*sizeof( struct block ) ) != 0 || 
-      corr_malloc( (void**)&C2 , ALIGNMENT , Nco*sizeof( struct block ) ) != 0 ) {
-    free( C1 ) ; free( C2 ) ;
-    fprintf( stderr , "[MALLOC] failed to allocate C1/C2 temporaries" ) ;
-    return sqrt(-1) ;
+  const size_t mark = scratch_mark( ) ;
+  struct block *C1 = scratch_get( Nco*sizeof( struct block ) ) ;
+  struct block *C2 = scratch_get( Nco*sizeof( struct block ) ) ;
+  if( C1 == NULL || C2 == NULL ) {
+    scratch_release( mark ) ;
+    return FAILURE ;
   }
 
   // compute all the usual gamma structures needed				
@@ -460,7 +466,7 @@ tetras( double complex *result ,
     }
   }
 
-  free( C1 ) ; free( C2 ) ;
+  scratch_release( mark ) ;
 
   return SUCCESS ;
 }
@@ -13,6 +13,7 @@
 #include "io.h"                 // for read_prop()
 #include "progress_bar.h"       // progress_bar()
 #include "quark_smear.h"        // sink_smear()
+#include "scratch.h"            // scratch_reserve()
 #include "setup.h"              // init_measurements() ..
 #include "spinor_ops.h"         // sumprop()
 #include "tetra_contractions.h" // diquark_diquark()
@@ -48,23 +49,33 @@ tetraquark_usbb( struct propagator prop1 ,
     error_code = FAILURE ; goto memfree ;
   }
 
+  // each thread's colour blocks come from its arena
+  if( scratch_reserve( tetras_scratch_bytes( ) ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
   // read in the first timeslice
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
+
 #pragma omp parallel
   {
     // loop counters
-    size_t t = 0 ;
+    size_t tt = 0 ;
     
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
 
     // smear it if we wish
-    sink_smear( M.S , M.S1 , t , CUTINFO , Nprops ) ;
+    sink_smear( M.S , M.S1 , tstart , CUTINFO , Nprops ) ;
     
     {
        #pragma omp barrier
     }
     
     // Time slice loop 
-    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
       
       // if we are doing nonrel-chiral hadrons we switch chiral to nrel
       rotate_offdiag( M.S , prop , Nprops ) ;
@@ -81,9 +92,13 @@ tetraquark_usbb( struct propagator prop1 ,
       // strange memory access pattern threads better than what was here before
       size_t site ;
       // read on the master and one slave
-      if( t < LT-1 ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
+
+      // spatial sums by FFT convolution if that is cheaper
+      sum_spatial_conv( &M ) ;
+
       // Loop over spatial volume threads better
       #pragma omp for private(site) schedule(dynamic)
       for( site = 0 ; site < LCU ; site++ ) {
@@ -106,8 +121,10 @@ tetraquark_usbb( struct propagator prop1 ,
 	// loop gamma source
 	for( GSRC = 0 ; GSRC < stride2 ; GSRC++ ) {
 	  // perform contraction, result in result
-	  tetras( result , SUM_r2[0] , SUM_r2[1] , bwdH_r2 , bwdH_r2 ,
-		  M.GAMMAS , GSRC , GLU_FALSE , GLU_TRUE ) ;
+	  if( tetras( result , SUM_r2[0] , SUM_r2[1] , bwdH_r2 , bwdH_r2 ,
+		      M.GAMMAS , GSRC , GLU_FALSE , GLU_TRUE ) == FAILURE ) {
+	    error_code = FAILURE ;
+	  }
 	  // put contractions into flattend array for FFT
 	  for( op = 0 ; op < stride1 ; op++ ) {
 	    M.in[ GSRC + op * stride2 ][ site ] = result[ op ] ;
@@ -126,8 +143,10 @@ tetraquark_usbb( struct propagator prop1 ,
 	  result[ op ] = 0.0 ;
 	}
 	// perform contraction, result in result
-	tetras( result , M.SUM[0] , M.SUM[1] , SUMbwdH , SUMbwdH ,
-		M.GAMMAS , GSRC , GLU_FALSE , GLU_TRUE ) ;
+	if( tetras( result , M.SUM[0] , M.SUM[1] , SUMbwdH , SUMbwdH ,
+		    M.GAMMAS , GSRC , GLU_FALSE , GLU_TRUE ) == FAILURE ) {
+	  error_code = FAILURE ;
+	}
 	// put contractions into final correlator object
 	for( op = 0 ; op < stride1 ; op++ ) {
 	  M.wwcorr[ op ][ GSRC ].mom[ 0 ].C[ tshifted ] = result[ op ] ;
@@ -138,8 +157,8 @@ tetraquark_usbb( struct propagator prop1 ,
       compute_correlator( &M , stride1 , stride2 , tshifted ) ;
 
       // smear the forward prop
-      if( t < (LT-1) ) {
-	sink_smear( M.Sf , M.S1 , t+1 , CUTINFO , Nprops ) ;
+      if( tt < LT-1 ) {
+	sink_smear( M.Sf , M.S1 , (t+1)%LT , CUTINFO , Nprops ) ;
       }
       
       #pragma omp single
@@ -148,7 +167,7 @@ tetraquark_usbb( struct propagator prop1 ,
 	copy_props( &M , Nprops ) ;
 	
 	// status of the computation
-	progress_bar( t , LT ) ;
+	progress_bar( tt , LT ) ;
       }
     }
   }
@@ -14,6 +14,7 @@
 #include "tetra_udcb.h"       // light flavour degenerate heavy not
 #include "tetra_uscb.h"       // all non-degenerate
 #include "read_propheader.h"  // for read_propheader()
+#include "tetra_contractions.h" // tetras_scratch_bytes()
 
 //#define SU2_RHOETA
 #define HAL_RHORHO
@@ -103,6 +104,23 @@ contract_uscb( struct propagator *prop ,
 
 #endif
 
+// the scratch the contraction code picked out below draws per thread
+size_t
+tetra_scratch_bytes( void )
+{
+#if NC == 2
+  #if (defined SU2_RHOETA) || (defined HAL_RHORHO)
+  return 0 ;
+  #else
+  return su2_dibaryon_scratch_bytes( ) ;
+  #endif
+#elif NC == 3
+  return tetras_scratch_bytes( ) ;
+#else
+  return 0 ;
+#endif
+}
+
 // tetraquark calculator, prop3 should be the heavy one
 int
 contract_tetras( struct propagator *prop ,
@@ -122,7 +140,7 @@ contract_tetras( struct propagator *prop ,
     
     // check origins are the same and plaquettes are the same
     if( sanity_check_props( prop , tetras[ measurements ].map ,
-			    4 , "[TETRAS]" ) == FAILURE ) {
+			    4 , "[TETRAS]" , GLU_FALSE ) == FAILURE ) {
       return FAILURE ;
     }
 
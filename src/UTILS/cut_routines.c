@@ -492,6 +492,109 @@ DFT_mom_veclist( int *list_size ,
   return list ;
 }
 
+// sorted absolute values, the cubic-symmetry invariant of a momentum
+static void
+orbit_key( double key[ ND-1 ] ,
+	   const double MOM[ ND ] ,
+	   const double twist[ ND ] ,
+	   const size_t DIMS )
+{
+  size_t mu , nu ;
+  for( mu = 0 ; mu < DIMS ; mu++ ) {
+    const double k = fabs( MOM[ mu ] + twist[ mu ] ) ;
+    for( nu = mu ; nu > 0 && key[ nu-1 ] < k ; nu-- ) {
+      key[ nu ] = key[ nu-1 ] ;
+    }
+    key[ nu ] = k ;
+  }
+  return ;
+}
+
+// group a momentum list into cubic-symmetry orbits
+struct veclist*
+orbit_veclist( int *norbits ,
+	       size_t *omap ,
+	       size_t *ostart ,
+	       const struct veclist *list ,
+	       const int nmom ,
+	       const double twist[ ND ] ,
+	       const int DIMS )
+{
+  double (*keys)[ ND-1 ] = malloc( nmom * sizeof( double[ ND-1 ] ) ) ;
+  size_t *orbit = malloc( nmom * sizeof( size_t ) ) ;
+  size_t *first = malloc( nmom * sizeof( size_t ) ) ;
+  size_t p , o , mu , Norbits = 0 ;
+
+  // find the orbit each momentum belongs to
+  for( p = 0 ; p < (size_t)nmom ; p++ ) {
+    orbit_key( keys[p] , list[p].MOM , twist , DIMS ) ;
+    for( o = 0 ; o < Norbits ; o++ ) {
+      const double *key = keys[ first[o] ] ;
+      for( mu = 0 ; mu < (size_t)DIMS ; mu++ ) {
+	if( fabs( key[mu] - keys[p][mu] ) > NRQCD_TOL ) break ;
+      }
+      if( mu == (size_t)DIMS ) break ;
+    }
+    if( o == Norbits ) {
+      first[ Norbits++ ] = p ;
+    }
+    orbit[ p ] = o ;
+  }
+
+  // counting sort the list indices by orbit
+  for( o = 0 ; o <= Norbits ; o++ ) {
+    ostart[ o ] = 0 ;
+  }
+  for( p = 0 ; p < (size_t)nmom ; p++ ) {
+    ostart[ orbit[p] + 1 ]++ ;
+  }
+  for( o = 0 ; o < Norbits ; o++ ) {
+    ostart[ o + 1 ] += ostart[ o ] ;
+  }
+  for( p = 0 ; p < (size_t)nmom ; p++ ) {
+    omap[ ostart[ orbit[p] ]++ ] = p ;
+  }
+  for( o = Norbits ; o > 0 ; o-- ) {
+    ostart[ o ] = ostart[ o - 1 ] ;
+  }
+  ostart[ 0 ] = 0 ;
+
+  // the first member represents its orbit
+  struct veclist *olist = malloc( Norbits * sizeof( struct veclist ) ) ;
+  for( o = 0 ; o < Norbits ; o++ ) {
+    olist[ o ] = list[ first[o] ] ;
+    olist[ o ].idx = o ;
+  }
+  fprintf( stdout , "[CUTS] %d momenta averaged into %zu orbits\n" ,
+	   nmom , Norbits ) ;
+
+  free( keys ) ; free( orbit ) ; free( first ) ;
+
+  norbits[ 0 ] = (int)Norbits ;
+  return olist ;
+}
+
+// the explicit list of sink momenta from the input file
+struct veclist*
+sink_mom_veclist( int *list_size ,
+		  const struct cut_info CUTINFO ,
+		  const int DIMS )
+{
+  struct veclist *list = calloc( CUTINFO.Nsink_moms ,
+				 sizeof( struct veclist ) ) ;
+  size_t p , mu ;
+  for( p = 0 ; p < CUTINFO.Nsink_moms ; p++ ) {
+    list[ p ].idx = p ;
+    list[ p ].nsq = 0.0 ;
+    for( mu = 0 ; mu < (size_t)DIMS ; mu++ ) {
+      list[ p ].MOM[ mu ] = CUTINFO.sink_moms[ p ][ mu ] ;
+      list[ p ].nsq += list[p].MOM[mu] * list[p].MOM[mu] ;
+    }
+  }
+  list_size[ 0 ] = (int)CUTINFO.Nsink_moms ;
+  return list ;
+}
+
 // single wall-momentum
 struct veclist*
 wall_mom_veclist( int *list_size ,
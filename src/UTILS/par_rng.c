@@ -34,6 +34,25 @@
 // have we initialised the rng?
 static GLU_bool RNG_inited = GLU_FALSE ;
 
+// read a seed from the entropy pool
+static int
+urandom_seed( uint32_t *seed )
+{
+  FILE *urandom = fopen( "/dev/urandom" , "r" ) ;
+  if( urandom == NULL ) {
+    fprintf( stderr , "[RNG] /dev/urandom not opened!! ... Exiting \n" ) ;
+    return FAILURE ;
+  }
+  if( fread( seed , sizeof( uint32_t ) , 1 , urandom ) != 1 ) {
+    fprintf( stderr , "[RNG] Entropy pool Seed not read properly ! "
+	     "... Exiting \n" ) ;
+    fclose( urandom ) ;
+    return FAILURE ;
+  }
+  fclose( urandom ) ;
+  return SUCCESS ;
+}
+
 // seed the rng
 int
 initialise_par_rng( const char *rng_file ) 
@@ -49,22 +68,14 @@ initialise_par_rng( const char *rng_file )
 
       size_t i ;
       if( Latt.Seed == 0 ) {
-	FILE *urandom = fopen( "/dev/urandom" , "r" ) ;
-	if( urandom == NULL ) {
-	  fprintf( stderr , "[RNG] /dev/urandom not opened!! ... Exiting \n" ) ;
-	  return FAILURE ;
-	}
 	// read them from urandom
-	if( fread( &Seeds[0] , sizeof( uint32_t ) , 
-		   1 , urandom ) != 1 ) { 
-	  fprintf( stderr , "[RNG] Entropy pool Seed not read properly ! "
-		   "... Exiting \n" ) ; 
+	if( urandom_seed( &Seeds[0] ) == FAILURE ) {
+	  free( Seeds ) ;
 	  return FAILURE ;
 	}
 	for( i = 0 ; i < Latt.Nthreads ; i++ ) {
 	  Seeds[ i ] = Seeds[0] + i ;
 	}
-	fclose( urandom ) ;
 	// set global latt.seed
 	Latt.Seed = Seeds[0] ;
       } else {
@@ -260,3 +271,80 @@ Z2xZ2( const uint32_t thread )
 {
   return ( Z2( thread ) + I * Z2( thread ) ) / sqrt(2.) ;
 }
+
+// make sure we have a seed for the counter based generator, it is the
+// same one as the table uses
+int
+cb_rng_seed( void )
+{
+  if( Latt.Seed == 0 ) {
+    if( urandom_seed( &Latt.Seed ) == FAILURE ) {
+      return FAILURE ;
+    }
+    fprintf( stdout , "[PAR_RNG] Entropy read Seed %u\n" , Latt.Seed ) ;
+  }
+  return SUCCESS ;
+}
+
+// splitmix64 finaliser
+static inline uint64_t
+mix64( uint64_t z )
+{
+  z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL ;
+  z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL ;
+  return z ^ ( z >> 31 ) ;
+}
+
+// counter based generator, the number is a hash of its key so any
+// thread can make any of them in any order
+uint64_t
+cb_rng( const uint32_t seed ,
+	const size_t site ,
+	const size_t hit ,
+	const size_t spin ,
+	const size_t colour )
+{
+  const uint64_t golden = 0x9e3779b97f4a7c15ULL ;
+  uint64_t z = mix64( (uint64_t)seed + golden ) ;
+  z = mix64( z + ( (uint64_t)site + 1 )*golden ) ;
+  z = mix64( z + ( (uint64_t)hit + 1 )*golden ) ;
+  z = mix64( z + ( ( (uint64_t)spin << 32 | (uint64_t)colour ) + 1 )*golden ) ;
+  return z ;
+}
+
+// uniform double in [0,1) from the top 53 bits
+static inline double
+cb_dbl( const uint64_t r )
+{
+  return ( r >> 11 ) * ( 1.0 / 9007199254740992.0 ) ;
+}
+
+// element of Z2xZ2 from the lowest two bits
+double complex
+cb_Z2xZ2( const uint64_t r )
+{
+  return ( ( r & 1 ? -1 : +1 ) + I * ( r & 2 ? -1 : +1 ) ) / sqrt(2.) ;
+}
+
+// element of Z3
+double complex
+cb_Z3( const uint64_t r )
+{
+  const double res = cb_dbl( r ) ;
+  if( res > 1/3. ) {
+    if( res < 2/3. ) {
+      return -0.5 + I*0.8660254037844387 ;
+    } else {
+      return -0.5 - I*0.8660254037844387 ;
+    }
+  }
+  return 1 ;
+}
+
+// element of U1
+double complex
+cb_U1( const uint64_t r )
+{
+  const double phase = TWOPI * cb_dbl( r ) ;
+  return cos( phase ) + I*sin( phase ) ;
+}
@@ -4,7 +4,6 @@
  */
 #include "common.h"
 
-#include "geometry.h"       // compute_spacing()
 #include "grad_2.h"         // gradsq()
 #include "halfspinor_ops.h" // zero_halfspinor
 #include "spinor_ops.h"     // spinor_zero_site()
@@ -118,7 +117,7 @@ sink_smear( struct spinor **S ,
 void
 source_smear( struct halfspinor *S ,
 	      struct halfspinor *S1 ,
-	      const size_t t ,
+	      const double complex *Fmunu ,
 	      const struct source_info Source )
 {
   const double fac = Source.smalpha/Source.Nsmear ;
@@ -129,7 +128,7 @@ source_smear( struct halfspinor *S ,
     for( i = 0 ; i < LCU ; i++ ) {
       struct halfspinor der ;
       S1[i] = S[i] ;
-      gradsq( &der , S , i , t ) ;
+      gradsq( &der , S , Fmunu , i ) ;
       halfspinor_Saxpy( &S1[i] , der , fac ) ;
     }
     // set S = S1, S1 = S
@@ -143,6 +142,32 @@ source_smear( struct halfspinor *S ,
   return ;
 }
 
+// convolve each prop component with the r^2 mask, the spatial sum is the
+// inverse transform of FFT( S ) * FFT( mask ) which costs O( LCU log LCU )
+void
+sum_spatial_conv( const struct measurements *M )
+{
+#ifdef HAVE_FFTW3_H
+  if( M -> Sr2 == NULL ) return ;
+  const size_t ncomp = sizeof( struct spinor ) / sizeof( double complex ) ;
+  size_t idx ;
+  #pragma omp for private(idx) schedule(dynamic)
+  for( idx = 0 ; idx < M -> Nprops * ncomp ; idx++ ) {
+    const size_t n = idx / ncomp ;
+    const size_t c = idx % ncomp ;
+    double complex *in  = (double complex*)M -> S[n] + c ;
+    double complex *out = (double complex*)M -> Sr2[n] + c ;
+    fftw_execute_dft( M -> conv_forward , in , out ) ;
+    size_t k ;
+    for( k = 0 ; k < LCU ; k++ ) {
+      out[ k * ncomp ] *= M -> rmask[ k ] ;
+    }
+    fftw_execute_dft( M -> conv_backward , out , out ) ;
+  }
+#endif
+  return ;
+}
+
 // sum over spatial indices a spinor
 void
 sum_spatial_sep( struct spinor *SUM_r2 ,
@@ -150,6 +175,13 @@ sum_spatial_sep( struct spinor *SUM_r2 ,
 		 const size_t site1 )
 {
   size_t n , r ;
+  // already summed by sum_spatial_conv()
+  if( M.Sr2 != NULL ) {
+    for( n = 0 ; n < M.Nprops ; n++ ) {
+      SUM_r2[ n ] = M.Sr2[ n ][ site1 ] ;
+    }
+    return ;
+  }
 #if (defined __AVX__) && (ND==4)
   __m256d sum[M.Nprops][ 8*NCNC ] , *pt ; // spinor
   double *pB ;
@@ -169,9 +201,9 @@ sum_spatial_sep( struct spinor *SUM_r2 ,
     }
   }
   // sum over each spatial separation
+  const size_t *rsite = M.rtable + M.NR * site1 ;
   for( r = 0 ; r < (size_t)M.NR ; r++ ) {
-    const size_t site2 = compute_spacing( M.rlist[r].MOM ,
-					  site1 , ND-1 ) ;
+    const size_t site2 = rsite[ r ] ;
 
     for( n = 0 ; n < M.Nprops ; n++ ) {
       pB = (double*)M.S[n][site2].D ;
@@ -219,9 +251,9 @@ sum_spatial_sep( struct spinor *SUM_r2 ,
     spinor_zero_site( &SUM_r2[ n ] ) ;
   }
   // sum over each spatial separation
+  const size_t *rsite = M.rtable + M.NR * site1 ;
   for( r = 0 ; r < (size_t)M.NR ; r++ ) {
-    const size_t site2 = compute_spacing( M.rlist[r].MOM , site1 ,
-					  ND-1 ) ;
+    const size_t site2 = rsite[ r ] ;
     for( n = 0 ; n < M.Nprops ; n++ ) {
       add_spinors( &SUM_r2[n] , M.S[n][site2] ) ;
       // we could really be creative here and put all sorts of functions in.
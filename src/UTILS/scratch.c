@@ -0,0 +1,146 @@
+/**
+   @file scratch.c
+   @brief per-thread scratch arenas
+
+   Each thread gets one arena for the whole run which it touches
+   itself, contraction codes draw their temporaries from it with
+   scratch_get() and hand them back with scratch_release() rather than
+   going through the allocator inside the timeslice loop
+ */
+#include "common.h"
+
+#include "scratch.h"   // alphabetising
+
+// arenas are handed out in whole cache lines
+#define SCRATCH_ALIGN (64)
+
+// one per thread, padded so that the used counters do not share a line
+struct arena {
+  char *base ;
+  size_t used ;
+  char pad[ SCRATCH_ALIGN - sizeof( char* ) - sizeof( size_t ) ] ;
+} ;
+
+static struct arena *arenas = NULL ;
+static size_t narenas = 0 ;
+static size_t arena_bytes = 0 ;
+
+// round up to the next cache line
+size_t
+scratch_size( const size_t bytes )
+{
+  return ( ( bytes + SCRATCH_ALIGN - 1 ) / SCRATCH_ALIGN ) * SCRATCH_ALIGN ;
+}
+
+// free the arenas
+void
+free_scratch( void )
+{
+  size_t i ;
+  for( i = 0 ; i < narenas ; i++ ) {
+    if( arenas[i].base != NULL ) {
+      free( arenas[i].base ) ;
+    }
+  }
+  if( arenas != NULL ) {
+    free( arenas ) ;
+  }
+  arenas = NULL ;
+  narenas = arena_bytes = 0 ;
+  return ;
+}
+
+// allocate the arenas, each thread allocates and touches its own
+int
+init_scratch( const size_t bytes )
+{
+  free_scratch( ) ;
+
+  const size_t n = Latt.Nthreads > 0 ? (size_t)Latt.Nthreads : 1 ;
+  if( corr_malloc( (void**)&arenas , SCRATCH_ALIGN ,
+		   n*sizeof( struct arena ) ) != 0 ) {
+    fprintf( stderr , "[SCRATCH] arena table allocation failure\n" ) ;
+    arenas = NULL ;
+    return FAILURE ;
+  }
+  size_t i ;
+  for( i = 0 ; i < n ; i++ ) {
+    arenas[i].base = NULL ;
+    arenas[i].used = 0 ;
+  }
+  narenas = n ;
+  arena_bytes = scratch_size( bytes ) ;
+  if( arena_bytes == 0 ) return SUCCESS ;
+
+  // static,1 hands iteration i to thread i so the pages are local
+  int error_code = SUCCESS ;
+  #pragma omp parallel for private(i) schedule(static,1)
+  for( i = 0 ; i < n ; i++ ) {
+    if( corr_malloc( (void**)&arenas[i].base , SCRATCH_ALIGN ,
+		     arena_bytes ) != 0 ) {
+      arenas[i].base = NULL ;
+      error_code = FAILURE ;
+    } else {
+      memset( arenas[i].base , 0 , arena_bytes ) ;
+    }
+  }
+  if( error_code == FAILURE ) {
+    fprintf( stderr , "[SCRATCH] arena allocation failure\n" ) ;
+    free_scratch( ) ;
+    return FAILURE ;
+  }
+  fprintf( stdout , "[SCRATCH] %zu arena(s) of %zu bytes\n" , n , arena_bytes ) ;
+  return SUCCESS ;
+}
+
+// grow the arenas if they cannot hold bytes
+int
+scratch_reserve( const size_t bytes )
+{
+  if( arenas != NULL && scratch_size( bytes ) <= arena_bytes ) {
+    return SUCCESS ;
+  }
+  return init_scratch( bytes ) ;
+}
+
+// bump allocate from this thread's arena
+void *
+scratch_get( const size_t bytes )
+{
+  const size_t th = (size_t)get_CORR_thread( ) ;
+  if( th >= narenas ) {
+    fprintf( stderr , "[SCRATCH] no arena for thread %zu\n" , th ) ;
+    return NULL ;
+  }
+  struct arena *A = arenas + th ;
+  const size_t size = scratch_size( bytes ) ;
+  if( A -> base == NULL || A -> used + size > arena_bytes ) {
+    fprintf( stderr , "[SCRATCH] arena exhausted asking for %zu bytes "
+	     "(%zu of %zu in use)\n" , bytes , A -> used , arena_bytes ) ;
+    return NULL ;
+  }
+  void *ptr = A -> base + A -> used ;
+  A -> used += size ;
+  return ptr ;
+}
+
+// where this thread's arena is up to
+size_t
+scratch_mark( void )
+{
+  const size_t th = (size_t)get_CORR_thread( ) ;
+  return th < narenas ? arenas[ th ].used : 0 ;
+}
+
+// wind this thread's arena back to mark
+void
+scratch_release( const size_t mark )
+{
+  const size_t th = (size_t)get_CORR_thread( ) ;
+  if( th < narenas && mark <= arenas[ th ].used ) {
+    arenas[ th ].used = mark ;
+  }
+  return ;
+}
+
+#undef SCRATCH_ALIGN
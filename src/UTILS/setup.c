@@ -75,7 +75,11 @@ init_moms( struct measurements *M ,
 					       CUTINFO.configspace ) ;
   
   // if we are doing the Wall momentum DFT we allocate list differently
-  if( M -> is_dft ) {
+  if( M -> is_dft && CUTINFO.Nsink_moms > 0 ) {
+    M -> list = (struct veclist*)sink_mom_veclist( M -> nmom ,
+						   CUTINFO ,
+						   ND-1 ) ;
+  } else if( M -> is_dft ) {
     M -> list = (struct veclist*)DFT_mom_veclist( M -> nmom ,
 						  CUTINFO ,
 						  ND-1 ) ;
@@ -93,6 +97,24 @@ init_moms( struct measurements *M ,
 #endif
   }
 
+  // orbits the correlators are stored as, trivially the list itself
+  M -> omap   = malloc( M -> nmom[0] * sizeof( size_t ) ) ;
+  M -> ostart = malloc( ( M -> nmom[0] + 1 ) * sizeof( size_t ) ) ;
+  if( CUTINFO.momavg == GLU_TRUE ) {
+    M -> nolist = malloc( sizeof( int ) ) ;
+    M -> olist = orbit_veclist( M -> nolist , M -> omap , M -> ostart ,
+				M -> list , M -> nmom[0] ,
+				M -> sum_twist , ND-1 ) ;
+  } else {
+    size_t p ;
+    for( p = 0 ; p < (size_t)M -> nmom[0] ; p++ ) {
+      M -> omap[ p ] = M -> ostart[ p ] = p ;
+    }
+    M -> ostart[ p ] = p ;
+    M -> nolist = M -> nmom ;
+    M -> olist = M -> list ;
+  }
+
   // initialise spatial summation list
   const struct cut_info ORBITS = \
     { .type = CUTINFO.type ,
@@ -106,6 +128,82 @@ init_moms( struct measurements *M ,
 }
 
 
+// for large r-lists set up the FFT convolution used by sum_spatial_conv()
+static int
+init_sumr2_conv( struct measurements *M )
+{
+#ifdef HAVE_FFTW3_H
+  if( M -> NR <= (int)( SUMR2_CONV * log2( LCU ) ) ) {
+    return SUCCESS ;
+  }
+  fprintf( stdout , "[SUMR2] convolving %d offsets by FFT\n" , M -> NR ) ;
+
+  // the mask is one at each -r so that the convolution is sum_r S( x + r )
+  if( corr_malloc( (void**)&M -> rmask , ALIGNMENT , 
+		   LCU * sizeof( double complex ) ) != 0 ) {
+    return FAILURE ;
+  }
+  size_t i , mu ;
+  for( i = 0 ; i < LCU ; i++ ) {
+    M -> rmask[ i ] = 0.0 ;
+  }
+  for( i = 0 ; i < (size_t)M -> NR ; i++ ) {
+    int x[ ND ] ;
+    for( mu = 0 ; mu < ND-1 ; mu++ ) {
+      const int L = (int)Latt.dims[ mu ] ;
+      x[ mu ] = ( ( -M -> rlist[ i ].MOM[ mu ] ) % L + L ) % L ;
+    }
+    x[ ND-1 ] = 0 ;
+    M -> rmask[ gen_site( x ) ] += 1.0 / (double)LCU ;
+  }
+  fftw_plan mask_fwd , mask_bck ;
+  create_plans_strided( &mask_fwd , &mask_bck , M -> rmask , M -> rmask ,
+			1 , ND-1 ) ;
+  fftw_execute( mask_fwd ) ;
+  fftw_destroy_plan( mask_fwd ) ;
+  fftw_destroy_plan( mask_bck ) ;
+
+  // storage for the summed props
+  M -> Sr2 = malloc( M -> Nprops * sizeof( struct spinor* ) ) ;
+  for( i = 0 ; i < M -> Nprops ; i++ ) {
+    M -> Sr2[ i ] = NULL ;
+  }
+  for( i = 0 ; i < M -> Nprops ; i++ ) {
+    if( corr_malloc( (void**)&M -> Sr2[ i ] , ALIGNMENT , 
+		     LCU * sizeof( struct spinor ) ) != 0 ) {
+      return FAILURE ;
+    }
+  }
+  create_plans_strided( &M -> conv_forward , &M -> conv_backward ,
+			(double complex*)M -> S[0] , 
+			(double complex*)M -> Sr2[0] ,
+			sizeof( struct spinor ) / sizeof( double complex ) ,
+			ND-1 ) ;
+#endif
+  return SUCCESS ;
+}
+
+// table of the offset sites used by the direct summation in sum_spatial_sep()
+static int
+init_rtable( struct measurements *M )
+{
+  if( M -> Sr2 != NULL ) return SUCCESS ;
+  if( corr_malloc( (void**)&M -> rtable , ALIGNMENT , 
+		   LCU * M -> NR * sizeof( size_t ) ) != 0 ) {
+    return FAILURE ;
+  }
+  size_t site ;
+  #pragma omp parallel for private(site)
+  for( site = 0 ; site < LCU ; site++ ) {
+    size_t r ;
+    for( r = 0 ; r < (size_t)M -> NR ; r++ ) {
+      M -> rtable[ r + M -> NR * site ] = 
+	compute_spacing( M -> rlist[r].MOM , site , ND-1 ) ;
+    }
+  }
+  return SUCCESS ;
+}
+
 // do a time-slice wide copy of our propagators
 void
 copy_props( struct measurements *M , 
@@ -130,13 +228,30 @@ free_measurements( struct measurements *M ,
 		   const size_t flat_dirac )
 {
   // free correlators and momentum list
-  if( M -> nmom != NULL ) {
-    free_momcorrs( M -> corr , stride1 , stride2 , M -> nmom[0] ) ;
+  if( M -> nolist != NULL ) {
+    free_momcorrs( M -> corr , stride1 , stride2 , M -> nolist[0] ) ;
   }
   if( M -> wwnmom != NULL ) {
     free_momcorrs( M -> wwcorr , stride1 , stride2 , M -> wwnmom[0] ) ;
   }
 
+  // free the convolution
+  if( M -> Sr2 != NULL ) {
+    size_t n ;
+    for( n = 0 ; n < Nprops ; n++ ) {
+      free( M -> Sr2[ n ] ) ;
+    }
+    free( M -> Sr2 ) ;
+  }
+#ifdef HAVE_FFTW3_H
+  if( M -> conv_forward != NULL ) {
+    fftw_destroy_plan( M -> conv_forward ) ;
+    fftw_destroy_plan( M -> conv_backward ) ;
+  }
+#endif
+  free( M -> rmask ) ;
+  free( M -> rtable ) ;
+
   // free our ffts
   free_ffts( M->in , M->out , M->forward , M->backward , flat_dirac ) ;
 
@@ -149,6 +264,14 @@ free_measurements( struct measurements *M ,
     free( M -> dft_mom ) ;
   }
 
+  // free the orbits if they are not just the list
+  if( M -> nolist != M -> nmom ) {
+    free( M -> nolist ) ;
+    free( (void*)M -> olist ) ;
+  }
+  free( M -> omap ) ;
+  free( M -> ostart ) ;
+
   // free momenta lists
   if( M-> nmom != NULL ) {
     free( M->nmom ) ; 
@@ -210,14 +333,20 @@ init_measurements( struct measurements *M ,
 
   // nullify everything
   M -> nmom = NULL ; M -> wwnmom = NULL ;
+  M -> olist = NULL ; M -> nolist = NULL ;
+  M -> omap = NULL ; M -> ostart = NULL ;
   M -> list = NULL ; M -> wwlist = NULL ;
   M -> corr = NULL ; M -> wwcorr = NULL ;
-  M -> rlist = NULL ;
+  M -> rlist = NULL ; M -> rtable = NULL ;
   M -> GAMMAS = NULL ;
   M -> in = NULL ; M -> out = NULL ;
   M -> forward = NULL ; M -> backward = NULL ;
   M -> S = NULL ; M -> Sf = NULL ; M -> S1 = NULL ;
   M -> SUM = NULL ;
+  M -> Sr2 = NULL ; M -> rmask = NULL ;
+#ifdef HAVE_FFTW3_H
+  M -> conv_forward = M -> conv_backward = NULL ;
+#endif
   M -> dft_mom = NULL ;  
   M -> is_wall_mom = GLU_FALSE ;
   M -> is_dft = GLU_FALSE ;
@@ -262,7 +391,8 @@ init_measurements( struct measurements *M ,
   }
 
   // if we are doing the DFT rather than calling FFTW
-  if( CUTINFO.Nalphas > 0 ) {
+  if( CUTINFO.Nalphas > 0 || 
+      ( CUTINFO.Nsink_moms > 0 && CUTINFO.configspace == GLU_FALSE ) ) {
     M -> is_dft = GLU_TRUE ;
   }
   
@@ -335,8 +465,13 @@ init_measurements( struct measurements *M ,
     error_code = FAILURE ; goto end ;
   }
   
+  // FFT convolution for the spatial sums if it is cheaper
+  if( init_sumr2_conv( M ) == FAILURE || init_rtable( M ) == FAILURE ) {
+    error_code = FAILURE ; goto end ;
+  }
+
   // allocate correlators
-  M -> corr = allocate_momcorrs( stride1 , stride2 , M -> nmom[0] ) ;
+  M -> corr = allocate_momcorrs( stride1 , stride2 , M -> nolist[0] ) ;
   M -> wwcorr = allocate_momcorrs( stride1 , stride2 , M -> wwnmom[0] ) ;
 
   // allocate and precompute momentum factors
@@ -351,12 +486,16 @@ init_measurements( struct measurements *M ,
 		       LCU * sizeof( double complex ) ) != 0 ) {
 	error_code = FAILURE ;
       }
-      size_t site ;
-      for( site = 0 ; site < LCU ; site++ ) {
-	M -> dft_mom[p][site] = get_eipx( M -> list[p].MOM , site , ND-1 ) ;
-      }
     }
     if( error_code == FAILURE ) goto end ;
+    // phase table, one entry per listed momentum and site. Explicit
+    // sink momenta use the same e^{ipx} as the Nalphas DFT list
+    size_t idx ;
+    #pragma omp parallel for private(idx)
+    for( idx = 0 ; idx < M -> nmom[0] * LCU ; idx++ ) {
+      const size_t mom = idx / LCU , site = idx % LCU ;
+      M -> dft_mom[mom][site] = get_eipx( M -> list[mom].MOM , site , ND-1 ) ;
+    }
   }
 
   // precompute the gamma basis
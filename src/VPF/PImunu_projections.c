@@ -9,7 +9,59 @@
 #include "PImunu_projections.h" // alphabetising
 #include "WardIdentity.h"  // we compute the WI in momspace_data()
 
-// wrapper for the IO, WI checks and projections
+// transverse and longitudinal projections at a single momentum
+static void
+project_mom( double *trans ,
+	     double *longitudinal ,
+	     const struct PIdata *data ,
+	     const double *p ,
+	     const double psq )
+{
+  const double NORM = 1.0 / (double)( ND - 1 ) ;
+  const double spsq = ( psq == 0.0 ) ? 1.0 : 1.0 / psq ;
+  register double sumtrans = 0.0 , sumlong = 0.0 ;
+  size_t mu , nu ;
+  for( mu = 0 ; mu < ND ; mu++ ) {
+    for( nu = 0 ; nu < ND ; nu++ ) {
+      const double pmunu = p[mu] * p[nu] * spsq ;
+      const double fac = ( mu != nu ) ? -pmunu : 1.0 - pmunu ;
+      sumtrans += creal( data -> PI[mu][nu] ) * fac ;
+      sumlong  += creal( data -> PI[mu][nu] ) * -pmunu ;
+    }
+  }
+  *trans = sumtrans * ( spsq * NORM ) ;
+  *longitudinal = sumlong * spsq ;
+  return ;
+}
+
+// write out the projections, trans is overwritten with trans+long
+static void
+write_projections( double *trans ,
+		   const double *longitudinal ,
+		   const struct veclist *list ,
+		   const int *NMOM ,
+		   const char *outfile )
+{
+  char str[ 256 ] ;
+  sprintf( str , "%s.trans.bin" , outfile ) ;
+  write_momspace_data( str , NULL , NMOM , trans , list , ND ) ;
+
+  sprintf( str , "%s.long.bin" , outfile ) ;
+  write_momspace_data( str , NULL , NMOM , longitudinal , list , ND ) ;
+
+  size_t i ;
+#pragma omp parallel for private(i)
+  for( i = 0 ; i < (size_t)NMOM[0] ; i++ ) {
+    trans[ i ] = trans[ i ] + longitudinal[ i ] ;
+  }
+
+  sprintf( str , "%s.transPlong.bin" , outfile ) ;
+  write_momspace_data( str , NULL , NMOM , trans , list , ND ) ;
+  return ;
+}
+
+// wrapper for the IO, WI checks and projections, the WI correction,
+// the WI check and the projections are done in a single pass
 void
 momspace_data( struct PIdata *data ,
 	       const double **p ,
@@ -20,19 +72,7 @@ momspace_data( struct PIdata *data ,
 	       const current_type current ,
 	       const vector_axial VA ) 
 {
-  // perform WI correction if doing conserved currents
-  switch( current ) {
-  case CONSERVED_LOCAL :
-    correct_WI( data , CORR_MU , list , NMOM[0] ) ;
-    break ;
-  case LOCAL_LOCAL :
-    break ;
-  }
-
-  // tell us how much we violate the WI
-  compute_WI( data , (const double**)p , list , NMOM[0] ) ;
-  
-  // and perform the projection
+  // output file name
   char str[ 256 ] ;
   switch( VA ) {
   case VECTOR :
@@ -43,6 +83,10 @@ momspace_data( struct PIdata *data ,
     case LOCAL_LOCAL :
       sprintf( str , "%s.LVLV" , outfile ) ;
       break ;
+    case CL_AND_LL :
+      // the sweep hands us its currents one at a time
+      fprintf( stderr , "[VPF] momspace_data needs a single current\n" ) ;
+      return ;
     }
     break ;
   case AXIAL :
@@ -53,12 +97,40 @@ momspace_data( struct PIdata *data ,
     case LOCAL_LOCAL :
       sprintf( str , "%s.LALA" , outfile ) ;
       break ;
+    case CL_AND_LL :
+      // the sweep hands us its currents one at a time
+      fprintf( stderr , "[VPF] momspace_data needs a single current\n" ) ;
+      return ;
     }
     break ;
   }
 
-  // can we just use the other one?
-  projection( data , (const double**)p , psq , list , NMOM , str ) ;
+  double *trans = malloc( NMOM[0] * sizeof( double ) ) ;
+  double *longitudinal = malloc( NMOM[0] * sizeof( double ) ) ;
+
+  double sum = 0.0 , sum2 = 0.0 ;
+  size_t i ;
+#pragma omp parallel for private(i) reduction(+:sum) reduction(+:sum2)
+  for( i = 0 ; i < (size_t)NMOM[0] ; i++ ) {
+    struct PIdata *d = &data[ list[ i ].idx ] ;
+    // perform WI correction if doing conserved currents
+    if( current == CONSERVED_LOCAL ) {
+      correct_WI_mom( d , CORR_MU , list[ i ].MOM ) ;
+    }
+    // how much we violate the WI
+    WI_mom( &sum , &sum2 , d , p[i] ) ;
+    // and perform the projection
+    project_mom( &trans[i] , &longitudinal[i] , d , p[i] , psq[i] ) ;
+  }
+
+  // tell us how much we violate the WI
+  print_WI( sum , sum2 , (size_t)NMOM[0] ) ;
+
+  write_projections( trans , longitudinal , list , NMOM , str ) ;
+
+  // free the projected data
+  free( trans ) ;
+  free( longitudinal ) ;
 
   return ;
 }
@@ -74,42 +146,15 @@ projection( const struct PIdata *data ,
 {
   double *trans = malloc( NMOM[0] * sizeof( double ) ) ;
   double *longitudinal = malloc( NMOM[0] * sizeof( double ) ) ;
-  
-  const double NORM = 1.0 / (double)( ND - 1 ) ;
-  size_t i ;
-  //#pragma omp parallel for private(i)
-  for( i = 0 ; i < (size_t)NMOM[0] ; i++ ) {    
-    const size_t list_idx = (size_t)list[i].idx ;
-    const double spsq = ( psq[i] == 0.0 ) ? 1.0 : 1.0 / psq[i] ;
-    register double sumtrans = 0.0 , sumlong = 0.0 ;
-    size_t mu , nu ;
-    for( mu = 0 ; mu < ND ; mu++ ) {
-      for( nu = 0 ; nu < ND ; nu++ ) {
-	const double pmunu = p[i][mu] * p[i][nu] * spsq ;
-	const double fac = ( mu != nu ) ? -pmunu : 1.0 - pmunu ;
-	sumtrans += creal( data[list_idx].PI[mu][nu] ) * fac ;
-	sumlong  += creal( data[list_idx].PI[mu][nu] ) * -pmunu ;
-      }
-    }
-    trans[ i ] = sumtrans * ( spsq * NORM ) ;
-    longitudinal[ i ] = sumlong * spsq ;
-  }
-
-  // write out a file
-  char str[ 256 ] ;
-  sprintf( str , "%s.trans.bin" , outfile ) ;
-  write_momspace_data( str , NULL , NMOM , trans , list , ND ) ;
-
-  sprintf( str , "%s.long.bin" , outfile ) ;
-  write_momspace_data( str , NULL , NMOM , longitudinal , list , ND ) ;
 
+  size_t i ;
 #pragma omp parallel for private(i)
-  for( i = 0 ; i < (size_t)NMOM[0] ; i++ ) {
-    trans[ i ] = trans[ i ] + longitudinal[ i ] ;
+  for( i = 0 ; i < (size_t)NMOM[0] ; i++ ) {    
+    project_mom( &trans[i] , &longitudinal[i] ,
+		 &data[ list[i].idx ] , p[i] , psq[i] ) ;
   }
 
-  sprintf( str , "%s.transPlong.bin" , outfile ) ;
-  write_momspace_data( str , NULL , NMOM , trans , list , ND ) ;
+  write_projections( trans , longitudinal , list , NMOM , outfile ) ;
 
   // free the projected data
   free( trans ) ;
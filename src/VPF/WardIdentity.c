@@ -30,6 +30,40 @@ compute_p_psq( double **p ,
   return ;
 }
 
+// accumulate the WI violations of the data at a single momentum p
+void
+WI_mom( double *sum ,
+	double *sum2 ,
+	const struct PIdata *data ,
+	const double *p )
+{
+  register double complex loc_sum = 0.0 , loc_sum2 = 0.0 ;
+  size_t mu , nu ;
+  for( mu = 0 ; mu < ND ; mu++ ) {
+    for( nu = 0 ; nu < ND ; nu++ ) {
+      // compute ward identities
+      loc_sum  += p[mu] * data -> PI[mu][nu] ;
+      loc_sum2 += data -> PI[mu][nu] * p[nu] ;
+    }
+  }
+  *sum  += creal( loc_sum ) * creal( loc_sum ) + \
+           cimag( loc_sum ) * cimag( loc_sum ) ;
+  *sum2 += creal( loc_sum2 ) * creal( loc_sum2 ) + \
+           cimag( loc_sum2 ) * cimag( loc_sum2 ) ;
+  return ;
+}
+
+// print the accumulated WI violations
+void
+print_WI( const double sum ,
+	  const double sum2 ,
+	  const size_t NMOM )
+{
+  const double NORM = 1.0 / (double)( NMOM * ND ) ;
+  fprintf( stdout , "|| p_{mu} Pi_{mu,nu} || :: %e\n" , sum * NORM ) ;
+  fprintf( stdout , "|| PI_{mu,nu} p_{nu} || :: %e\n\n" , sum2 * NORM ) ;
+}
+
 // check the ward identity
 void
 compute_WI( const struct PIdata *data ,
@@ -42,30 +76,38 @@ compute_WI( const struct PIdata *data ,
   size_t i ;
 #pragma omp parallel for private(i) reduction(+:sum) reduction(+:sum2)
   for( i = 0 ; i < NMOM ; i++ ) {
-
     // we just look at the momenta we are keeping
-    const size_t list_idx = list[ i ].idx ;
+    WI_mom( &sum , &sum2 , &data[ list[ i ].idx ] , p[i] ) ;
+  }
+  print_WI( sum , sum2 , NMOM ) ;
+}
 
-    register double complex loc_sum = 0.0 , loc_sum2 = 0.0 ;
-    size_t mu , nu ;
-    for( mu = 0 ; mu < ND ; mu++ ) {
-      for( nu = 0 ; nu < ND ; nu++ ) {
-	// compute ward identities
-        loc_sum  += p[i][mu] * data[ list_idx ].PI[mu][nu] ;
-	loc_sum2 += data[ list_idx ].PI[mu][nu] * p[i][nu] ;
+// ward identity correction of the data at a single momentum
+void
+correct_WI_mom( struct PIdata *data ,
+		const correction_dir corr_dir ,
+		const double *MOM )
+{
+  // precompute correction factors
+  double complex epi[ ND ] ;
+  size_t mu , nu ;
+  for( mu = 0 ; mu < ND ; mu++ ) {
+    const double cache = 0.5 * MOM[ mu ] * Latt.twiddles[ mu ] ;
+    epi[ mu ] = cos( cache ) - I * sin( cache ) ;
+  }
+    
+  // loop directions
+  for( mu = 0 ; mu < ND ; mu++ ) {
+    for( nu = 0 ; nu < ND ; nu++ ) {
+      switch( corr_dir ) {
+      case CORR_MU : data -> PI[mu][nu] *= epi[ mu ] ; break ;
+      case CORR_NU : data -> PI[mu][nu] *= epi[ nu ] ; break ;
+      case CORR_MUpNU : data -> PI[mu][nu] *= epi[ mu ] * epi[ nu ] ; break ;
+      case UNCORR : break ;
       }
     }
-
-    sum  = sum  + creal( loc_sum ) * creal( loc_sum ) + \
-                  cimag( loc_sum ) * cimag( loc_sum ) ;
-    sum2 = sum2 + creal( loc_sum2 ) * creal( loc_sum2 ) + \
-                  cimag( loc_sum2 ) * cimag( loc_sum2 ) ;
-    // end of i loop
   }
-
-  const double NORM = 1.0 / (double)( NMOM * ND ) ;
-  fprintf( stdout , "|| p_{mu} Pi_{mu,nu} || :: %e\n" , sum * NORM ) ;
-  fprintf( stdout , "|| PI_{mu,nu} p_{nu} || :: %e\n\n" , sum2 * NORM ) ;
+  return ;
 }
 
 // perform ward identity correction
@@ -78,32 +120,35 @@ correct_WI( struct PIdata *data ,
   size_t i ;
 #pragma omp parallel for private(i)
   for( i = 0 ; i < NMOM ; i++ ) {
-
     // set the mapping from the momentum list
-    const size_t list_idx = list[ i ].idx ;
+    correct_WI_mom( &data[ list[ i ].idx ] , corr_dir , list[ i ].MOM ) ;
+  }
+  return ;
+}
 
-    // precompute correction factors
-    double complex epi[ ND ] ;
+// V( x ) - V( x - \mu ) over a timeslice, prev is the timeslice below
+// inside a parallel region each thread gets its share of the sum
+double
+WI_configspace_bwd_slice( const struct PIdata *data ,
+			  const struct PIdata *prev ,
+			  const struct site *lat )
+{
+  double sum = 0.0 ;
+  size_t x ;
+#pragma omp for private(x)
+  for( x = 0 ; x < LCU ; x++ ) {
+    register double complex der = 0.0 ;
     size_t mu , nu ;
-    for( mu = 0 ; mu < ND ; mu++ ) {
-      const double cache = 0.5 * list[ i ].MOM[ mu ] * Latt.twiddles[ mu ] ;
-      epi[ mu ] = cos( cache ) - I * sin( cache ) ;
-    }
-    
-    // loop directions
-    for( mu = 0 ; mu < ND ; mu++ ) {
-      for( nu = 0 ; nu < ND ; nu++ ) {
-	switch( corr_dir ) {
-	case CORR_MU : data[ list_idx ].PI[mu][nu] *= epi[ mu ] ; break ;
-	case CORR_NU : data[ list_idx ].PI[mu][nu] *= epi[ nu ] ; break ;
-	case CORR_MUpNU : data[ list_idx ].PI[mu][nu] *= epi[ mu ] * epi[ nu ] ; break ;
-	case UNCORR : break ;
-	}
+    for( nu = 0 ; nu < ND ; nu++ ) {
+      // spatial neighbours of x stay on the timeslice
+      for( mu = 0 ; mu < ND-1 ; mu++ ) {
+	der += data[ x ].PI[mu][nu] - data[ lat[x].back[mu] ].PI[mu][nu] ;
       }
+      der += data[ x ].PI[ND-1][nu] - prev[ x ].PI[ND-1][nu] ;
+      sum = sum + cabs( der ) ;
     }
-    //
   }
-  return ;
+  return sum ;
 }
 
 // computes V( x ) - V( x - \mu )
@@ -112,16 +157,13 @@ WI_configspace_bwd( const struct PIdata *data ,
 		    const struct site *lat )
 {
   double sum = 0.0 ;
-  size_t i ;
-#pragma omp parallel for private(i) reduction(+:sum) 
-  for( i = 0 ; i < LVOLUME ; i++ ) {
-    register double complex der = 0.0 ;
-    size_t mu , nu ;
-    for( nu = 0 ; nu < ND ; nu++ ) {
-      for( mu = 0 ; mu < ND ; mu++ ) {
-	der += data[ i ].PI[mu][nu] - data[ lat[i].back[mu] ].PI[mu][nu] ;
-      }
-      sum = sum + cabs( der ) ;
+#pragma omp parallel reduction(+:sum)
+  {
+    size_t t ;
+    for( t = 0 ; t < LT ; t++ ) {
+      sum += WI_configspace_bwd_slice( data + LCU*t ,
+				       data + LCU*( ( t + LT - 1 )%LT ) ,
+				       lat ) ;
     }
   }
   fprintf( stdout , "\n[VPF] backward config-space violation %e \n\n" , 
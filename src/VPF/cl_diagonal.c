@@ -12,23 +12,23 @@
 #include "gammas.h"            // gamma matrices
 #include "io.h"                // read_prop
 #include "matrix_ops.h"        // constant_mul_gauge
-#include "momspace_PImunu.h"   // momentum space VPF
 #include "progress_bar.h"      // progress_bar()
 #include "read_propheader.h"   // reread the header
-#include "tmoments_PImunu.h"   // time moments too
 #include "setup.h"             // general setup
 #include "spinor_ops.h"        // spinor_minus
-#include "WardIdentity.h"      // Config space WI
+#include "stream_PImunu.h"     // timeslice by timeslice VPF
 
 // number of propagators
 #define Nprops (2)
 
-// compute the conserved local for a correlator
-int
-cl_diagonal( struct propagator prop1 ,
-	     const struct site *lat ,
-	     const struct cut_info CUTINFO ,
-	     const char *outfile )
+// compute the conserved local for a correlator, and the local-local
+// from the same sweep if with_LL is set
+static int
+cl_diagonal_sweep( struct propagator prop1 ,
+		   const struct site *lat ,
+		   const struct cut_info CUTINFO ,
+		   const char *outfile ,
+		   const GLU_bool with_LL )
 {
   // counters
   const size_t stride1 = NS ;
@@ -43,13 +43,10 @@ cl_diagonal( struct propagator prop1 ,
   // need to look these up
   const size_t AGMAP[ ND ] = { AX , AY , AZ , AT } ;
 
-  // allocations for the PI-data
-  struct PIdata *DATA_AA = NULL ; 
-  struct PIdata *DATA_VV = NULL ; 
+  // PI-data a timeslice at a time, the members not named are zeroed,
+  // LL is only allocated if we do the local-local in the same sweep
+  struct PIstream PI = { .AA = NULL } , LL = { .AA = NULL } ;
 
-  // loop counters
-  size_t x , t = 0 ;
-  
   // error code
   int error_code = SUCCESS ;
 
@@ -64,107 +61,122 @@ cl_diagonal( struct propagator prop1 ,
     error_code = FAILURE ; goto memfree ;
   }
 
-  // over the whole volume is not as expensive as you may think
-  DATA_AA = calloc( LVOLUME , sizeof( struct PIdata ) ) ;
-  DATA_VV = calloc( LVOLUME , sizeof( struct PIdata ) ) ;
+  // we only keep the whole volume for the 4D momentum-space VPF
+  const GLU_bool full = ( CUTINFO.VPF_momspace == GLU_TRUE &&
+			  M.is_wall == GLU_FALSE ) ? GLU_TRUE : GLU_FALSE ;
+  if( init_PIstream( &PI , CONSERVED_LOCAL , full ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+  if( with_LL == GLU_TRUE &&
+      init_PIstream( &LL , LOCAL_LOCAL , full ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
+  // pointer ring of the timeslices t, t+1 and t+2, so the timeslice
+  // t+3 is read into the buffer t used and nothing gets copied
+  struct spinor *ring[ 3 ] = { M.S[0] , M.S[1] , M.Sf[0] } ;
+
+  // the timeslice above the final one is minus the first
+  struct spinor *wrap = M.Sf[1] ;
 
-  // Read first timeslice and the one above it
 #pragma omp parallel
   {
-    read_ahead( prop , M.S+0 , &error_code , 1 , t ) ;
-    read_ahead( prop , M.S+1 , &error_code , 1 , t+1 ) ;
-  }
-  if( error_code == FAILURE ) {
-    goto memfree ;
-  }
+    size_t t , x ;
 
-  // copy for the final timeslice
-#pragma omp parallel for private(x)
-  for( x = 0 ; x < LCU ; x++ ) {
-    equate_spinor_minus( &M.Sf[1][x] , &M.S[0][x] ) ;
-  }
+    // read first timeslice and the one above it
+    read_ahead( prop , ring + 0 , &error_code , 1 , 0 ) ;
+    read_ahead( prop , ring + 1 , &error_code , 1 , 1 ) ;
+
+    #pragma omp barrier
+
+    // copy for the final timeslice
+    #pragma omp for private(x)
+    for( x = 0 ; x < LCU ; x++ ) {
+      equate_spinor_minus( &wrap[x] , &ring[0][x] ) ;
+    }
+
+    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+
+      // multiple time source support
+      const size_t tshifted = ( t + LT - prop1.origin[ ND-1 ] ) % LT ;
+      struct PIdata *AA = PIstream_AA( &PI , tshifted ) ;
+      struct PIdata *VV = PIstream_VV( &PI , tshifted ) ;
+      struct PIdata *LLAA = NULL , *LLVV = NULL ;
+      if( with_LL == GLU_TRUE ) {
+	LLAA = PIstream_AA( &LL , tshifted ) ;
+	LLVV = PIstream_VV( &LL , tshifted ) ;
+      }
+      const struct spinor *S = ring[ t%3 ] ;
+      const struct spinor *SUP = ( t < LT-1 ) ? ring[ (t+1)%3 ] : wrap ;
 
-  // NB :
-  // this timeslice is in M.S[0]
-  // upper timeslice is in M.S[1]
-  // upper+1 timeslice is in M.Sf[0]
-  // final timeslice is in M.Sf[1]
-  for( t = 0 ; t < ( LT-1 ) ; t++ ) {
-
-    // multiple time source support
-    const size_t tshifted = ( t + LT - prop1.origin[ ND-1 ] ) % LT ;
-    
-    // parallel loop with an error flag
-    #pragma omp parallel
-    {
-      if( t < ( LT-2 ) ) {
-	read_ahead( prop , M.Sf , &error_code , 1 , t+1 ) ;
+      // master reads t+2 while the rest get on with the contractions
+      if( t < LT-2 ) {
+	read_ahead( prop , ring + (t+2)%3 , &error_code , 1 , t+2 ) ;
       }
       #pragma omp for private(x) schedule(dynamic)
       for( x = 0 ; x < LCU ; x++ ) {
-	// do the conserved-local contractions
-	contract_conserved_local_site( DATA_AA , DATA_VV , 
-				       lat , 
-				       M.S[0] , M.S[1] , 
-				       M.S[0] , M.S[1] ,
-				       M.GAMMAS , AGMAP , VGMAP , x , 
-				       tshifted ) ;
+	// do the conserved-local (and local-local) contractions
+	contract_cl_ll_site( AA , VV , LLAA , LLVV , lat , S , SUP , S , SUP ,
+			     M.GAMMAS , AGMAP , VGMAP , x , tshifted ) ;
       }
-    }
 
-    // leave if something went bad
-    if( error_code == FAILURE ) {
-      goto memfree ;
-    }
+      // time moments and WI of this timeslice
+      PIstream_accumulate( &PI , lat , tshifted ) ;
+      if( with_LL == GLU_TRUE ) {
+	PIstream_accumulate( &LL , lat , tshifted ) ;
+      }
 
-    #pragma omp parallel for private(x)
-    for( x = 0 ; x < LCU ; x++ ) {
-      // copy spinors over a timeslice
-      memcpy( &M.S[0][x] , &M.S[1][x] , sizeof( struct spinor ) ) ;
-      memcpy( &M.S[1][x] , &M.Sf[0][x] , sizeof( struct spinor ) ) ;
+      // status
+      #pragma omp single nowait
+      {
+	progress_bar( t , LT ) ;
+      }
     }
-
-    // status
-    progress_bar( t , LT ) ;
   }
 
-  // and contract the final timeslice
-#pragma omp parallel for private(x)
-  for( x = 0 ; x < LCU ; x++ ) {
-    contract_conserved_local_site( DATA_AA , DATA_VV , 
-				   lat , 
-				   M.S[0] , M.Sf[1] , 
-				   M.S[0] , M.Sf[1] , 
-				   M.GAMMAS , AGMAP , VGMAP , x , 
-				   ( t + LT - prop1.origin[ ND-1 ] ) % LT  ) ;
+  // leave if something went bad
+  if( error_code == FAILURE ) {
+    goto memfree ;
   }
-  progress_bar( t , LT ) ;
 
  memfree :
 
   // free our measurement struct
   free_measurements( &M , Nprops , stride1 , stride2 , flat_dirac ) ;
 
+  // WI, time moments and the momspace stuff away from the contractions
   if( error_code != FAILURE ) {
-
-    // derivatives delta_\mu V_\mu(x)
-    WI_configspace_bwd( DATA_VV , lat ) ;
-
-    // compute the time moments
-    tmoments( DATA_AA , DATA_VV , outfile , CONSERVED_LOCAL ) ;
-
-    // do all the momspace stuff away from the contractions
-    if( M.is_wall == GLU_FALSE ) { 
-      momspace_PImunu( DATA_AA , DATA_VV , CUTINFO , outfile ,
-		       CONSERVED_LOCAL ) ;
+    PIstream_finish( &PI , lat , CUTINFO , outfile , CONSERVED_LOCAL ) ;
+    if( with_LL == GLU_TRUE ) {
+      PIstream_finish( &LL , lat , CUTINFO , outfile , LOCAL_LOCAL ) ;
     }
   }
 
   // free the AA & VV data
-  free( DATA_AA ) ;
-  free( DATA_VV ) ;
+  free_PIstream( &PI ) ;
+  free_PIstream( &LL ) ;
 
   return error_code ;
 }
 
+// conserved-local only
+int
+cl_diagonal( struct propagator prop1 ,
+	     const struct site *lat ,
+	     const struct cut_info CUTINFO ,
+	     const char *outfile )
+{
+  return cl_diagonal_sweep( prop1 , lat , CUTINFO , outfile , GLU_FALSE ) ;
+}
+
+// conserved-local and local-local
+int
+cl_ll_diagonal( struct propagator prop1 ,
+		const struct site *lat ,
+		const struct cut_info CUTINFO ,
+		const char *outfile )
+{
+  return cl_diagonal_sweep( prop1 , lat , CUTINFO , outfile , GLU_TRUE ) ;
+}
+
 #undef Nprops
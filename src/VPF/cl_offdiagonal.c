@@ -9,24 +9,24 @@
 #include "gammas.h"            // gamma matrices
 #include "io.h"                // read_prop
 #include "matrix_ops.h"        // constant_mul_gauge
-#include "momspace_PImunu.h"   // momentum space VPF
 #include "progress_bar.h"      // progress_bar()
 #include "read_propheader.h"   // reread the header
-#include "tmoments_PImunu.h"   // time moments too
 #include "setup.h"             // init_measurements()
 #include "spinor_ops.h"        // spinor_minus
-#include "WardIdentity.h"      // Config space WI
+#include "stream_PImunu.h"     // timeslice by timeslice VPF
 
 // number of propagators
 #define Nprops (4)
 
-// compute the conserved local for a correlator
-int
-cl_offdiagonal( struct propagator prop1 ,
-		struct propagator prop2 ,
-		const struct site *lat ,
-		const struct cut_info CUTINFO ,
-		const char *outfile )
+// compute the conserved local for a correlator, and the local-local
+// from the same sweep if with_LL is set
+static int
+cl_offdiagonal_sweep( struct propagator prop1 ,
+		      struct propagator prop2 ,
+		      const struct site *lat ,
+		      const struct cut_info CUTINFO ,
+		      const char *outfile ,
+		      const GLU_bool with_LL )
 {
   // counters
   const size_t stride1 = NS ;
@@ -41,11 +41,9 @@ cl_offdiagonal( struct propagator prop1 ,
   // need to look these up
   const size_t AGMAP[ ND ] = { AX , AY , AZ , AT } ;
 
-  // finally our result
-  struct PIdata *DATA_AA = NULL , *DATA_VV = NULL ;
-
-  // loop counters
-  size_t x , t = 0 ;
+  // PI-data a timeslice at a time, the members not named are zeroed,
+  // LL is only allocated if we do the local-local in the same sweep
+  struct PIstream PI = { .AA = NULL } , LL = { .AA = NULL } ;
 
   // error code
   int error_code = SUCCESS ;
@@ -61,100 +59,103 @@ cl_offdiagonal( struct propagator prop1 ,
     error_code = FAILURE ; goto memfree ;
   }
 
-  // over the whole volume is not as expensive as you may think
-  DATA_AA = malloc( LVOLUME * sizeof( struct PIdata ) ) ;
-  DATA_VV = malloc( LVOLUME * sizeof( struct PIdata ) ) ;
-
-  // read the first couple of slices
-#pragma omp parallel
-  {
-    read_ahead( prop , M.S , &error_code , 2 , t ) ;
+  // we only keep the whole volume for the 4D momentum-space VPF
+  const GLU_bool full = ( CUTINFO.VPF_momspace == GLU_TRUE &&
+			  M.is_wall == GLU_FALSE ) ? GLU_TRUE : GLU_FALSE ;
+  if( init_PIstream( &PI , CONSERVED_LOCAL , full ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
   }
-  if( error_code == FAILURE ) {
-    goto memfree ;
+  if( with_LL == GLU_TRUE &&
+      init_PIstream( &LL , LOCAL_LOCAL , full ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
   }
 
-  // if we are doing nonrel-chiral mesons we switch chiral to nrel
-  rotate_offdiag( M.S, prop , 2 ) ;
+  // pointer ring of the timeslices t, t+1 and t+2 of prop1 and prop2,
+  // the timeslice t+3 is read into the buffers t used
+  struct spinor *ring[ 3 ][ 2 ] = { { M.S[0] , M.S[1] } ,
+				    { M.S[2] , M.S[3] } ,
+				    { M.Sf[0] , M.Sf[1] } } ;
+
+  // the timeslice above the final one is minus the first
+  struct spinor *wrap[ 2 ] = { M.Sf[2] , M.Sf[3] } ;
 
-  // read the first couple of slices
 #pragma omp parallel
   {
-    read_ahead( prop , M.S+2 , &error_code , 2 , t ) ;
-  }
-  if( error_code == FAILURE ) {
-    goto memfree ;
-  }
+    size_t t , x ;
 
-  // copy for the final timeslice
-#pragma omp parallel for private(x)
-  for( x = 0 ; x < LCU ; x++ ) {
-    equate_spinor_minus( &M.Sf[2][x] , &M.S[0][x] ) ;
-    equate_spinor_minus( &M.Sf[3][x] , &M.S[1][x] ) ;
-  }
+    // read the first couple of slices
+    read_ahead( prop , ring[0] , &error_code , 2 , 0 ) ;
+
+    // prop2 is read sequentially so its first slice has to be in
+    // before whichever thread takes the next single starts on it
+    #pragma omp barrier
 
-  // NB ::
-  // prop1 this timeslice = M.S[0] , prop1 next timeslice = M.S[2]
-  // next-next timeslice = M.Sf[0] , prop1 next timeslice = M.Sf[2]
+    read_ahead( prop , ring[1] , &error_code , 2 , 1 ) ;
 
-  // prop2 this timeslice = M.S[1] , prop2 next timeslice = M.S[3]
-  // next-next timeslice = M.Sf[1] , prop2 next timeslice = M.Sf[3]
-  // even is prop1 , odd is prop2
+    #pragma omp barrier
+
+    // if we are doing nonrel-chiral mesons we switch chiral to nrel
+    rotate_offdiag( ring[0] , prop , 2 ) ;
+
+    // copy for the final timeslice
+    #pragma omp for private(x)
+    for( x = 0 ; x < LCU ; x++ ) {
+      equate_spinor_minus( &wrap[0][x] , &ring[0][0][x] ) ;
+      equate_spinor_minus( &wrap[1][x] , &ring[0][1][x] ) ;
+    }
 
-  // loop the timeslices
-  for( t = 0 ; t < LT-1 ; t++ ) {
+    // NB ::
+    // prop1 this timeslice = S[0] , prop1 next timeslice = SUP[0]
+    // prop2 this timeslice = S[1] , prop2 next timeslice = SUP[1]
+    for( t = 0 ; t < LT && error_code == SUCCESS ; t++ ) {
+
+      // multiple time source support
+      const size_t tshifted = ( t + LT - prop1.origin[ ND-1 ] ) % LT ;
+      struct PIdata *AA = PIstream_AA( &PI , tshifted ) ;
+      struct PIdata *VV = PIstream_VV( &PI , tshifted ) ;
+      struct PIdata *LLAA = NULL , *LLVV = NULL ;
+      if( with_LL == GLU_TRUE ) {
+	LLAA = PIstream_AA( &LL , tshifted ) ;
+	LLVV = PIstream_VV( &LL , tshifted ) ;
+      }
+      struct spinor **S = ring[ t%3 ] ;
+      struct spinor **SUP = ( t < LT-1 ) ? ring[ (t+1)%3 ] : wrap ;
 
-    // multiple time source support
-    const size_t tshifted = ( t + LT - prop1.origin[ ND-1 ] ) % LT ;
+      // t+1 was read whilst we contracted t-1 so it is safe to rotate
+      if( t < LT-1 ) {
+	rotate_offdiag( SUP , prop , 2 ) ;
+      }
 
-    // parallel loop with an error flag
-    #pragma omp parallel
-    {
+      // master-slave the reads of t+2 and contract meanwhile
       if( t < LT-2 ) {
-	read_ahead( prop , M.Sf , &error_code , 2 , t+1 ) ;
-	rotate_offdiag( M.Sf , prop , 2 ) ;
+	read_ahead( prop , ring[ (t+2)%3 ] , &error_code , 2 , t+2 ) ;
       }
       #pragma omp for private(x) schedule(dynamic)
       for( x = 0 ; x < LCU ; x++ ) {
-	// do the conserved-local contractions
-	contract_conserved_local_site( DATA_AA , DATA_VV , 
-				       lat , 
-				       M.S[0] , M.S[2] , 
-				       M.S[1] , M.S[3] ,
-				       M.GAMMAS , AGMAP , VGMAP , x , 
-				       tshifted ) ;
+	// do the conserved-local (and local-local) contractions
+	contract_cl_ll_site( AA , VV , LLAA , LLVV , lat , 
+			     S[0] , SUP[0] , S[1] , SUP[1] ,
+			     M.GAMMAS , AGMAP , VGMAP , x , tshifted ) ;
       }
-    }
 
-    // to err is human
-    if( error_code == FAILURE ) {
-      goto memfree ;
-    }
+      // time moments and WI of this timeslice
+      PIstream_accumulate( &PI , lat , tshifted ) ;
+      if( with_LL == GLU_TRUE ) {
+	PIstream_accumulate( &LL , lat , tshifted ) ;
+      }
 
-    #pragma omp parallel for private(x)
-    for( x = 0 ; x < LCU ; x++ ) {
-      // copy spinors over a timeslice
-      memcpy( &M.S[0][x] , &M.S[2][x] , sizeof( struct spinor ) ) ;
-      memcpy( &M.S[1][x] , &M.S[3][x] , sizeof( struct spinor ) ) ;
-      memcpy( &M.S[2][x] , &M.Sf[0][x] , sizeof( struct spinor ) ) ;
-      memcpy( &M.S[3][x] , &M.Sf[1][x] , sizeof( struct spinor ) ) ;
+      // status
+      #pragma omp single nowait
+      {
+	progress_bar( t , LT ) ;
+      }
     }
-
-    // status
-    progress_bar( t , LT ) ;
   }
 
-  // and contract the final timeslice
-#pragma omp for private(x)
-  for( x = 0 ; x < LCU ; x++ ) {
-    contract_conserved_local_site( DATA_AA , DATA_VV , 
-				   lat , 
-				   M.S[0] , M.Sf[2] , 
-				   M.S[1] , M.Sf[3] ,
-				   M.GAMMAS , AGMAP , VGMAP , x , 
-				   ( t + LT - prop1.origin[ ND-1 ] ) % LT ) ;
+  // to err is human
+  if( error_code == FAILURE ) {
+    goto memfree ;
   }
-  progress_bar( t , LT ) ;
 
   // free some memory
  memfree :
@@ -162,26 +163,44 @@ cl_offdiagonal( struct propagator prop1 ,
   // free our measurement struct
   free_measurements( &M , Nprops , stride1 , stride2 , flat_dirac ) ;
 
+  // WI, time moments and the momspace stuff away from the contractions
   if( error_code != FAILURE ) {
-    // derivatives delta_\mu V_\mu(x)
-    WI_configspace_bwd( DATA_VV , lat ) ;
-    
-    // time moments are interesting also
-    tmoments( DATA_AA , DATA_VV , outfile , CONSERVED_LOCAL ) ;
-    
-    // do all the momspace stuff away from the contractions
-    if( M.is_wall == GLU_FALSE ) { 
-      momspace_PImunu( DATA_AA , DATA_VV , CUTINFO , outfile ,
-		       CONSERVED_LOCAL ) ;
+    PIstream_finish( &PI , lat , CUTINFO , outfile , CONSERVED_LOCAL ) ;
+    if( with_LL == GLU_TRUE ) {
+      PIstream_finish( &LL , lat , CUTINFO , outfile , LOCAL_LOCAL ) ;
     }
   }
 
   // free the AA & VV data
-  free( DATA_AA ) ;
-  free( DATA_VV ) ;
+  free_PIstream( &PI ) ;
+  free_PIstream( &LL ) ;
 
   return error_code ;
 }
 
+// conserved-local only
+int
+cl_offdiagonal( struct propagator prop1 ,
+		struct propagator prop2 ,
+		const struct site *lat ,
+		const struct cut_info CUTINFO ,
+		const char *outfile )
+{
+  return cl_offdiagonal_sweep( prop1 , prop2 , lat , CUTINFO , outfile ,
+			       GLU_FALSE ) ;
+}
+
+// conserved-local and local-local
+int
+cl_ll_offdiagonal( struct propagator prop1 ,
+		   struct propagator prop2 ,
+		   const struct site *lat ,
+		   const struct cut_info CUTINFO ,
+		   const char *outfile )
+{
+  return cl_offdiagonal_sweep( prop1 , prop2 , lat , CUTINFO , outfile ,
+			       GLU_TRUE ) ;
+}
+
 // clean up the number of props
 #undef Nprops
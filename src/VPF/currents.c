@@ -59,20 +59,23 @@ CL_munu_VV( const struct spinor US1xpmu ,  // U S_1( x + \mu )
 	    ) ;
 }
 
-// man this has a lot of arguments -> TODO :: reduce these somehow
-void
-contract_conserved_local_site( struct PIdata *DATA_AA ,
-			       struct PIdata *DATA_VV ,
-			       const struct site *lat ,
-			       const struct spinor *S1 ,
-			       const struct spinor *S1UP ,
-			       const struct spinor *S2 ,
-			       const struct spinor *S2UP ,
-			       const struct gamma *GAMMAS ,
-			       const size_t AGMAP[ ND ] ,
-			       const size_t VGMAP[ ND ] ,
-			       const size_t x ,
-			       const size_t t ) 
+// conserved-local at x and, if LL_AA and LL_VV are not NULL, the
+// local-local from the same on-site spinors
+static void
+cl_ll_site( struct PIdata *CL_AA ,
+	    struct PIdata *CL_VV ,
+	    struct PIdata *LL_AA ,
+	    struct PIdata *LL_VV ,
+	    const struct site *lat ,
+	    const struct spinor *S1 ,
+	    const struct spinor *S1UP ,
+	    const struct spinor *S2 ,
+	    const struct spinor *S2UP ,
+	    const struct gamma *GAMMAS ,
+	    const size_t AGMAP[ ND ] ,
+	    const size_t VGMAP[ ND ] ,
+	    const size_t x ,
+	    const size_t t ) 
 {
   struct spinor US1xpmu , UdS1x , S2xpmu ; // temporary storage for the gauge-multiplied
   const size_t i = x + LCU * t ;
@@ -94,21 +97,72 @@ contract_conserved_local_site( struct PIdata *DATA_AA ,
     for( nu = 0 ; nu < ND ; nu++ ) {
 
       // I need to think about the axial
-      DATA_AA[i].PI[mu][nu] = CL_munu_AA( US1xpmu , UdS1x , 
-					  S2xpmu , S2[ x ] , 
-					  GAMMAS , 
-					  AGMAP[ mu ] , AGMAP[ nu ] ) ;
+      CL_AA[x].PI[mu][nu] = CL_munu_AA( US1xpmu , UdS1x , 
+					S2xpmu , S2[ x ] , 
+					GAMMAS , 
+					AGMAP[ mu ] , AGMAP[ nu ] ) ;
 	
       // vectors 
-      DATA_VV[i].PI[mu][nu] = -CL_munu_VV( US1xpmu , UdS1x , 
-					   S2xpmu , S2[ x ] ,
-					   GAMMAS ,
-					   VGMAP[ mu ] , VGMAP[ nu ] ) ;
-      //
+      CL_VV[x].PI[mu][nu] = -CL_munu_VV( US1xpmu , UdS1x , 
+					 S2xpmu , S2[ x ] ,
+					 GAMMAS ,
+					 VGMAP[ mu ] , VGMAP[ nu ] ) ;
+
+      // local-local whilst S1[x] and S2[x] are in cache
+      if( LL_AA != NULL ) {
+	LL_AA[x].PI[mu][nu] =						\
+	  meson_contract( GAMMAS[ AGMAP[ nu ] ] , S2[ x ] , 
+			  GAMMAS[ AGMAP[ mu ] ] , S1[ x ] ,
+			  GAMMAS[ GAMMA_5 ] ) ;
+	LL_VV[x].PI[mu][nu] =						\
+	  meson_contract( GAMMAS[ VGMAP[ nu ] ] , S2[ x ] , 
+			  GAMMAS[ VGMAP[ mu ] ] , S1[ x ] ,
+			  GAMMAS[ GAMMA_5 ] ) ;
+      }
     }
   }
-  //exit(1) ;
+  return ;
+}
 
+// man this has a lot of arguments -> TODO :: reduce these somehow
+void
+contract_conserved_local_site( struct PIdata *DATA_AA ,
+			       struct PIdata *DATA_VV ,
+			       const struct site *lat ,
+			       const struct spinor *S1 ,
+			       const struct spinor *S1UP ,
+			       const struct spinor *S2 ,
+			       const struct spinor *S2UP ,
+			       const struct gamma *GAMMAS ,
+			       const size_t AGMAP[ ND ] ,
+			       const size_t VGMAP[ ND ] ,
+			       const size_t x ,
+			       const size_t t ) 
+{
+  cl_ll_site( DATA_AA , DATA_VV , NULL , NULL , lat ,
+	      S1 , S1UP , S2 , S2UP , GAMMAS , AGMAP , VGMAP , x , t ) ;
+  return ;
+}
+
+// conserved-local and local-local in one go
+void
+contract_cl_ll_site( struct PIdata *CL_AA ,
+		     struct PIdata *CL_VV ,
+		     struct PIdata *LL_AA ,
+		     struct PIdata *LL_VV ,
+		     const struct site *lat ,
+		     const struct spinor *S1 ,
+		     const struct spinor *S1UP ,
+		     const struct spinor *S2 ,
+		     const struct spinor *S2UP ,
+		     const struct gamma *GAMMAS ,
+		     const size_t AGMAP[ ND ] ,
+		     const size_t VGMAP[ ND ] ,
+		     const size_t x ,
+		     const size_t t ) 
+{
+  cl_ll_site( CL_AA , CL_VV , LL_AA , LL_VV , lat ,
+	      S1 , S1UP , S2 , S2UP , GAMMAS , AGMAP , VGMAP , x , t ) ;
   return ;
 }
 
@@ -121,20 +175,18 @@ contract_local_local_site( struct PIdata *DATA_AA ,
 			   const struct gamma *GAMMAS ,
 			   const size_t AGMAP[ ND ] ,
 			   const size_t VGMAP[ ND ] ,
-			   const size_t x ,
-			   const size_t t ) 
+			   const size_t x ) 
 {
-  const size_t i = x + LCU * t ;
   size_t munu ;
   for( munu = 0 ; munu < ND*ND ; munu++ ) {
     const size_t mu = munu / ND ;
     const size_t nu = munu % ND ;
-    DATA_AA[i].PI[mu][nu] =				\
+    DATA_AA[x].PI[mu][nu] =				\
       meson_contract( GAMMAS[ AGMAP[ nu ] ] , S2[ x ] , 
 		      GAMMAS[ AGMAP[ mu ] ] , S1[ x ] ,
 		      GAMMAS[ GAMMA_5 ] ) ;
     
-    DATA_VV[i].PI[mu][nu] =				\
+    DATA_VV[x].PI[mu][nu] =				\
       meson_contract( GAMMAS[ VGMAP[ nu ] ] , S2[ x ] , 
 		      GAMMAS[ VGMAP[ mu ] ] , S1[ x ] ,
 		      GAMMAS[ GAMMA_5 ] ) ;
@@ -10,10 +10,9 @@
 #include "gammas.h"            // gamma matrices
 #include "io.h"                // read_prop
 #include "matrix_ops.h"        // constant_mul_gauge
-#include "momspace_PImunu.h"   // momentum space VPF
 #include "progress_bar.h"      // progress_bar()
-#include "tmoments_PImunu.h"   // time moments calculations
 #include "setup.h"             // initialising and stuff
+#include "stream_PImunu.h"     // timeslice by timeslice VPF
 
 #include "geometry.h"
 
@@ -41,13 +40,13 @@ ll_diagonal( struct propagator prop1 ,
   const size_t flat_dirac = stride1 * stride2 ;
 
   // loop counters
-  size_t t = 0 , x ;
+  size_t tt , x ;
 
   // error code
   int error_code = SUCCESS ;
 
-  // over the whole volume is not as expensive as you may think
-  struct PIdata *DATA_AA = NULL , *DATA_VV = NULL ;
+  // PI-data a timeslice at a time, the members not named are zeroed
+  struct PIstream PI = { .AA = NULL } ;
 
   // initialise our measurement struct
   struct propagator prop[ Nprops ] = { prop1 } ;
@@ -59,36 +58,45 @@ ll_diagonal( struct propagator prop1 ,
     error_code = FAILURE ; goto memfree ;
   }
 
-  // over the whole volume is not as expensive as you may think
-  DATA_AA = malloc( LVOLUME * sizeof( struct PIdata ) ) ;
-  DATA_VV = malloc( LVOLUME * sizeof( struct PIdata ) ) ;
+  // we only keep the whole volume for the 4D momentum-space VPF
+  const GLU_bool full = ( CUTINFO.VPF_momspace == GLU_TRUE &&
+			  M.is_wall == GLU_FALSE ) ? GLU_TRUE : GLU_FALSE ;
+  if( init_PIstream( &PI , LOCAL_LOCAL , full ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
 
   // initially read a timeslice
 #pragma omp parallel
   {
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
   }
   if( error_code == FAILURE ) {
     goto memfree ;
   }
 
   // loop the timeslices
-  for( t = 0 ; t < LT ; t++ ) {
+  for( tt = 0 ; tt < LT ; tt++ ) {
+    // physical timeslice, wraps round from tstart
+    const size_t t = ( tt + tstart ) % LT ;
 
     // multiple time source support
     const size_t tshifted = ( t + LT - prop1.origin[ ND-1 ] ) % LT ;
+    struct PIdata *AA = PIstream_AA( &PI , tshifted ) ;
+    struct PIdata *VV = PIstream_VV( &PI , tshifted ) ;
 
     // do the conserved-local contractions
     #pragma omp parallel
     {
-      if( t < LT-1 ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
       #pragma omp for private(x)
       for( x = 0 ; x < LCU ; x++ ) {
-	contract_local_local_site( DATA_AA , DATA_VV , M.S[0] , M.S[0] , 
-				   M.GAMMAS , AGMAP , VGMAP , x , 
-				   tshifted ) ;
+	contract_local_local_site( AA , VV , M.S[0] , M.S[0] , 
+				   M.GAMMAS , AGMAP , VGMAP , x ) ;
       }
     }
 
@@ -97,6 +105,9 @@ ll_diagonal( struct propagator prop1 ,
       goto memfree ;
     }
 
+    // time moments of this timeslice
+    PIstream_accumulate( &PI , lat , tshifted ) ;
+
     // copy over
     #pragma omp parallel for private(x)
     for( x = 0 ; x < LCU ; x++ ) {
@@ -104,7 +115,7 @@ ll_diagonal( struct propagator prop1 ,
     }
 
     // status
-    progress_bar( t , LT ) ;
+    progress_bar( tt , LT ) ;
   }
 
  memfree :
@@ -112,20 +123,13 @@ ll_diagonal( struct propagator prop1 ,
   // free our measurement struct
   free_measurements( &M , Nprops , stride1 , stride2 , flat_dirac ) ;
 
+  // time moments and the momspace stuff away from the contractions
   if( error_code != FAILURE ) {
-    // temporal data too
-    tmoments( DATA_AA , DATA_VV , outfile , LOCAL_LOCAL ) ;
-    
-    // do all the momspace stuff away from the contractions
-    if( M.is_wall == GLU_FALSE ) {
-      momspace_PImunu( DATA_AA , DATA_VV , CUTINFO , outfile ,
-		       LOCAL_LOCAL ) ;
-    }
+    PIstream_finish( &PI , lat , CUTINFO , outfile , LOCAL_LOCAL ) ;
   }
 
   // free the AA & VV data
-  free( DATA_AA ) ;
-  free( DATA_VV ) ;
+  free_PIstream( &PI ) ;
 
   return error_code ;
 }
@@ -9,10 +9,9 @@
 #include "gammas.h"            // gamma matrices
 #include "io.h"                // read_prop
 #include "matrix_ops.h"        // constant_mul_gauge
-#include "momspace_PImunu.h"   // momentum space VPF
 #include "progress_bar.h"      // progress_bar()
-#include "tmoments_PImunu.h"   // time moments calculations
 #include "setup.h"             // init_measurements()
+#include "stream_PImunu.h"     // timeslice by timeslice VPF
 
 // number of propagators
 #define Nprops (2)
@@ -39,13 +38,13 @@ ll_offdiagonal( struct propagator prop1 ,
   const size_t flat_dirac = stride1 * stride2 ;
 
   // loop counters
-  size_t x , t = 0 ;
+  size_t x , tt ;
 
   // error code
   int error_code = SUCCESS ;
 
-  // over the whole volume is not as expensive as you may think
-  struct PIdata *DATA_AA = NULL , *DATA_VV = NULL ;
+  // PI-data a timeslice at a time, the members not named are zeroed
+  struct PIstream PI = { .AA = NULL } ;
 
   // initialise our measurement struct
   struct propagator prop[ Nprops ] = { prop1 , prop2 } ;
@@ -57,41 +56,50 @@ ll_offdiagonal( struct propagator prop1 ,
     error_code = FAILURE ; goto memfree ;
   }
  
-  // over the whole volume is not as expensive as you may think
-  DATA_AA = malloc( LVOLUME * sizeof( struct PIdata ) ) ;
-  DATA_VV = malloc( LVOLUME * sizeof( struct PIdata ) ) ;
+  // we only keep the whole volume for the 4D momentum-space VPF
+  const GLU_bool full = ( CUTINFO.VPF_momspace == GLU_TRUE &&
+			  M.is_wall == GLU_FALSE ) ? GLU_TRUE : GLU_FALSE ;
+  if( init_PIstream( &PI , LOCAL_LOCAL , full ) == FAILURE ) {
+    error_code = FAILURE ; goto memfree ;
+  }
+
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
 
   // initially read a timeslice
 #pragma omp parallel
   {
-    read_ahead( prop , M.S , &error_code , Nprops , t ) ;
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
   }
   if( error_code == FAILURE ) {
     goto memfree ;
   }
 
   // loop the timeslices
-  for( t = 0 ; t < LT ; t++ ) {
+  for( tt = 0 ; tt < LT ; tt++ ) {
+    // physical timeslice, wraps round from tstart
+    const size_t t = ( tt + tstart ) % LT ;
 
     // rotate if we must
     rotate_offdiag( M.S , prop , Nprops ) ;
 
     // multiple time source support
     const size_t tshifted = ( t + LT - prop1.origin[ ND-1 ] ) % LT ;
+    struct PIdata *AA = PIstream_AA( &PI , tshifted ) ;
+    struct PIdata *VV = PIstream_VV( &PI , tshifted ) ;
 
     // do the conserved-local contractions
     #pragma omp parallel
     {
-      if( t < LT-1 ) {
-	read_ahead( prop , M.Sf , &error_code , Nprops , t+1 ) ;
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
       }
       // loop spatial volume
       #pragma omp for private(x)
       for( x = 0 ; x < LCU ; x++ ) {
-	contract_local_local_site( DATA_AA , DATA_VV , 
+	contract_local_local_site( AA , VV , 
 				   M.S[0] , M.S[1] , 
-				   M.GAMMAS , AGMAP , VGMAP , x , 
-				   tshifted ) ;
+				   M.GAMMAS , AGMAP , VGMAP , x ) ;
       }
     }
 
@@ -100,6 +108,9 @@ ll_offdiagonal( struct propagator prop1 ,
       goto memfree ;
     }
 
+    // time moments of this timeslice
+    PIstream_accumulate( &PI , lat , tshifted ) ;
+
     // copy over
     #pragma omp parallel for private(x)
     for( x = 0 ; x < LCU ; x++ ) {
@@ -108,7 +119,7 @@ ll_offdiagonal( struct propagator prop1 ,
     }
 
     // status
-    progress_bar( t , LT ) ;
+    progress_bar( tt , LT ) ;
   }
 
   // deallocs
@@ -117,19 +128,13 @@ ll_offdiagonal( struct propagator prop1 ,
   // free our measurement struct
   free_measurements( &M , Nprops , stride1 , stride2 , flat_dirac ) ;
 
+  // time moments and the momspace stuff away from the contractions
   if( error_code != FAILURE ) {
-    // temporal data too
-    tmoments( DATA_AA , DATA_VV , outfile , LOCAL_LOCAL ) ;
-    
-    // do all the momspace stuff away from the contractions
-    if( M.is_wall == GLU_FALSE ) {
-      momspace_PImunu( DATA_AA , DATA_VV , CUTINFO , outfile ,
-		       LOCAL_LOCAL ) ;
-    }
+    PIstream_finish( &PI , lat , CUTINFO , outfile , LOCAL_LOCAL ) ;
   }
 
-  free( DATA_AA ) ;
-  free( DATA_VV ) ;
+  // free the AA & VV data
+  free_PIstream( &PI ) ;
 
   return error_code ;
 }
@@ -10,35 +10,26 @@
 #include "PImunu_projections.h" // projection codes
 #include "WardIdentity.h"       // compute_psq
 
-// FFT our mu,nu data
+// FFT all 2*ND*ND of the mu,nu components of AA and VV in place, the
+// plan is for one component of the array of structs and we run
+// the components over the threads
 #ifdef HAVE_FFTW3_H
 static void
-FFT_PImunu( struct PIdata *DATA ,
-	    double complex *in , 
-	    double complex *out ,
-	    const fftw_plan forward ,
-	    const fftw_plan backward ) 
+FFT_PImunu( struct PIdata *AA ,
+	    struct PIdata *VV ,
+	    const fftw_plan forward )
 {
-  size_t mu , nu , i ;
-  for( mu = 0 ; mu < ND ; mu++ ) {
-    for( nu = 0 ; nu < ND ; nu++ ) {
-      // AA
-      #pragma omp parallel for private(i)
-      for( i = 0 ; i < LVOLUME ; i++ ) {
-	in[ i ] = DATA[ i ].PI[ mu ][ nu ] ;
-      }
-      fftw_execute( forward ) ;
-      #pragma omp parallel for private(i)
-      for( i = 0 ; i < LVOLUME ; i++ ) {
-	DATA[ i ].PI[ mu ][ nu ] = out[ i ] ;
-      }
-    }
+  size_t c ;
+#pragma omp parallel for private(c) schedule(dynamic)
+  for( c = 0 ; c < 2*ND*ND ; c++ ) {
+    double complex *in = (double complex*)( c < ND*ND ? AA : VV ) + c%(ND*ND) ;
+    fftw_execute_dft( forward , in , in ) ;
   }
   return ;
 }
 #endif
 
-//
+// 4D momentum space VPF from the config-space data
 void
 momspace_PImunu( struct PIdata *AA ,
 		 struct PIdata *VV ,
@@ -46,33 +37,27 @@ momspace_PImunu( struct PIdata *AA ,
 		 const char *outfile ,
 		 const current_type current )
 {
-  return ;
-  
   // if we have FFTW we can unleash it
 #ifdef HAVE_FFTW3_H
-  // temporary space
-  double complex *in = malloc( LVOLUME * sizeof( double complex ) ) ;
-  double complex *out = malloc( LVOLUME * sizeof( double complex ) ) ;
-
   fftw_plan forward , backward ;
-  small_create_plans_DFT( &forward , &backward , in , out , ND ) ;
+  create_plans_strided( &forward , &backward ,
+			(double complex*)AA , (double complex*)AA ,
+			ND*ND , ND ) ;
 
-  // might be (but I doubt it) slow, most memory efficient way I could think of
-  FFT_PImunu( AA , in , out , forward , backward ) ;
-  FFT_PImunu( VV , in , out , forward , backward ) ;
-
-  // free fft memory
-  free( in ) ;
-  free( out ) ;
+  FFT_PImunu( AA , VV , forward ) ;
 
   fftw_destroy_plan( forward ) ;
   fftw_destroy_plan( backward ) ;
   fftw_cleanup( ) ;
 
   // here is where the call to the cuts routine goes
-  int *NMOM = malloc( sizeof( int ) ) ;
-  const struct veclist *list = compute_veclist( NMOM , CUTINFO ,
-						ND , GLU_FALSE ) ;
+  int NMOM[ 1 ] = { 0 } ;
+  struct veclist *list = compute_veclist( NMOM , CUTINFO , ND , GLU_FALSE ) ;
+  if( NMOM[0] == 0 ) {
+    fprintf( stderr , "[VPF] no momenta survive the cut\n" ) ;
+    free( list ) ;
+    return ;
+  }
 
   // allocate momenta
   double *psq = malloc( NMOM[0] * sizeof( double ) ) ;
@@ -92,6 +77,7 @@ momspace_PImunu( struct PIdata *AA ,
   // precompute momenta
   compute_p_psq( p , psq , list , (size_t)NMOM[0] ) ;
 
+  // WI correction, WI check and projections over the kept momenta
   momspace_data( AA , (const double **)p , psq , list , 
 		 NMOM , outfile , current , AXIAL ) ;
 
@@ -106,8 +92,7 @@ momspace_PImunu( struct PIdata *AA ,
   free( psq ) ;
 
   // free the momentum list
-  free( NMOM ) ;
-  free( (void*)list ) ;
+  free( list ) ;
 
 #else
   fprintf( stderr , "[VPF] NON-fftw routines not supported yet \n" ) ;
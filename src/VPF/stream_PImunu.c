@@ -0,0 +1,172 @@
+/**
+   @file stream_PImunu.c
+   @brief timeslice by timeslice accumulation of the VPF data
+
+   Only the time moments and the config-space WI are needed for most
+   runs and these only ever look at a timeslice and the one below it,
+   so unless the 4D momentum-space VPF is wanted we keep a timeslice of
+   AA and a ring of two of VV rather than the whole volume
+ */
+#include "common.h"
+
+#include "correlators.h"        // allocate_momcorrs()
+#include "momspace_PImunu.h"    // momentum space VPF
+#include "tmoments_PImunu.h"    // time moments
+#include "WardIdentity.h"       // config space WI
+
+// where timeslice t of the AA data goes
+struct PIdata *
+PIstream_AA( const struct PIstream *P ,
+	     const size_t t )
+{
+  return P -> full == GLU_TRUE ? P -> AA + LCU*t : P -> AA ;
+}
+
+// where timeslice t of the VV data goes
+struct PIdata *
+PIstream_VV( const struct PIstream *P ,
+	     const size_t t )
+{
+  return P -> full == GLU_TRUE ? P -> VV + LCU*t :
+    P -> VV + LCU*( P -> nslice & 1 ) ;
+}
+
+// the last timeslice of VV we accumulated
+static const struct PIdata *
+PIstream_VVprev( const struct PIstream *P )
+{
+  return P -> full == GLU_TRUE ? P -> VV + LCU*( P -> tprev ) :
+    P -> VV + LCU*( ( P -> nslice + 1 ) & 1 ) ;
+}
+
+// sum timeslice t into the correlators and the WI
+void
+PIstream_accumulate( struct PIstream *P ,
+		     const struct site *lat ,
+		     const size_t t )
+{
+  // read everything the single at the end changes, the barriers of
+  // the tmoments_slice() loops make sure we all have before it does
+  const size_t nslice = P -> nslice ;
+  const struct PIdata *VV = PIstream_VV( P , t ) ;
+  const struct PIdata *VVprev = PIstream_VVprev( P ) ;
+
+  tmoments_slice( P -> ctAA , PIstream_AA( P , t ) , t ) ;
+  tmoments_slice( P -> ctVV , VV , t ) ;
+
+  if( P -> WI == GLU_TRUE ) {
+    if( nslice == 0 ) {
+      // keep the first one, its WI needs the very last timeslice
+      if( P -> full == GLU_FALSE ) {
+	size_t x ;
+        #pragma omp for private(x)
+	for( x = 0 ; x < LCU ; x++ ) {
+	  P -> VV0[ x ] = VV[ x ] ;
+	}
+      }
+    } else {
+      const double sum = WI_configspace_bwd_slice( VV , VVprev , lat ) ;
+      #pragma omp atomic
+      P -> WIsum += sum ;
+    }
+  }
+
+  #pragma omp single
+  {
+    if( P -> nslice == 0 ) {
+      P -> tfirst = t ;
+    }
+    P -> tprev = t ;
+    P -> nslice++ ;
+  }
+  return ;
+}
+
+// close the WI and write everything out
+void
+PIstream_finish( struct PIstream *P ,
+		 const struct site *lat ,
+		 const struct cut_info CUTINFO ,
+		 const char *outfile ,
+		 const current_type current )
+{
+  if( P -> WI == GLU_TRUE && P -> nslice > 0 ) {
+    const struct PIdata *VV0 = P -> full == GLU_TRUE ?
+      P -> VV + LCU*( P -> tfirst ) : P -> VV0 ;
+    double sum = 0.0 ;
+    #pragma omp parallel reduction(+:sum)
+    {
+      sum += WI_configspace_bwd_slice( VV0 , PIstream_VVprev( P ) , lat ) ;
+    }
+    P -> WIsum += sum ;
+
+    // derivatives delta_\mu V_\mu(x)
+    fprintf( stdout , "\n[VPF] backward config-space violation %e \n\n" ,
+	     P -> WIsum / ( double)LVOLUME ) ;
+  }
+
+  // time moments are interesting also
+  tmoments( (const struct mcorr**)P -> ctAA ,
+	    (const struct mcorr**)P -> ctVV , outfile , current ) ;
+
+  // do all the momspace stuff away from the contractions
+  if( P -> full == GLU_TRUE ) {
+    momspace_PImunu( P -> AA , P -> VV , CUTINFO , outfile , current ) ;
+  }
+  return ;
+}
+
+// free the stream
+void
+free_PIstream( struct PIstream *P )
+{
+  if( P -> AA != NULL ) {
+    free( P -> AA ) ;
+  }
+  if( P -> VV != NULL ) {
+    free( P -> VV ) ;
+  }
+  if( P -> VV0 != NULL ) {
+    free( P -> VV0 ) ;
+  }
+  if( P -> ctAA != NULL ) {
+    free_momcorrs( P -> ctAA , ND , ND , 1 ) ;
+  }
+  if( P -> ctVV != NULL ) {
+    free_momcorrs( P -> ctVV , ND , ND , 1 ) ;
+  }
+  return ;
+}
+
+// allocate the stream, the whole volume only if full is set
+int
+init_PIstream( struct PIstream *P ,
+	       const current_type current ,
+	       const GLU_bool full )
+{
+  P -> AA = P -> VV = P -> VV0 = NULL ;
+  P -> ctAA = P -> ctVV = NULL ;
+  P -> WIsum = 0.0 ;
+  P -> nslice = P -> tfirst = P -> tprev = 0 ;
+  P -> WI = current == CONSERVED_LOCAL ? GLU_TRUE : GLU_FALSE ;
+  P -> full = full ;
+
+  const size_t nAA = full == GLU_TRUE ? LVOLUME : LCU ;
+  const size_t nVV = full == GLU_TRUE ? LVOLUME : 2*LCU ;
+  if( corr_malloc( (void**)&P -> AA , ALIGNMENT ,
+		   nAA*sizeof( struct PIdata ) ) != 0 ||
+      corr_malloc( (void**)&P -> VV , ALIGNMENT ,
+		   nVV*sizeof( struct PIdata ) ) != 0 ) {
+    fprintf( stderr , "[VPF] PIdata allocation failure\n" ) ;
+    return FAILURE ;
+  }
+  if( full == GLU_FALSE &&
+      corr_malloc( (void**)&P -> VV0 , ALIGNMENT ,
+		   LCU*sizeof( struct PIdata ) ) != 0 ) {
+    fprintf( stderr , "[VPF] PIdata allocation failure\n" ) ;
+    return FAILURE ;
+  }
+  P -> ctAA = allocate_momcorrs( ND , ND , 1 ) ;
+  P -> ctVV = allocate_momcorrs( ND , ND , 1 ) ;
+  return SUCCESS ;
+}
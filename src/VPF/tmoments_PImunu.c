@@ -64,33 +64,30 @@ DFT( struct PIdata *cpAA ,
   return list ;
 }
 
-// sum over every timeslice
-static void
-spatialzero_DFT( struct mcorr **corr ,
-		 const struct PIdata *data )
+// zero spatial momentum sum of the timeslice data into corr at t
+void
+tmoments_slice( struct mcorr **corr ,
+		const struct PIdata *data ,
+		const size_t t )
 {
-  // do the 0 spatial momentum sum first
-  size_t t ;
-#pragma omp parallel for private(t)
-  for( t = 0 ; t < LT ; t++ ) {
-    size_t i , mu , nu ;
-    for( mu = 0 ; mu < ND ; mu++ ) {
-      for( nu = 0 ; nu < ND ; nu++ ) {
-	register double complex sum = 0.0 ;
-	for( i = 0 ; i < LCU ; i++ ) {
-	  sum += data[ i + LCU * t ].PI[ mu ][ nu ] ; ;
-	}
-	corr[ mu ][ nu ].mom[ 0 ].C[ t ] = sum ;
-      }
+  size_t munu ;
+#pragma omp for private(munu)
+  for( munu = 0 ; munu < ND*ND ; munu++ ) {
+    const size_t mu = munu / ND , nu = munu % ND ;
+    register double complex sum = 0.0 ;
+    size_t i ;
+    for( i = 0 ; i < LCU ; i++ ) {
+      sum += data[ i ].PI[ mu ][ nu ] ;
     }
+    corr[ mu ][ nu ].mom[ 0 ].C[ t ] = sum ;
   }
   return ;
 }
 
 // time-moments approach
 void
-tmoments( const struct PIdata *AA ,
-	  const struct PIdata *VV ,
+tmoments( const struct mcorr **ctAA ,
+	  const struct mcorr **ctVV ,
 	  const char *outfile ,
 	  const current_type current ) 
 {  
@@ -98,14 +95,6 @@ tmoments( const struct PIdata *AA ,
   int *tNMOM = malloc( sizeof( int ) ) ;
   const struct veclist *tlist = zero_veclist( tNMOM , ND-1 , GLU_FALSE ) ;
 
-  // storage for the temporal data
-  struct mcorr **ctAA = allocate_momcorrs( ND , ND , tNMOM[0] ) ;
-  struct mcorr **ctVV = allocate_momcorrs( ND , ND , tNMOM[0] ) ;
-
-  // sum over every timeslice
-  spatialzero_DFT( ctAA , AA ) ;
-  spatialzero_DFT( ctVV , VV ) ;
-
   // change our output files
   char strAA[ 256 ] , strVV[ 256 ] ;
   switch( current ) {
@@ -117,6 +106,9 @@ tmoments( const struct PIdata *AA ,
     sprintf( strAA , "%s.LALA.tcorr.bin" , outfile ) ;
     sprintf( strVV , "%s.LVLV.tcorr.bin" , outfile ) ;
     break ;
+  case CL_AND_LL :
+    // the sweep hands us its currents one at a time
+    break ;
   }
 
   // write out the t-correlators
@@ -125,10 +117,8 @@ tmoments( const struct PIdata *AA ,
   for( i = 0 ; i < ND ; i++ ) {
     twist_zero[ i ] = 0.0 ;
   }
-  write_momcorr( strAA , (const struct mcorr**)ctAA , 
-		 tlist , twist_zero , ND , ND , tNMOM , "" ) ;
-  write_momcorr( strVV , (const struct mcorr**)ctVV ,
-		 tlist , twist_zero , ND , ND , tNMOM , "" ) ;
+  write_momcorr( strAA , ctAA , tlist , twist_zero , ND , ND , tNMOM , "" ) ;
+  write_momcorr( strVV , ctVV , tlist , twist_zero , ND , ND , tNMOM , "" ) ;
 
   // storage for the momentum-space data
   struct PIdata *cpAA = malloc( LT * sizeof( struct PIdata ) ) ;
@@ -136,16 +126,10 @@ tmoments( const struct PIdata *AA ,
 
   // we now have a correlator C(t) which we Fourier transform
   // in the t-direction
-  const struct veclist *list = DFT( cpAA , cpVV , 
-				    (const struct mcorr**)ctAA , 
-				    (const struct mcorr**)ctVV ) ;
+  const struct veclist *list = DFT( cpAA , cpVV , ctAA , ctVV ) ;
   
   const int NMOM[ 1 ] = { (int)LT } ;
 
-  // free the temporal correlators now
-  free_momcorrs( ctAA , ND , ND , tNMOM[0] ) ;
-  free_momcorrs( ctVV , ND , ND , tNMOM[0] ) ;
-
   // free the temporal ones
   free( tNMOM ) ; free( (void*)tlist ) ;
 
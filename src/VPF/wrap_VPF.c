@@ -4,8 +4,8 @@
  */
 #include "common.h"
 
-#include "cl_diagonal.h"      // conserved-local Wilson currents
-#include "cl_offdiagonal.h"   // conserved-local flavour off diagonal
+#include "cl_diagonal.h"      // conserved-local (and local-local) Wilson currents
+#include "cl_offdiagonal.h"   // conserved-local (and local-local) flavour off diagonal
 #include "GLU_timer.h"        // print_time()
 #include "ll_diagonal.h"      // local-local currents
 #include "ll_offdiagonal.h"   // flavour off diagonal local-local
@@ -27,6 +27,9 @@ select_callback_single( const current_type current )
   case LOCAL_LOCAL :
     single_callback = ll_diagonal ;
     break ;
+  case CL_AND_LL :
+    single_callback = cl_ll_diagonal ;
+    break ;
     // have space for conserved-conserved if we choose to do it
   }
   return ;
@@ -49,6 +52,9 @@ select_callback_double( const current_type current )
   case LOCAL_LOCAL :
     double_callback = ll_offdiagonal ;
     break ;
+  case CL_AND_LL :
+    double_callback = cl_ll_offdiagonal ;
+    break ;
   }
   return ;
 }
@@ -70,7 +76,7 @@ contract_VPF( struct propagator *prop ,
 
     // check origins are the same and plaquettes are the same
     if( sanity_check_props( prop , VPF[ measurements ].map ,
-			    2 , "[VPF]" ) == FAILURE ) {
+			    2 , "[VPF]" , GLU_FALSE ) == FAILURE ) {
       return FAILURE ;
     }
 
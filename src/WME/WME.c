@@ -18,40 +18,90 @@
 // number of propagators
 #define Nprops (4)
 
-// ok, brute force this calculation
-static double complex
-four_quark_trace( const struct spinor SWALL_0 ,
-		  const struct spinor DWALL_0 ,
-		  const struct spinor SWALL_L_2 ,
-		  const struct spinor DWALL_L_2 ,
-		  const struct gamma GSRC , 
-		  const struct gamma GSNK ,
-		  const struct gamma PROJ ,
-		  const struct gamma G5 )
-{
-  // precompute the adjoints, always the "down" quark
-  struct spinor anti_DWALL_0 , anti_DWALL_L_2 ;
-  full_adj( &anti_DWALL_0 , DWALL_0 , G5 ) ;
-  full_adj( &anti_DWALL_L_2 , DWALL_L_2 , G5 ) ;
+// spin-block index of the [a][b][c][d] element
+#define SB( a , b , c , d ) ( (d) + NS * ( (c) + NS * ( (b) + NS * (a) ) ) )
 
-  // compute
-  // trace( SWALL_0 * G5 * anti_DWALL_0 * GSRC * 
-  //        SWALL_L_2 * G5 * anti_DWALL_L_2 * GSNK );
+// number of spin-blocks, same as the number of (GSRC,GSNK) channels
+#define NSB ( NSNS * NSNS )
 
-  // left and right multiply anti_DWALL_0 by PROJ and GSRC
-  gamma_mul_lr( &anti_DWALL_0 , PROJ , GSRC ) ;
+// sites per chunk of the site sum, the chunks are summed in order so
+// the result doesn't depend on the number of threads
+#define WME_CHUNK (64)
 
-  // multiply on the left by SWALL_0
-  spinmul_atomic_left( &anti_DWALL_0 , SWALL_0 ) ;
+// the gamma-independent half of one wall's trace,
+// S * PROJ * ( G5 D^{\dagger} G5 ), always the "down" quark is adjoint
+static void
+wall_product( struct spinor *P ,
+	      const struct spinor S ,
+	      const struct spinor D ,
+	      const struct gamma PROJ ,
+	      const struct gamma G5 )
+{
+  struct spinor anti_D ;
+  full_adj( &anti_D , D , G5 ) ;
+  gamma_mul_l( &anti_D , PROJ ) ;
+  spinmul_atomic_left( &anti_D , S ) ;
+  *P = anti_D ;
+  return ;
+}
 
-  // left and right multiply anti_DWALL_L_2 by PROJ and GSNK
-  gamma_mul_lr( &anti_DWALL_L_2 , PROJ , GSNK ) ;
+// accumulate this site's colour-traced spin blocks Tr_c[ P_ab Q_cd ]
+// for the four quark trace and the products of the meson traces mP and
+// mQ of every ( GSRC , GSNK ) for the trace-trace
+static void
+accumulate_blocks( double complex *fourq ,
+		   double complex *trtr ,
+		   const struct spinor P ,
+		   const struct spinor Q ,
+		   const double complex mP[ NSNS ] ,
+		   const double complex mQ[ NSNS ] )
+{
+  size_t ab , cd , i , j ;
+  for( ab = 0 ; ab < NSNS ; ab++ ) {
+    const double complex *Pab = (const double complex*)P.D[ ab/NS ][ ab%NS ].C ;
+    for( cd = 0 ; cd < NSNS ; cd++ ) {
+      const double complex *Qcd = (const double complex*)Q.D[ cd/NS ][ cd%NS ].C ;
+      register double complex sum = 0.0 ;
+      for( i = 0 ; i < NC ; i++ ) {
+	for( j = 0 ; j < NC ; j++ ) {
+	  sum += Pab[ j + i*NC ] * Qcd[ i + j*NC ] ;
+	}
+      }
+      fourq[ cd + ab*NSNS ] += sum ;
+      trtr[ cd + ab*NSNS ] += mP[ ab ] * mQ[ cd ] ;
+    }
+  }
+  return ;
+}
 
-  // multiply on the left by SWALL_0
-  spinmul_atomic_left( &anti_DWALL_L_2 , SWALL_L_2 ) ;
+// gamma phases are powers of I
+static double complex
+gphase( const uint8_t g )
+{
+  switch( g & 3 ) {
+  case 0 : return 1 ;
+  case 1 : return I ;
+  case 2 : return -1 ;
+  default : return -I ;
+  }
+}
 
-  // and compute the trace of the product of these smaller products
-  return bilinear_trace( anti_DWALL_0 , anti_DWALL_L_2 ) ;
+// Tr[ P GSRC Q GSNK ] from the summed blocks, the gammas only pick
+// out NS*NS of them
+static double complex
+four_quark_trace( const double complex *fourq ,
+		  const struct gamma GSRC ,
+		  const struct gamma GSNK )
+{
+  register double complex tr = 0.0 ;
+  size_t b , d ;
+  for( b = 0 ; b < NS ; b++ ) {
+    for( d = 0 ; d < NS ; d++ ) {
+      tr += gphase( GSRC.g[b] + GSNK.g[d] ) *
+	fourq[ SB( GSNK.ig[d] , b , GSRC.ig[b] , d ) ] ;
+    }
+  }
+  return tr ;
 }
 
 // attempt to follow UKhadron's implementation where I can.
@@ -75,12 +125,12 @@ WME( struct propagator s0 ,
   // two "terms" of the baryon contraction in "in" and "out"
   const size_t flat_dirac = 2 * stride1 * stride2 ;
 
-  // loop counters
-  size_t t ;
-
   // error code
   int error_code = SUCCESS ;
 
+  // partial sums of the spin blocks of each chunk of sites, and their total
+  double complex *part = NULL , *blocks = NULL ;
+
   // initialise our measurement struct
   struct propagator prop[ Nprops ] = { s0 , d0 , s1 , d1 } ;
   // ds are anti in our convention
@@ -95,61 +145,128 @@ WME( struct propagator s0 ,
   // project onto a state : GAMMAS[ 9 ] for projection onto A_t state
   const struct gamma PROJ = M.GAMMAS[ GAMMA_5 ] ;
 
-  // Time slice loop 
-  for( t = 0 ; t < LT ; t++ ) {
+  // the channels all come from the same NSB blocks
+  const size_t nchunks = ( LCU + WME_CHUNK - 1 ) / WME_CHUNK ;
+  if( corr_malloc( (void**)&part , ALIGNMENT ,
+		   nchunks * 2 * NSB * sizeof( double complex ) ) != 0 ||
+      corr_malloc( (void**)&blocks , ALIGNMENT ,
+		   2 * NSB * sizeof( double complex ) ) != 0 ) {
+    fprintf( stderr , "[WME] spin-block allocation failure\n" ) ;
+    error_code = FAILURE ; goto memfree ;
+  }
+
+  // start the sweep at the source of any pipelined NRQCD prop
+  const size_t tstart = sweep_start( prop , Nprops ) ;
 
-    // read the prop files
+  // initialise the parallel region
 #pragma omp parallel
+  {
+    // loop counters
+    size_t tt = 0 , i ;
+
+    // initially read in a timeslice
+    read_ahead( prop , M.S , &error_code , Nprops , tstart ) ;
+
     {
-      read_ahead( prop , M.S , &error_code , Nprops , t ) ;
-    }
-    if( error_code == FAILURE ) {
-      goto memfree ;
+      #pragma omp barrier
     }
 
-    // rotate if we must
-    rotate_offdiag( M.S , prop , Nprops ) ;
-
-    size_t GSGK ;
-    // parallelise the furthest out loop
-    #pragma omp parallel for private(GSGK)
-    for( GSGK = 0 ; GSGK < ( NSNS * NSNS ); GSGK++ ) {
-
-      const size_t GSRC = GSGK / ( NSNS ) ;
-      const size_t GSNK = GSGK % ( NSNS ) ;
-      register double complex trtr = 0.0 ;
-      register double complex tr = 0.0 ;
-      
-      size_t site ;
-      for( site = 0 ; site < LCU ; site++ ) {
-	// trace-trace component is simple this is projected onto external "PROJ" state
-	trtr += ( meson_contract( PROJ , 
-				  M.S[1][ site ] , M.GAMMAS[ GSRC ] , 
-				  M.S[0][ site ] , M.GAMMAS[ GAMMA_5 ] ) *
-		  meson_contract( PROJ , 
-				  M.S[3][ site ] , M.GAMMAS[ GSNK ] , 
-				  M.S[4][ site ] , M.GAMMAS[ GAMMA_5 ] ) ) ;
-	// four quark trace is unpleasant
-	tr += four_quark_trace( M.S[0][ site ] , M.S[1][ site ] ,
-				M.S[2][ site ] , M.S[3][ site ] ,
-				M.GAMMAS[ GSRC ] , M.GAMMAS[ GSNK ] ,
-				PROJ , M.GAMMAS[ GAMMA_5 ] ) ;
+    // Time slice loop 
+    for( tt = 0 ; tt < LT && error_code == SUCCESS ; tt++ ) {
+      // physical timeslice, wraps round from tstart
+      const size_t t = ( tt + tstart ) % LT ;
+
+      // rotate if we must
+      rotate_offdiag( M.S , prop , Nprops ) ;
+
+      // master-slave the IO of the next timeslice and contract this one
+      if( tt < LT-1 ) {
+	read_ahead( prop , M.Sf , &error_code , Nprops , (t+1)%LT ) ;
+      }
+
+      // the adjoints and PROJ products are done once per site
+      // and every channel comes out of the same blocks, dynamic so
+      // that the threads reading catch up
+      size_t chunk ;
+      #pragma omp for private(chunk) schedule(dynamic)
+      for( chunk = 0 ; chunk < nchunks ; chunk++ ) {
+	double complex *fourq = part + chunk * 2 * NSB ;
+	double complex *trtr = fourq + NSB ;
+	for( i = 0 ; i < NSB ; i++ ) {
+	  fourq[ i ] = trtr[ i ] = 0.0 ;
+	}
+	const size_t end = ( chunk + 1 ) * WME_CHUNK < LCU ?
+	  ( chunk + 1 ) * WME_CHUNK : LCU ;
+	size_t site ;
+	for( site = chunk * WME_CHUNK ; site < end ; site++ ) {
+	  // trace-trace component is simple this is projected onto external "PROJ" state
+	  double complex mP[ NSNS ] , mQ[ NSNS ] ;
+	  size_t G ;
+	  for( G = 0 ; G < NSNS ; G++ ) {
+	    mP[ G ] = meson_contract( PROJ , M.S[1][ site ] , M.GAMMAS[ G ] , 
+				      M.S[0][ site ] , M.GAMMAS[ GAMMA_5 ] ) ;
+	    mQ[ G ] = meson_contract( PROJ , M.S[3][ site ] , M.GAMMAS[ G ] , 
+				      M.S[2][ site ] , M.GAMMAS[ GAMMA_5 ] ) ;
+	  }
+	  // four quark trace is unpleasant
+	  struct spinor P , Q ;
+	  wall_product( &P , M.S[0][ site ] , M.S[1][ site ] , 
+			PROJ , M.GAMMAS[ GAMMA_5 ] ) ;
+	  wall_product( &Q , M.S[2][ site ] , M.S[3][ site ] ,
+			PROJ , M.GAMMAS[ GAMMA_5 ] ) ;
+	  accumulate_blocks( fourq , trtr , P , Q , mP , mQ ) ;
+	}
+      }
+
+      // reduce the chunks' blocks in a fixed order
+      #pragma omp for private(i)
+      for( i = 0 ; i < 2 * NSB ; i++ ) {
+	register double complex sum = 0.0 ;
+	for( chunk = 0 ; chunk < nchunks ; chunk++ ) {
+	  sum += part[ i + chunk * 2 * NSB ] ;
+	}
+	blocks[ i ] = sum ;
+      }
+
+      size_t GSGK ;
+      #pragma omp for private(GSGK)
+      for( GSGK = 0 ; GSGK < NSB ; GSGK++ ) {
+	const size_t GSRC = GSGK / ( NSNS ) ;
+	const size_t GSNK = GSGK % ( NSNS ) ;
+	// there is probably a factor in this is it 1/2?
+	M.corr[ GSRC ][ GSNK ].mom[0].C[ t ] = 
+	  four_quark_trace( blocks , M.GAMMAS[ GSRC ] , M.GAMMAS[ GSNK ] ) 
+	  - blocks[ NSB + GSGK ] ;
+      }
+
+      #pragma omp single
+      {
+	// copy Sf into S
+	copy_props( &M , Nprops ) ;
+
+	// tell us how far along we are
+	progress_bar( tt , LT ) ;
       }
-      // there is probably a factor in this is it 1/2?
-      M.corr[ GSRC ][ GSNK ].mom[0].C[ t ] = tr - trtr ;
     }
-    
-    // tell us how far along we are
-    progress_bar( t , LT ) ;
   }
 
+  if( error_code == FAILURE ) goto memfree ;
+
   // and write out a file
-  write_momcorr( outfile , (const struct mcorr**)M.corr , M.list ,
-		 M.sum_twist , stride1 , stride2 , M.nmom , "" ) ;
+  write_momcorr( outfile , (const struct mcorr**)M.corr , M.olist ,
+		 M.sum_twist , stride1 , stride2 , M.nolist , "" ) ;
 
   // memory deallocation
  memfree :
 
+  // free the spin blocks
+  if( part != NULL ) {
+    free( part ) ;
+  }
+  if( blocks != NULL ) {
+    free( blocks ) ;
+  }
+
   // free our measurement struct
   free_measurements( &M , Nprops , stride1 , stride2 , flat_dirac ) ;
 
@@ -158,3 +275,6 @@ WME( struct propagator s0 ,
 
 // clean up the number of props
 #undef Nprops
+#undef NSB
+#undef SB
+#undef WME_CHUNK
@@ -33,7 +33,7 @@ contract_WME( struct propagator *prop ,
 
     // check origins are the same and plaquettes are the same
     if( sanity_check_props( prop , wme[ measurements ].map ,
-			    4 , "[WME]" ) == FAILURE ) {
+			    4 , "[WME]" , GLU_FALSE ) == FAILURE ) {
       return FAILURE ;
     }
 
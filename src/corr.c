@@ -9,6 +9,7 @@
 #include "input_reader.h"    // input file readers
 #include "read_config.h"     // read a gauge configuration file
 #include "read_propheader.h" // read the propagator file header
+#include "scratch.h"         // per-thread scratch arenas
 #include "bar_projections.h"
 
 #include "wrap_baryons.h"    // Baryon contraction wrapper
@@ -32,6 +33,22 @@ struct latt_info Latt ;
 // really need to remove this somehow ...
 struct site *lat = NULL ;
 
+// the most per-thread scratch any of the measurements asks for, the
+// mesons, baryons, diquarks, VPF and WME keep their per-site
+// temporaries on the stack and do not need any
+static size_t
+scratch_bytes( const struct input_info inputs )
+{
+  size_t bytes = 0 ;
+  if( inputs.npentas > 0 && penta_scratch_bytes( ) > bytes ) {
+    bytes = penta_scratch_bytes( ) ;
+  }
+  if( inputs.ntetras > 0 && tetra_scratch_bytes( ) > bytes ) {
+    bytes = tetra_scratch_bytes( ) ;
+  }
+  return bytes ;
+}
+
 // enumeration for the arguments to our binary
 enum{ INFILE = 2 , GAUGE_FILE = 4 } ;
 
@@ -102,11 +119,16 @@ main( const int argc,
 
   // compute the NRQCD props
   if( MODE == GAUGE_AND_PROPS ) {
-    if( compute_nrqcd_props( prop , inputs.nprops ) == FAILURE ) {
+    if( compute_nrqcd_props( prop , inputs ) == FAILURE ) {
       goto FREES ;
     }
   }
 
+  // per-thread scratch for the contractions, sized from the measurements
+  if( init_scratch( scratch_bytes( inputs ) ) == FAILURE ) {
+    goto FREES ;
+  }
+
   start_timer( ) ;
 
   // baryon contraction code
@@ -158,6 +180,9 @@ main( const int argc,
   // we will have to move this around only place where this is freed
   free( lat ) ;
 
+  // free the scratch arenas
+  free_scratch( ) ;
+
   // free the computed NRQCD propagators
   free_nrqcd_props( prop , inputs.nprops ) ;
   
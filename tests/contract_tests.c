@@ -6,9 +6,11 @@
 #include "common.h"
 
 #include "contractions.h"  // contractions
+#include "diquark_contraction.h" // diquark_batch()
 #include "gammas.h"        // gamma matrices
 #include "minunit.h"       // minimal unit testing framework
 #include "spinor_ops.h"    // identity_spinor()
+#include "test_utils.h"    // random_spinor()
 
 #define FTOL ( NC * 1.E-14 ) 
 
@@ -301,6 +303,63 @@ simple_meson_contract_test( void )
   return NULL ;
 }
 
+// the batched diquark for the source gammas src[] and sink gammas
+// snk[] must agree with diquark() channel by channel
+static char *
+diquark_batch_check( const struct spinor S1 ,
+		     const struct spinor S2 ,
+		     const size_t *src ,
+		     const size_t *snk ,
+		     const size_t ngammas )
+{
+  struct gamma Cgmu[ NSNS ] , Cgnu[ NSNS ] ;
+  size_t G ;
+  for( G = 0 ; G < ngammas ; G++ ) {
+    Cgmu[ G ] = CGmu( GAMMAS[ src[ G ] ] , GAMMAS ) ;
+    Cgnu[ G ] = gt_Gdag_gt( CGmu( GAMMAS[ snk[ G ] ] , GAMMAS ) ,
+			    GAMMAS[ GAMMA_T ] ) ;
+  }
+  double complex res[ NSNS*NSNS ] ;
+  diquark_batch( res , S1 , S2 , Cgmu , Cgnu , ngammas ) ;
+
+  size_t GSRC , GSNK ;
+  for( GSRC = 0 ; GSRC < ngammas ; GSRC++ ) {
+    for( GSNK = 0 ; GSNK < ngammas ; GSNK++ ) {
+      const double complex d = diquark( S1 , S2 , Cgmu[ GSRC ] , Cgnu[ GSNK ] ) ;
+      mu_assert( "[CONTRACT UNIT] error : diquark_batch broken",
+		 !( cabs( d - res[ GSNK + ngammas*GSRC ] ) > FTOL*( 1 + cabs( d ) ) ) ) ;
+    }
+  }
+  return NULL ;
+}
+
+// diquark_batch for two different random spinors, for all of the
+// gammas and for subsets that only need some of the T products
+static char *
+diquark_batch_test( void )
+{
+  struct spinor S1 , S2 ;
+  random_spinor( &S1 , 0 ) ;
+  random_spinor( &S2 , 1 ) ;
+
+  size_t all[ NSNS ] , G ;
+  for( G = 0 ; G < NSNS ; G++ ) {
+    all[ G ] = G ;
+  }
+  char *res ;
+  if( ( res = diquark_batch_check( S1 , S2 , all , all , NSNS ) ) != NULL ) {
+    return res ;
+  }
+
+  // different source and sink subsets leave holes in the masks
+  const size_t src[ 3 ] = { GAMMA_5 , GAMMA_X , AT } ;
+  const size_t snk[ 3 ] = { IDENTITY , TXY , GAMMA_T } ;
+  if( ( res = diquark_batch_check( S1 , S2 , src , snk , 3 ) ) != NULL ) {
+    return res ;
+  }
+  return diquark_batch_check( S1 , S2 , src , src , 3 ) ;
+}
+
 // spinor tests
 static char *
 contractions_test( void )
@@ -332,6 +391,7 @@ contractions_test( void )
                                  // test them first !!
   mu_run_test( simple_meson_contract_test ) ;
   mu_run_test( meson_contract_test ) ;
+  mu_run_test( diquark_batch_test ) ;
 
   return NULL ;
 }
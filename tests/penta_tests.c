@@ -0,0 +1,427 @@
+/**
+   @file penta_tests.c
+   @brief pentaquark contraction tests
+ */
+#include "common.h"
+
+#include "contractions.h"       // gamma_mul_r(), gamma_mul_lr()
+#include "gammas.h"             // CGmu(), gt_Gdag_gt()
+#include "minunit.h"            // mu_assert
+#include "Ospinor.h"            // spinor_to_Ospinor()
+#include "penta_colors.h"       // init_penta_colors()
+#include "penta_contractions.h" // pentas(), idx()
+#include "spinmatrix_ops.h"     // spinmatrix_multiply()
+#include "spinor_ops.h"         // transpose_spinor()
+#include "test_utils.h"         // random_spinor()
+
+// our tolerance, relative to the size of the contraction
+#define FLTOL (NC*1.E-14)
+
+// gamma space
+static struct gamma *GAMMAS = NULL ;
+
+// colour term lists
+static struct penta_colors PC ;
+
+// the dense colour tensor of the old code and its index table
+static double complex **Fd = NULL ;
+static uint8_t loc[ PENTA_NCOLORS ][ 8 ] ;
+
+// the dense F-tensor of the (ud)(us) diquark diagonal block
+static void
+dense_F_O1O1( double complex *F ,
+	      const struct Ospinor OU1 ,
+	      const struct Ospinor OU2 ,
+	      const struct Ospinor OD ,
+	      const struct Ospinor OS )
+{
+  struct spinmatrix temp5[ NCNC ][ NCNC ] , temp6[ NCNC ][ NCNC ] ;
+  size_t c1 , c2 , c3 , c4 , i ;
+  for( c1 = 0 ; c1 < NC ; c1++ ) {
+    for( c2 = 0 ; c2 < NC ; c2++ ) {
+      for( c3 = 0 ; c3 < NC ; c3++ ) {
+	for( c4 = 0 ; c4 < NC ; c4++ ) {
+	  spinmatrix_multiply( temp5[c2+NC*c1][c4+NC*c3].D ,
+			       OU1.C[c1][c2].D , OD.C[c3][c4].D ) ;
+	  spinmatrix_multiply( temp6[c2+NC*c1][c4+NC*c3].D ,
+			       OU2.C[c1][c2].D , OS.C[c3][c4].D ) ;
+	}
+      }
+    }
+  }
+  for( i = 0 ; i < PENTA_NCOLORS ; i++ ) {
+    const uint8_t *l = loc[i] ;
+    F[i] =
+      spinmatrix_trace( temp5[ l[1] + NC*l[0] ][ l[3] + NC*l[2] ].D ) *
+      spinmatrix_trace( temp6[ l[5] + NC*l[4] ][ l[7] + NC*l[6] ].D ) -
+      trace_prod_spinmatrices( temp5[ l[5] + NC*l[0] ][ l[3] + NC*l[2] ].D ,
+			       temp6[ l[1] + NC*l[4] ][ l[7] + NC*l[6] ].D ) ;
+  }
+  return ;
+}
+
+// the epsilon identities of the (ud)(us) diquark diagonal block
+static double complex
+dense_colors_O1O1( const double complex *F ,
+		   const struct colormatrix B )
+{
+  register double complex sum = 0.0 ;
+  size_t b , c , g , h , prime ;
+  for( h = 0 ; h < NC ; h++ ) {
+    for( g = 0 ; g < NC ; g++ ) {
+      for( c = 0 ; c < NC ; c++ ) {
+	for( prime = 0 ; prime < NC ; prime++ ) {
+	  for( b = 0 ; b < NC ; b++ ) {
+	    sum +=
+	      ( F[ idx( b , prime , c , c , g , g , h , h ) ] -
+		F[ idx( b , prime , c , c , g , h , h , g ) ] -
+		F[ idx( b , prime , c , g , g , c , h , h ) ] +
+		F[ idx( b , prime , c , h , g , c , h , g ) ] +
+		F[ idx( b , prime , c , g , g , h , h , c ) ] -
+		F[ idx( b , prime , c , h , g , g , h , c ) ] ) *
+	      B.C[ prime ][ b ] ;
+	    sum -=
+	      ( F[ idx( b , c , c , prime , g , g , h , h ) ] -
+		F[ idx( b , c , c , prime , g , h , h , g ) ] -
+		F[ idx( b , g , c , prime , g , c , h , h ) ] +
+		F[ idx( b , h , c , prime , g , c , h , g ) ] +
+		F[ idx( b , g , c , prime , g , h , h , c ) ] -
+		F[ idx( b , h , c , prime , g , g , h , c ) ] ) *
+	      B.C[ prime ][ b ] ;
+	    sum -=
+	      ( F[ idx( b , prime , c , b , g , g , h , h ) ] -
+		F[ idx( b , prime , c , b , g , h , h , g ) ] -
+		F[ idx( b , prime , c , g , g , b , h , h ) ] +
+		F[ idx( b , prime , c , h , g , b , h , g ) ] +
+		F[ idx( b , prime , c , g , g , h , h , b ) ] -
+		F[ idx( b , prime , c , h , g , g , h , b ) ] ) *
+	      B.C[ prime ][ c ] ;
+	    sum +=
+	      ( F[ idx( b , b , c , prime , g , g , h , h ) ] -
+		F[ idx( b , b , c , prime , g , h , h , g ) ] -
+		F[ idx( b , g , c , prime , g , b , h , h ) ] +
+		F[ idx( b , h , c , prime , g , b , h , g ) ] +
+		F[ idx( b , g , c , prime , g , h , h , b ) ] -
+		F[ idx( b , h , c , prime , g , g , h , b ) ] ) *
+	      B.C[ prime ][ c ] ;
+	  }
+	}
+      }
+    }
+  }
+  return sum ;
+}
+
+// the old dense O1O1
+static void
+dense_O1O1( struct spinmatrix *P ,
+	    const struct spinor U ,
+	    const struct spinor D ,
+	    const struct spinor S ,
+	    const struct spinor B ,
+	    const struct gamma OP1 ,
+	    const struct gamma OP2 )
+{
+  const struct gamma C1 = CGmu( OP1 , GAMMAS ) ;
+  const struct gamma tC1t = gt_Gdag_gt( C1 , GAMMAS[ GAMMA_T ] ) ;
+  const struct gamma C2 = CGmu( OP2 , GAMMAS ) ;
+  const struct gamma tC2t = gt_Gdag_gt( C2 , GAMMAS[ GAMMA_T ] ) ;
+
+  struct spinor U1 = transpose_spinor( U ) , U2 = U1 , Dt = D , St = S ;
+  gamma_mul_r( &U1 , C1 ) ;
+  gamma_mul_r( &Dt , tC1t ) ;
+  gamma_mul_r( &U2 , C2 ) ;
+  gamma_mul_r( &St , tC2t ) ;
+
+  dense_F_O1O1( Fd[0] , spinor_to_Ospinor( U1 ) , spinor_to_Ospinor( U2 ) ,
+		spinor_to_Ospinor( Dt ) , spinor_to_Ospinor( St ) ) ;
+
+  size_t d1 , d2 ;
+  for( d1 = 0 ; d1 < NS ; d1++ ) {
+    for( d2 = 0 ; d2 < NS ; d2++ ) {
+      P -> D[d1][d2] = dense_colors_O1O1( Fd[0] , B.D[d1][d2] ) ;
+    }
+  }
+  return ;
+}
+
+// the dense F-tensor of a diquark against a baryon-meson, O1O2 and
+// O2O1 differ in which colour indices the subtracted product swaps
+static void
+dense_F_mixed( double complex **F ,
+	       const struct Ospinor O1 ,
+	       const struct Ospinor O2 ,
+	       const struct Ospinor O3 ,
+	       const struct Ospinor O4 ,
+	       const GLU_bool is_O1O2 )
+{
+  struct spinmatrix temp5[ NCNC ][ NCNC ] , temp6[ NCNC ][ NCNC ] ;
+  size_t c1 , c2 , c3 , c4 , i , d ;
+  for( c1 = 0 ; c1 < NC ; c1++ ) {
+    for( c2 = 0 ; c2 < NC ; c2++ ) {
+      for( c3 = 0 ; c3 < NC ; c3++ ) {
+	for( c4 = 0 ; c4 < NC ; c4++ ) {
+	  spinmatrix_multiply( temp5[c2+NC*c1][c4+NC*c3].D ,
+			       O1.C[c1][c2].D , O2.C[c3][c4].D ) ;
+	  spinmatrix_multiply( temp6[c2+NC*c1][c4+NC*c3].D ,
+			       O3.C[c1][c2].D , O4.C[c3][c4].D ) ;
+	  transpose_spinmatrix( temp6[c2+NC*c1][c4+NC*c3].D ) ;
+	}
+      }
+    }
+  }
+  for( i = 0 ; i < PENTA_NCOLORS ; i++ ) {
+    const uint8_t *l = loc[i] ;
+    struct spinmatrix temp7 , temp8 ;
+    spinmatrix_multiply_T( temp7.D ,
+			   temp5[ l[1] + NC*l[0] ][ l[3] + NC*l[2] ].D ,
+			   temp6[ l[5] + NC*l[4] ][ l[7] + NC*l[6] ].D ) ;
+    if( is_O1O2 == GLU_TRUE ) {
+      spinmatrix_multiply_T( temp8.D ,
+			     temp5[ l[5] + NC*l[0] ][ l[3] + NC*l[2] ].D ,
+			     temp6[ l[1] + NC*l[4] ][ l[7] + NC*l[6] ].D ) ;
+    } else {
+      spinmatrix_multiply_T( temp8.D ,
+			     temp5[ l[1] + NC*l[0] ][ l[7] + NC*l[2] ].D ,
+			     temp6[ l[5] + NC*l[4] ][ l[3] + NC*l[6] ].D ) ;
+    }
+    for( d = 0 ; d < NSNS ; d++ ) {
+      F[ d ][ i ] = temp7.D[ d/NS ][ d%NS ] - temp8.D[ d/NS ][ d%NS ] ;
+    }
+  }
+  return ;
+}
+
+// the epsilon identities of the diquark / baryon-meson block
+static double complex
+dense_colors_O1O2( const double complex *F )
+{
+  register double complex sum = 0.0 ;
+  size_t b , c , g , h ;
+  for( b = 0 ; b < NC ; b++ ) {
+    for( c = 0 ; c < NC ; c++ ) {
+      for( g = 0 ; g < NC ; g++ ) {
+	for( h = 0 ; h < NC ; h++ ) {
+	  sum += ( +F[ idx( c , b , c , h , g , g , h , b ) ]
+		   -F[ idx( c , b , c , g , h , g , h , b ) ]
+		   -F[ idx( g , b , c , h , c , g , h , b ) ]
+		   +F[ idx( h , b , c , g , c , g , h , b ) ]
+		   +F[ idx( g , b , c , c , h , g , h , b ) ]
+		   -F[ idx( h , b , c , c , g , g , h , b ) ] ) ;
+	  sum -= ( +F[ idx( b , b , c , h , g , g , h , c ) ]
+		   -F[ idx( b , b , c , g , h , g , h , c ) ]
+		   -F[ idx( g , b , c , h , b , g , h , c ) ]
+		   +F[ idx( h , b , c , g , b , g , h , c ) ]
+		   +F[ idx( g , b , c , b , h , g , h , c ) ]
+		   -F[ idx( h , b , c , b , g , g , h , c ) ] ) ;
+	}
+      }
+    }
+  }
+  return sum ;
+}
+
+// the epsilon identities of the baryon-meson / diquark block
+static double complex
+dense_colors_O2O1( const double complex *F )
+{
+  register double complex sum = 0.0 ;
+  size_t a , b , c , prime ;
+  for( a = 0 ; a < NC ; a++ ) {
+    for( c = 0 ; c < NC ; c++ ) {
+      for( b = 0 ; b < NC ; b++ ) {
+	for( prime = 0 ; prime < NC ; prime++ ) {
+	  sum += ( +F[ idx( prime , c , b , b , c , a , prime , a ) ]
+		   -F[ idx( prime , b , c , b , c , a , prime , a ) ]
+		   -F[ idx( prime , c , a , b , c , b , prime , a ) ]
+		   +F[ idx( prime , b , a , b , c , c , prime , a ) ]
+		   +F[ idx( prime , a , c , b , c , b , prime , a ) ]
+		   -F[ idx( prime , a , b , b , c , c , prime , a ) ] ) ;
+	  sum -= ( +F[ idx( prime , c , b , b , c , prime , a , a ) ]
+		   -F[ idx( prime , b , c , b , c , prime , a , a ) ]
+		   -F[ idx( prime , c , a , b , c , prime , b , a ) ]
+		   +F[ idx( prime , b , a , b , c , prime , c , a ) ]
+		   +F[ idx( prime , a , c , b , c , prime , b , a ) ]
+		   -F[ idx( prime , a , b , b , c , prime , c , a ) ] ) ;
+	}
+      }
+    }
+  }
+  return sum ;
+}
+
+// the old dense O1O2, O1O3 is this with D and S swapped
+static void
+dense_O1O2( struct spinmatrix *P ,
+	    const struct spinor U ,
+	    const struct spinor D ,
+	    const struct spinor S ,
+	    const struct spinor B ,
+	    const struct gamma OP1 ,
+	    const struct gamma OP2 )
+{
+  const struct gamma C1 = CGmu( OP1 , GAMMAS ) ;
+  const struct gamma C2 = CGmu( OP2 , GAMMAS ) ;
+  const struct gamma t2t = gt_Gdag_gt( OP2 , GAMMAS[ GAMMA_T ] ) ;
+  const struct gamma tC2t = gt_Gdag_gt( C2 , GAMMAS[ GAMMA_T ] ) ;
+
+  struct spinor Temp = S , M = B ;
+  gamma_mul_lr( &Temp , C1 , t2t ) ;
+  spinmul_atomic_left( &M , Temp ) ;
+  Temp = D ;
+  gamma_mul_lr( &Temp , C1 , tC2t ) ;
+
+  dense_F_mixed( Fd , spinor_to_Ospinor( U ) , spinor_to_Ospinor( Temp ) ,
+		 spinor_to_Ospinor( transpose_spinor( U ) ) ,
+		 spinor_to_Ospinor( M ) , GLU_TRUE ) ;
+
+  size_t d1 , d2 ;
+  for( d1 = 0 ; d1 < NS ; d1++ ) {
+    for( d2 = 0 ; d2 < NS ; d2++ ) {
+      P -> D[d1][d2] = dense_colors_O1O2( Fd[ d2 + NS*d1 ] ) ;
+    }
+  }
+  return ;
+}
+
+// the old dense O2O1, O3O1 is this with D and S swapped
+static void
+dense_O2O1( struct spinmatrix *P ,
+	    const struct spinor U ,
+	    const struct spinor D ,
+	    const struct spinor S ,
+	    const struct spinor B ,
+	    const struct gamma OP1 ,
+	    const struct gamma OP2 )
+{
+  const struct gamma C1 = CGmu( OP1 , GAMMAS ) ;
+  const struct gamma C2 = CGmu( OP2 , GAMMAS ) ;
+  const struct gamma tC2t = gt_Gdag_gt( C2 , GAMMAS[ GAMMA_T ] ) ;
+
+  struct spinor M = S , Temp = D ;
+  gamma_mul_lr( &M , OP1 , tC2t ) ;
+  spinmul_atomic_left( &M , B ) ;
+  gamma_mul_lr( &Temp , C1 , tC2t ) ;
+
+  dense_F_mixed( Fd , spinor_to_Ospinor( M ) ,
+		 spinor_to_Ospinor( transpose_spinor( U ) ) ,
+		 spinor_to_Ospinor( Temp ) , spinor_to_Ospinor( U ) ,
+		 GLU_FALSE ) ;
+
+  size_t d1 , d2 ;
+  for( d1 = 0 ; d1 < NS ; d1++ ) {
+    for( d2 = 0 ; d2 < NS ; d2++ ) {
+      P -> D[d1][d2] = dense_colors_O2O1( Fd[ d2 + NS*d1 ] ) ;
+    }
+  }
+  return ;
+}
+
+// the diquark blocks of pentas() against the old dense F-tensor code
+static char *
+penta_diquark_blocks_test( void )
+{
+  struct spinor U , D , S , B ;
+  random_spinor( &U , 0 ) ;
+  random_spinor( &D , 1 ) ;
+  random_spinor( &S , 2 ) ;
+  random_spinor( &B , 3 ) ;
+
+  double complex result[ 2*PENTA_NOPS*PENTA_NBLOCK*PENTA_NBLOCK ] ;
+  mu_assert( "[PENTA UNIT] error : pentas failed\n" ,
+	     pentas( result , U , D , S , B , GAMMAS , &PC ) == SUCCESS ) ;
+
+  const struct gamma GBLOCK[ 4 ] = { GAMMAS[ GAMMA_5 ] ,
+				     GAMMAS[ IDENTITY ] ,
+				     GAMMAS[ AT ] ,
+				     GAMMAS[ GAMMA_T ] } ;
+  const size_t ops[ 5 ] = { 0 , 1 , 2 , 3 , 6 } ;
+
+  size_t b1 , b2 , o ;
+  for( b1 = 0 ; b1 < PENTA_NBLOCK ; b1++ ) {
+    for( b2 = 0 ; b2 < PENTA_NBLOCK ; b2++ ) {
+      for( o = 0 ; o < 5 ; o++ ) {
+	const size_t i = ops[ o ] ;
+	const struct gamma G1 = GBLOCK[ b1 ] , G2 = GBLOCK[ b2 ] ;
+	struct spinmatrix P ;
+	switch( i ) {
+	case 0 : dense_O1O1( &P , U , D , S , B , G1 , G2 ) ; break ;
+	case 1 : dense_O1O2( &P , U , D , S , B , G1 , G2 ) ; break ;
+	case 2 : dense_O1O2( &P , U , S , D , B , G1 , G2 ) ; break ;
+	case 3 : dense_O2O1( &P , U , D , S , B , G1 , G2 ) ; break ;
+	case 6 : dense_O2O1( &P , U , S , D , B , G1 , G2 ) ; break ;
+	}
+	// the diquark ones are positive parity ops
+	const double complex t1 = spinmatrix_trace( P.D ) ;
+	const double complex t2 = gammaspinmatrix_trace( GAMMAS[ GAMMA_T ] , P.D ) ;
+	const double complex neg = 0.5 * ( t1 + t2 ) , pos = 0.5 * ( t1 - t2 ) ;
+
+	const size_t icol = i%3 , irow = i/3 ;
+	const size_t id = icol*PENTA_NBLOCK + irow*3*PENTA_NBLOCK*PENTA_NBLOCK +
+	  b2 + b1*PENTA_NBLOCK*3 ;
+	const double complex rpos = result[ id ] ;
+	const double complex rneg = result[ id + PENTA_NOPS*PENTA_NBLOCK*PENTA_NBLOCK ] ;
+
+	mu_assert( "[PENTA UNIT] error : diquark block broken\n" ,
+		   cabs( rpos - pos ) < FLTOL*( 1 + cabs( pos ) ) &&
+		   cabs( rneg - neg ) < FLTOL*( 1 + cabs( neg ) ) ) ;
+      }
+    }
+  }
+  return NULL ;
+}
+
+// penta tests
+static char *
+penta_test( void )
+{
+  mu_run_test( penta_diquark_blocks_test ) ;
+  return NULL ;
+}
+
+// runs the whole #!
+int
+penta_test_driver( void )
+{
+  // init to zero again
+  tests_run = tests_fail = 0 ;
+
+  // precompute the gamma basis
+  GAMMAS = malloc( NSNS * sizeof( struct gamma ) ) ;
+  make_gammas( GAMMAS , CHIRAL ) ;
+
+  // the term lists and the old dense tensors
+  init_penta_colors( &PC ) ;
+  size_t j , k ;
+  Fd = malloc( NSNS * sizeof( double complex* ) ) ;
+  for( j = 0 ; j < NSNS ; j++ ) {
+    Fd[ j ] = malloc( PENTA_NCOLORS * sizeof( double complex ) ) ;
+  }
+  for( j = 0 ; j < PENTA_NCOLORS ; j++ ) {
+    size_t sub = j ;
+    for( k = 0 ; k < 8 ; k++ ) {
+      loc[ j ][ k ] = (uint8_t)( sub % NC ) ;
+      sub /= NC ;
+    }
+  }
+
+  char *pentares = penta_test( ) ;
+
+  for( j = 0 ; j < NSNS ; j++ ) {
+    free( Fd[ j ] ) ;
+  }
+  free( Fd ) ;
+  free_penta_colors( &PC ) ;
+  free( GAMMAS ) ;
+
+  if( tests_fail == 0 ) {
+    fprintf( stdout , "[PENTA UNIT] all %d tests passed\n\n" ,
+	     tests_run ) ;
+    return SUCCESS ;
+  } else {
+    fprintf( stderr , "%s \n" , pentares ) ;
+    fprintf( stderr , "[PENTA UNIT] %d out of %d tests failed\n\n" ,
+	     tests_fail , tests_run ) ;
+    return FAILURE ;
+  }
+}
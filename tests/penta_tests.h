@@ -0,0 +1,16 @@
+/**
+   @file penta_tests.h
+   @brief prototype declarations for pentaquark contraction tests
+ */
+#ifndef PENTA_TESTS_H
+#define PENTA_TESTS_H
+
+/**
+   @fn int penta_test_driver( void )
+   @brief driver for pentaquark contraction tests
+   @return #SUCCESS or #FAILURE 
+ */
+int
+penta_test_driver( void ) ;
+
+#endif
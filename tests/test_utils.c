@@ -0,0 +1,29 @@
+/**
+   @file test_utils.c
+   @brief helpers shared by the unit tests
+ */
+#include "common.h"
+
+#include "par_rng.h"       // cb_rng() && cb_U1()
+#include "test_utils.h"    // random_spinor()
+
+// fill a spinor with reproducible random numbers, hit picks the stream
+void
+random_spinor( struct spinor *S ,
+	       const size_t hit )
+{
+  size_t d1 , d2 , c1 , c2 ;
+  for( d1 = 0 ; d1 < NS ; d1++ ) {
+    for( d2 = 0 ; d2 < NS ; d2++ ) {
+      for( c1 = 0 ; c1 < NC ; c1++ ) {
+	for( c2 = 0 ; c2 < NC ; c2++ ) {
+	  // sum of two phases so that the magnitudes vary too
+	  S -> D[d1][d2].C[c1][c2] =
+	    cb_U1( cb_rng( 1234 , d2 + NS*d1 , hit , c1 , c2 ) ) +
+	    cb_U1( cb_rng( 4321 , d2 + NS*d1 , hit , c1 , c2 ) ) ;
+	}
+      }
+    }
+  }
+  return ;
+}
@@ -0,0 +1,16 @@
+/**
+   @file test_utils.h
+   @brief prototype declarations for helpers shared by the unit tests
+ */
+#ifndef TEST_UTILS_H
+#define TEST_UTILS_H
+
+/**
+   @fn void random_spinor( struct spinor *S , const size_t hit )
+   @brief fills S with reproducible random numbers, hit picks the stream
+ */
+void
+random_spinor( struct spinor *S ,
+	       const size_t hit ) ;
+
+#endif
@@ -7,6 +7,12 @@
 #include "contractions.h"       // simple_meson_contract
 #include "gammas.h"             // Cgmu, make_gammas
 #include "minunit.h"            // mu_assert
+#if NC == 2
+  #include "dibaryon_contractions.h" // dibaryon_halfblocks, dibaryon_contract_batch ...
+  #include "Ospinor.h"               // spinor_to_Ospinor
+  #include "scratch.h"               // init_scratch
+  #include "test_utils.h"            // random_spinor
+#endif
 #include "spinor_ops.h"         // spinor_identity
 #include "spinmatrix_ops.h"     // get_spinmatrix
 #include "tetra_contractions.h" // precompute_block, get_abcd ...
@@ -238,6 +244,137 @@ spinmatrix_trace_test( void )
   return NULL ;
 }
 
+#if NC == 2
+
+// the diquark blocks as they were built before the split into half
+// blocks, blk[abcd] = OST.C[ap][bp] ( G OS.C[a][b] tGt )
+static void
+full_blocks( struct spinmatrix *blk ,
+	     const struct spinor S ,
+	     const struct gamma G ,
+	     const struct gamma tGt )
+{
+  const struct Ospinor OST = spinor_to_Ospinor( transpose_spinor( S ) ) ;
+  const struct Ospinor OS  = spinor_to_Ospinor( S ) ;
+  struct spinmatrix tmp ;
+  size_t abcd ;
+  for( abcd = 0 ; abcd < NCNC*NCNC ; abcd++ ) {
+    const size_t a = abcd >> 3 , b = ( abcd >> 2 )&1 ;
+    const size_t ap = ( abcd >> 1 )&1 , bp = abcd&1 ;
+    tmp = OS.C[a][b] ;
+    gamma_spinmatrix_lr( &tmp , G , tGt ) ;
+    spinmatrix_multiply( (void*)blk[ abcd ].D ,
+			 (void*)OST.C[ap][bp].D , (void*)tmp.D ) ;
+  }
+  return ;
+}
+
+// the full-block dibaryon contraction
+static double complex
+full_dibaryon( const struct spinor S1 ,
+	       const struct spinor S2 ,
+	       const struct gamma *CG ,
+	       const struct gamma *tCGt ,
+	       const size_t GSRC ,
+	       const size_t GSNK )
+{
+  struct spinmatrix blk11[ NCNC*NCNC ] , blk12[ NCNC*NCNC ] ,
+    blk21[ NCNC*NCNC ] , blk22[ NCNC*NCNC ] ;
+  full_blocks( blk11 , S2 , CG[ GSRC ] , tCGt[ GSRC ] ) ;
+  full_blocks( blk12 , S2 , CG[ GSRC ] , tCGt[ GSNK ] ) ;
+  full_blocks( blk21 , S1 , CG[ GSNK ] , tCGt[ GSRC ] ) ;
+  full_blocks( blk22 , S1 , CG[ GSNK ] , tCGt[ GSNK ] ) ;
+  return dibaryon_diagrams( blk11 , blk12 , blk21 , blk22 ) ;
+}
+
+// test the half blocks finished off with the right gamma against
+// the full blocks for random spinors
+static char *
+dibaryon_halfblocks_test( void )
+{
+  random_spinor( &S1 , 0 ) ;
+
+  struct gamma CG[ NSNS ] , tCGt[ NSNS ] ;
+  dibaryon_gammas( CG , tCGt , GAMMAS , NSNS ) ;
+
+  struct spinmatrix L[ NSNS*NCNC*NCNC ] ;
+  dibaryon_halfblocks( L , S1 , CG , NSNS ) ;
+
+  size_t g1 , g2 , abcd , d ;
+  for( g1 = 0 ; g1 < NSNS ; g1++ ) {
+    for( g2 = 0 ; g2 < NSNS ; g2++ ) {
+      struct spinmatrix blk[ NCNC*NCNC ] , ref[ NCNC*NCNC ] ;
+      dibaryon_blocks( blk , L + g1*NCNC*NCNC , tCGt[ g2 ] ) ;
+      full_blocks( ref , S1 , CG[ g1 ] , tCGt[ g2 ] ) ;
+      for( abcd = 0 ; abcd < NCNC*NCNC ; abcd++ ) {
+	for( d = 0 ; d < NSNS ; d++ ) {
+	  mu_assert( "[UNIT] error : dibaryon half blocks broken\n" ,
+		     cabs( blk[ abcd ].D[ d/NS ][ d%NS ] -
+			   ref[ abcd ].D[ d/NS ][ d%NS ] ) < FLTOL ) ;
+	}
+      }
+    }
+  }
+  return NULL ;
+}
+
+// test dibaryon_contract against the full blocks for two different
+// random spinors
+static char *
+dibaryon_contract_test( void )
+{
+  random_spinor( &S1 , 0 ) ;
+  random_spinor( &S2 , 1 ) ;
+
+  struct gamma CG[ NSNS ] , tCGt[ NSNS ] ;
+  dibaryon_gammas( CG , tCGt , GAMMAS , NSNS ) ;
+
+  size_t GSRC , GSNK ;
+  for( GSRC = 0 ; GSRC < NSNS ; GSRC++ ) {
+    for( GSNK = 0 ; GSNK < NSNS ; GSNK++ ) {
+      const double complex ref =
+	full_dibaryon( S1 , S2 , CG , tCGt , GSRC , GSNK ) ;
+      const double complex res =
+	dibaryon_contract( S1 , S2 , GAMMAS , GSRC , GSNK ) ;
+      mu_assert( "[UNIT] error : dibaryon_contract broken\n" ,
+		 cabs( res - ref ) < FLTOL*( 1 + cabs( ref ) ) ) ;
+    }
+  }
+  return NULL ;
+}
+
+// test every channel of dibaryon_contract_batch against the full blocks
+static char *
+dibaryon_batch_test( void )
+{
+  random_spinor( &S1 , 2 ) ;
+
+  struct gamma CG[ NSNS ] , tCGt[ NSNS ] ;
+  dibaryon_gammas( CG , tCGt , GAMMAS , NSNS ) ;
+
+  double complex res[ NSNS*NSNS ] ;
+  mu_assert( "[UNIT] error : dibaryon_contract_batch scratch failed\n" ,
+	     init_scratch( dibaryon_scratch_bytes( NSNS ) ) == SUCCESS ) ;
+  const int flag = dibaryon_contract_batch( res , S1 , CG , tCGt , NSNS ) ;
+  free_scratch( ) ;
+  mu_assert( "[UNIT] error : dibaryon_contract_batch failed\n" ,
+	     flag == SUCCESS ) ;
+
+  size_t GSRC , GSNK ;
+  for( GSRC = 0 ; GSRC < NSNS ; GSRC++ ) {
+    for( GSNK = 0 ; GSNK < NSNS ; GSNK++ ) {
+      const double complex ref =
+	full_dibaryon( S1 , S1 , CG , tCGt , GSRC , GSNK ) ;
+      mu_assert( "[UNIT] error : dibaryon_contract_batch broken\n" ,
+		 cabs( res[ GSNK + NSNS*GSRC ] - ref ) <
+		 FLTOL*( 1 + cabs( ref ) ) ) ;
+    }
+  }
+  return NULL ;
+}
+
+#endif
+
 // baryon operations tests
 static char *
 tetra_contractions_test( void )
@@ -251,6 +388,13 @@ tetra_contractions_test( void )
   mu_run_test( spincolor_trace_test ) ;
   mu_run_test( spinmatrix_trace_test ) ;
 
+  // the split dibaryon blocks against the full ones
+#if NC == 2
+  mu_run_test( dibaryon_halfblocks_test ) ;
+  mu_run_test( dibaryon_contract_test ) ;
+  mu_run_test( dibaryon_batch_test ) ;
+#endif
+
   return NULL ;
 }
 
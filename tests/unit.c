@@ -12,6 +12,7 @@
 #include "geometry.h"          // init_geom()
 #include "halfspinor_tests.h"
 #include "matops_tests.h"
+#include "penta_tests.h"
 #include "SSE_tests.h"
 #include "spinmatrix_tests.h"
 #include "spinor_tests.h"
@@ -82,6 +83,12 @@ main( const int argc , const char *argv[] )
   if( tetra_contractions_test_driver( ) == FAILURE ) goto failure ;
   total += tests_run ;
 
+  // have a look at the pentaquark operator blocks
+#if NC == 3
+  if( penta_test_driver( ) == FAILURE ) goto failure ;
+  total += tests_run ;
+#endif
+
   fprintf( stdout , "[UNIT] %d tests run and passed\n" , total ) ;
 
   return SUCCESS ;